@@ -1,16 +1,199 @@
+#define _POSIX_C_SOURCE 200809L
 #include <zeda/zeda_ztk.h>
+#include <zeda/zeda_option.h>
+#include <time.h>
+#ifdef __ZEDA_USE_PTHREAD
+#include <pthread.h>
+#endif /* __ZEDA_USE_PTHREAD */
 
-int main(int argc, char *argv[])
+enum{
+  ZTKDUMP_STAT = 0,
+  ZTKDUMP_JOBS,
+  ZTKDUMP_CACHE,
+  ZTKDUMP_QUIET,
+  ZTKDUMP_HELP
+};
+zOption option[] = {
+  { "s", "stat", NULL, "report parse time, numbers of tags, keys and values, memory footprint and include depth of each file", NULL, false },
+  { "j", "jobs", "<n>", "parse files in parallel by n threads", (char *)"1", false },
+  { "c", "cache", NULL, "convert files to binary caches (.ztkc)", NULL, false },
+  { "q", "quiet", NULL, "only validate files", NULL, false },
+  { "h", "help", NULL, "show this message", NULL, false },
+  { NULL, NULL, NULL, NULL, NULL, false },
+};
+
+void ztkdump_usage(char *argv)
 {
+  eprintf( "Usage: %s [options] <.ztk/.ztkc file> ...\n", argv );
+  eprintf( "A binary cache (.ztkc) is converted to ZTK format.\n" );
+  eprintf( "<options>\n" );
+  zOptionHelp( option );
+}
+
+/* result of a file */
+typedef struct{
+  const char *path;
   ZTK ztk;
+  bool ok;
+  bool stale; /* converted from a stale cache */
+  double time;
+  ZTKStats stats;
+} ztkdump_t;
+
+/* wall-clock time */
+double ztkdump_clock(void)
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif /* CLOCK_MONOTONIC */
+}
+
+/* check if a file is a binary cache */
+bool ztkdump_iscache(const char *path)
+{
+  size_t len;
+
+  len = strlen( path );
+  return len > 5 && strcmp( path + len - 5, ".ztkc" ) == 0;
+}
+
+/* check if parsed trees are kept to be output */
+bool ztkdump_keep(void)
+{
+  return option[ZTKDUMP_CACHE].flag || ( !option[ZTKDUMP_STAT].flag && !option[ZTKDUMP_QUIET].flag );
+}
+
+/* parse a file or read a binary cache */
+void ztkdump_parse(ztkdump_t *dump)
+{
+  double t;
+
+  ZTKInit( &dump->ztk );
+  t = ztkdump_clock();
+  dump->stale = false;
+  dump->ok = ztkdump_iscache( dump->path ) ?
+    ZTKReadCacheRaw( &dump->ztk, dump->path, &dump->stale ) : ZTKParse( &dump->ztk, dump->path );
+  dump->time = ztkdump_clock() - t;
+  if( option[ZTKDUMP_STAT].flag ) ZTKGetStats( &dump->ztk, &dump->stats );
+  if( !ztkdump_keep() ) ZTKDestroy( &dump->ztk ); /* to save memory for many files */
+}
+
+/* a pool of files to be parsed in parallel */
+typedef struct{
+  ztkdump_t *dump;
+  int num;
+  int next;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_t mutex;
+#endif /* __ZEDA_USE_PTHREAD */
+} ztkdump_pool_t;
+
+void *ztkdump_worker(void *arg)
+{
+  ztkdump_pool_t *pool;
+  int i;
+
+  pool = (ztkdump_pool_t *)arg;
+  while( 1 ){
+#ifdef __ZEDA_USE_PTHREAD
+    pthread_mutex_lock( &pool->mutex );
+#endif /* __ZEDA_USE_PTHREAD */
+    i = pool->next++;
+#ifdef __ZEDA_USE_PTHREAD
+    pthread_mutex_unlock( &pool->mutex );
+#endif /* __ZEDA_USE_PTHREAD */
+    if( i >= pool->num ) break;
+    ztkdump_parse( &pool->dump[i] );
+  }
+  return NULL;
+}
+
+void ztkdump_parse_all(ztkdump_pool_t *pool, int threadnum)
+{
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_t *thread;
+  int i, n = 0;
+
+  pool->next = 0;
+  pthread_mutex_init( &pool->mutex, NULL );
+  if( threadnum > 1 && ( thread = zAlloc( pthread_t, threadnum ) ) ){
+    for( n=0; n<threadnum; n++ )
+      if( pthread_create( &thread[n], NULL, ztkdump_worker, pool ) != 0 ) break;
+    for( i=0; i<n; i++ )
+      pthread_join( thread[i], NULL );
+    free( thread );
+  }
+  if( n == 0 ) ztkdump_worker( pool ); /* parse files serially */
+  pthread_mutex_destroy( &pool->mutex );
+#else
+  pool->next = 0;
+  ztkdump_worker( pool );
+#endif /* __ZEDA_USE_PTHREAD */
+}
+
+/* output the result of a file */
+bool ztkdump_output(ztkdump_t *dump)
+{
+  char cachepath[BUFSIZ];
+
+  if( !dump->ok ){
+    eprintf( "%s: failed to parse\n", dump->path );
+    return false;
+  }
+  if( dump->stale )
+    eprintf( "%s: warning: stale cache, the source files or the tokenizer settings have been changed\n", dump->path );
+  if( option[ZTKDUMP_STAT].flag )
+    printf( "%s: %g sec., %ld tags, %ld keys, %ld values, %lu bytes (%lu in strings), include depth %d\n", dump->path,
+      dump->time, dump->stats.tagnum, dump->stats.keynum, dump->stats.valnum,
+      (unsigned long)( dump->stats.strsize + dump->stats.listsize ), (unsigned long)dump->stats.strsize, dump->stats.incdepth );
+  if( option[ZTKDUMP_CACHE].flag && !ztkdump_iscache( dump->path ) ){
+    if( !ZTKWriteCache( &dump->ztk, ZTKCachePath( dump->path, cachepath, BUFSIZ ) ) ){
+      eprintf( "%s: failed to write a cache\n", cachepath );
+      return false;
+    }
+    if( !option[ZTKDUMP_QUIET].flag ) printf( "%s -> %s\n", dump->path, cachepath );
+  } else
+  if( !option[ZTKDUMP_STAT].flag && !option[ZTKDUMP_QUIET].flag )
+    ZTKPrint( &dump->ztk );
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  zStrAddrList arglist;
+  zStrAddrListCell *cp;
+  ztkdump_pool_t pool;
+  int i, ret = EXIT_SUCCESS;
 
   if( argc <= 1 ){
-    eprintf( "Usage: %s <.ztk file>\n", argv[0] );
+    ztkdump_usage( argv[0] );
     return 0;
   }
-  ZTKInit( &ztk );
-  ZTKParse( &ztk, argv[1] );
-  ZTKPrint( &ztk );
-  ZTKDestroy( &ztk );
-  return 0;
+  if( !zOptionRead( option, argv+1, &arglist ) || option[ZTKDUMP_HELP].flag || zListIsEmpty(&arglist) ){
+    ztkdump_usage( argv[0] );
+    zStrAddrListDestroy( &arglist );
+    return option[ZTKDUMP_HELP].flag ? 0 : EXIT_FAILURE;
+  }
+  pool.num = zListSize( &arglist );
+  if( !( pool.dump = zAlloc( ztkdump_t, pool.num ) ) ){
+    ZALLOCERROR();
+    zStrAddrListDestroy( &arglist );
+    return EXIT_FAILURE;
+  }
+  i = 0;
+  zListForEach( &arglist, cp )
+    pool.dump[i++].path = cp->data;
+  ztkdump_parse_all( &pool, atoi( option[ZTKDUMP_JOBS].arg ) );
+  for( i=0; i<pool.num; i++ ){
+    if( !ztkdump_output( &pool.dump[i] ) ) ret = EXIT_FAILURE;
+    if( ztkdump_keep() ) ZTKDestroy( &pool.dump[i].ztk );
+  }
+  free( pool.dump );
+  zStrAddrListDestroy( &arglist );
+  return ret;
 }
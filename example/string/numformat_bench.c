@@ -0,0 +1,57 @@
+/* benchmark of formatting numbers: zNumFormatDouble() and zNumFormatInt() vs. sprintf() */
+#include <zeda/zeda_string.h>
+#include <zeda/zeda_rand.h>
+#include <math.h>
+
+#define NUM       1000000
+#define TRIAL_NUM 5
+
+int main(void)
+{
+  double *val, t_num, t_17g, t_10g, t_int, t_d;
+  int *ival, i, j, mismatch = 0;
+  char buf[BUFSIZ];
+  size_t len = 0;
+  clock_t c;
+
+  zRandInit();
+  if( !( val = zAlloc( double, NUM ) ) || !( ival = zAlloc( int, NUM ) ) ) return EXIT_FAILURE;
+  for( i=0; i<NUM; i++ ){
+    val[i] = i % 2 ? zRandF(-1000,1000) : zRandF(-1,1) * pow( 10, zRandI(-300,300) );
+    ival[i] = zRandI(-1000000,1000000);
+  }
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) len += zNumFormatDouble( val[i], buf );
+  t_num = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) len += sprintf( buf, "%.17g", val[i] );
+  t_17g = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) len += sprintf( buf, "%.10g", val[i] );
+  t_10g = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) len += zNumFormatInt( ival[i], buf );
+  t_int = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) len += sprintf( buf, "%d", ival[i] );
+  t_d = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  for( i=0; i<NUM; i++ ){
+    zNumFormatDouble( val[i], buf );
+    if( strtod( buf, NULL ) != val[i] ) mismatch++;
+  }
+  printf( "%d numbers, average of %d trials (%lu bytes)\n", NUM, TRIAL_NUM, (unsigned long)len );
+  printf( "  zNumFormatDouble : %g sec.\n", t_num );
+  printf( "  sprintf(\"%%.17g\") : %g sec.\n", t_17g );
+  printf( "  sprintf(\"%%.10g\") : %g sec. (not round-trip)\n", t_10g );
+  printf( "  zNumFormatInt    : %g sec.\n", t_int );
+  printf( "  sprintf(\"%%d\")    : %g sec.\n", t_d );
+  printf( "  not read back    : %d\n", mismatch );
+  free( val );
+  free( ival );
+  return mismatch == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,64 @@
+/* benchmark of parsing real numbers: zNumParseDouble() vs. strtod() */
+#include <zeda/zeda_string.h>
+#include <zeda/zeda_rand.h>
+#include <math.h>
+
+#define NUM       1000000
+#define TRIAL_NUM 5
+
+/* build a list of numbers in various formats */
+char *generate(size_t *offset)
+{
+  char *text, *cp;
+  int i;
+
+  if( !( text = zAlloc( char, NUM * 32 ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  for( cp=text, i=0; i<NUM; i++ ){
+    offset[i] = cp - text;
+    switch( i % 4 ){
+    case 0:  cp += sprintf( cp, "%.17g", zRandF(-1,1) * pow( 10, zRandI(-300,300) ) ); break;
+    case 1:  cp += sprintf( cp, "%.6f", zRandF(-1000,1000) ); break;
+    case 2:  cp += sprintf( cp, "%d", zRandI(-100000,100000) ); break;
+    default: cp += sprintf( cp, "%.10g", zRandF(-1,1) ); break;
+    }
+    *cp++ = '\0';
+  }
+  return text;
+}
+
+int main(void)
+{
+  char *text;
+  size_t *offset;
+  double v1, v2, s1 = 0, s2 = 0, t1, t2;
+  clock_t c;
+  int i, j, mismatch = 0;
+
+  zRandInit();
+  if( !( offset = zAlloc( size_t, NUM ) ) || !( text = generate( offset ) ) ) return EXIT_FAILURE;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ){
+      zNumParseDouble( text+offset[i], strlen(text+offset[i]), &v1 );
+      s1 += v1;
+    }
+  t1 = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  c = clock();
+  for( j=0; j<TRIAL_NUM; j++ )
+    for( i=0; i<NUM; i++ ) s2 += strtod( text+offset[i], NULL );
+  t2 = (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+  for( i=0; i<NUM; i++ ){
+    zNumParseDouble( text+offset[i], strlen(text+offset[i]), &v1 );
+    if( v1 != ( v2 = strtod( text+offset[i], NULL ) ) ) mismatch++;
+  }
+  printf( "%d numbers, average of %d trials\n", NUM, TRIAL_NUM );
+  printf( "  zNumParseDouble: %g sec. (sum %g)\n", t1, s1 );
+  printf( "  strtod         : %g sec. (sum %g)\n", t2, s2 );
+  printf( "  mismatch       : %d\n", mismatch );
+  free( text );
+  free( offset );
+  return mismatch == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,73 @@
+/* benchmark of search of many keywords: one pass of Aho-Corasick automaton vs. a pass per keyword */
+#include <zeda/zeda_strlist.h>
+#include <zeda/zeda_rand.h>
+
+#define TEXT_SIZE   0x1000000
+#define KEYWORD_NUM 200
+
+/* build a synthetic log text */
+char *generate(void)
+{
+  char *text, *cp;
+
+  if( !( text = zAlloc( char, TEXT_SIZE + BUFSIZ ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  for( cp=text; cp-text<TEXT_SIZE; )
+    cp += sprintf( cp, "2026-10-18 12:%02d:%02d worker-%d: processed request %d of user%d\n",
+      zRandI(0,59), zRandI(0,59), zRandI(0,15), zRandI(0,999999), zRandI(0,99999) );
+  return text;
+}
+
+/* keywords, some of which appear in the text */
+void keywords(zStrList *list)
+{
+  char buf[BUFSIZ];
+  int i;
+
+  zListInit( list );
+  for( i=0; i<KEYWORD_NUM; i++ ){
+    sprintf( buf, i % 2 ? "user%d\n" : "request %d ", zRandI(0,99999) );
+    zStrListAdd( list, buf );
+  }
+}
+
+int main(void)
+{
+  zStrList list;
+  zStrListCell *cp;
+  zStrMultiSearch ms;
+  zStrPattern pattern;
+  char *text;
+  const char *tp;
+  size_t len;
+  int count_ms, count_pat = 0;
+  clock_t c;
+  double t_compile, t_ms, t_pat;
+
+  zRandInit();
+  if( !( text = generate() ) ) return EXIT_FAILURE;
+  len = strlen( text );
+  keywords( &list );
+  c = clock();
+  zStrMultiSearchCompile( &ms, &list );
+  t_compile = (double)( clock() - c ) / CLOCKS_PER_SEC;
+  c = clock();
+  count_ms = zStrMultiSearchMem( &ms, text, len, NULL, NULL );
+  t_ms = (double)( clock() - c ) / CLOCKS_PER_SEC;
+  c = clock();
+  zListForEach( &list, cp ){
+    zStrPatternCompileStr( &pattern, cp->data );
+    for( tp=text; ( tp = zStrPatternSearch( &pattern, tp, text + len - tp ) ); tp++ ) count_pat++;
+    zStrPatternDestroy( &pattern );
+  }
+  t_pat = (double)( clock() - c ) / CLOCKS_PER_SEC;
+  printf( "text: %lu bytes, %d keywords\n", (unsigned long)len, KEYWORD_NUM );
+  printf( "zStrMultiSearchMem          : %g sec. (compile %g sec.), %d found\n", t_ms, t_compile, count_ms );
+  printf( "zStrPatternSearch x keywords: %g sec., %d found\n", t_pat, count_pat );
+  zStrMultiSearchDestroy( &ms );
+  zStrListDestroy( &list );
+  free( text );
+  return count_ms == count_pat ? EXIT_SUCCESS : EXIT_FAILURE;
+}
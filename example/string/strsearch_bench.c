@@ -0,0 +1,82 @@
+/* benchmark of string search: Knuth-Morris-Pratt vs. Boyer-Moore vs. compiled patterns */
+#include <zeda/zeda_string.h>
+#include <zeda/zeda_rand.h>
+
+#define TEXT_SIZE 0x1000000
+#define TRIAL_NUM 10
+
+/* build a synthetic log text */
+char *generate(void)
+{
+  const char *level[] = { "INFO", "DEBUG", "WARN", "TRACE" };
+  char *text, *cp;
+
+  if( !( text = zAlloc( char, TEXT_SIZE + BUFSIZ ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  for( cp=text; cp-text<TEXT_SIZE; )
+    cp += sprintf( cp, "2026-10-18 12:%02d:%02d.%03d [%s] worker-%d: processed request %d in %d us\n",
+      zRandI(0,59), zRandI(0,59), zRandI(0,999), level[zRandI(0,3)], zRandI(0,15), zRandI(0,999999), zRandI(0,9999) );
+  return text;
+}
+
+/* count occurrences of a pattern in a text by a search function */
+double search(char *text, char *pat, char *(* f)(char*,char*), int *count)
+{
+  clock_t c;
+  char *cp;
+  int i;
+
+  c = clock();
+  for( i=0; i<TRIAL_NUM; i++ )
+    for( *count=0, cp=text; ( cp = f( cp, pat ) ); cp++ ) (*count)++;
+  return (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+}
+
+/* count occurrences of a pattern in a text by a compiled pattern */
+double search_pattern(char *text, size_t len, char *pat, int *count)
+{
+  zStrPattern pattern;
+  clock_t c;
+  const char *cp;
+  int i;
+
+  zStrPatternCompileStr( &pattern, pat );
+  c = clock();
+  for( i=0; i<TRIAL_NUM; i++ )
+    for( *count=0, cp=text; ( cp = zStrPatternSearch( &pattern, cp, text + len - cp ) ); cp++ ) (*count)++;
+  zStrPatternDestroy( &pattern );
+  return (double)( clock() - c ) / CLOCKS_PER_SEC / TRIAL_NUM;
+}
+
+/* a wrapper of strstr() */
+char *search_strstr(char *text, char *pat){ return strstr( text, pat ); }
+
+int main(void)
+{
+  char *pat[] = { "[ERROR]", "worker-3: processed request 4242", "us\n2026-10-18 12:00:00.000", NULL };
+  char *text, **pp;
+  size_t len;
+  int c_kmp, c_bm, c_pat, c_std;
+  double t_kmp, t_bm, t_pat, t_std;
+
+  zRandInit();
+  if( !( text = generate() ) ) return EXIT_FAILURE;
+  len = strlen( text );
+  printf( "text: %lu bytes, average of %d trials\n", (unsigned long)len, TRIAL_NUM );
+  for( pp=pat; *pp; pp++ ){
+    t_kmp = search( text, *pp, zStrSearchKMP, &c_kmp );
+    t_bm  = search( text, *pp, zStrSearchBM, &c_bm );
+    t_pat = search_pattern( text, len, *pp, &c_pat );
+    t_std = search( text, *pp, search_strstr, &c_std );
+    printf( "pattern %d: %d bytes, %d found\n", (int)( pp - pat ), (int)strlen( *pp ), c_std );
+    printf( "  zStrSearchKMP    : %g sec.\n", t_kmp );
+    printf( "  zStrSearchBM     : %g sec.\n", t_bm );
+    printf( "  zStrPatternSearch: %g sec.\n", t_pat );
+    printf( "  strstr           : %g sec.\n", t_std );
+    printf( "  identical counts : %s\n", zBoolStr( c_kmp == c_std && c_bm == c_std && c_pat == c_std ) );
+  }
+  free( text );
+  return EXIT_SUCCESS;
+}
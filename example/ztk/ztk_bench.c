@@ -0,0 +1,198 @@
+/* benchmark suite of ZTK: parsing, evaluation, output and destruction of synthetic large files */
+#include <zeda/zeda_ztk.h>
+#include <math.h>
+
+#define BENCH_FILE "ztk_bench_%d.ztk"
+#define BENCH_TRIAL 5
+
+/* shape of a synthetic ZTK file */
+typedef struct{
+  int tagnum; /* number of tagged fields */
+  int keynum; /* number of keys per tagged field */
+  int valnum; /* number of numeric values per key */
+  int depth;  /* depth of a chain of included files */
+} shape_t;
+
+/* generate a chain of synthetic ZTK files, which returns the total size of files */
+long generate(shape_t *shape)
+{
+  FILE *fp;
+  char filename[BUFSIZ];
+  int d, i, j, k, tagnum;
+  long size = 0;
+
+  for( d=0; d<=shape->depth; d++ ){
+    sprintf( filename, BENCH_FILE, d );
+    if( !( fp = fopen( filename, "w" ) ) ){
+      ZOPENERROR( filename );
+      return -1;
+    }
+    tagnum = shape->tagnum / ( shape->depth + 1 ) + ( d < shape->tagnum % ( shape->depth + 1 ) ? 1 : 0 );
+    for( i=0; i<tagnum; i++ ){
+      fprintf( fp, "[tag]\n" );
+      for( j=0; j<shape->keynum; j++ ){
+        fprintf( fp, "key_%d:", j );
+        for( k=0; k<shape->valnum; k++ )
+          fprintf( fp, " %.10g", 0.001 * ( i * shape->valnum + k ) - j );
+        fprintf( fp, "\n" );
+      }
+    }
+    if( d < shape->depth ){
+      sprintf( filename, BENCH_FILE, d+1 );
+      fprintf( fp, "include %s\n", filename );
+    }
+    size += ftell( fp );
+    fclose( fp );
+  }
+  return size;
+}
+
+/* remove generated files */
+void cleanup(shape_t *shape)
+{
+  char filename[BUFSIZ];
+  int d;
+
+  for( d=0; d<=shape->depth; d++ ){
+    sprintf( filename, BENCH_FILE, d );
+    remove( filename );
+  }
+}
+
+/* evaluators */
+ZTKPrp *prp_key;
+
+void *eval_key(void *obj, int i, void *arg, ZTK *ztk)
+{
+  while( ZTKValPtr(ztk) )
+    *(double *)obj += ZTKDouble( ztk );
+  return obj;
+}
+
+void *eval_tag(void *obj, int i, void *arg, ZTK *ztk)
+{
+  return ZTKEvalKey( obj, NULL, ztk, prp_key, *(int *)arg );
+}
+
+#define PRP_KEY_STRSIZ 16
+char *prp_key_str;
+
+bool prp_key_create(int keynum)
+{
+  int i;
+
+  prp_key = zAlloc( ZTKPrp, keynum );
+  prp_key_str = zAlloc( char, keynum * PRP_KEY_STRSIZ );
+  if( !prp_key || !prp_key_str ){
+    ZALLOCERROR();
+    return false;
+  }
+  for( i=0; i<keynum; i++ ){
+    sprintf( prp_key_str + i * PRP_KEY_STRSIZ, "key_%d", i );
+    prp_key[i].str = prp_key_str + i * PRP_KEY_STRSIZ;
+    prp_key[i].num = 1;
+    prp_key[i]._eval = eval_key;
+    prp_key[i]._fprint = NULL;
+  }
+  return true;
+}
+
+/* count objects allocated in the heap for a tag-and-key list */
+long count(ZTK *ztk)
+{
+  ZTKTagFieldListCell *tp;
+  ZTKKeyFieldListCell *kp;
+  long n = 0;
+
+  zListForEach( &ztk->tflist, tp ){
+    n++;
+    zListForEach( &tp->data.kflist, kp ) /* a cell, an array of offsets and a buffer of values */
+      n += ZTKValListSize( &kp->data.vallist ) > 0 ? 3 : 1;
+  }
+  return n;
+}
+
+int arena_blocknum(ZTK *ztk)
+{
+  zArenaBlock *block;
+  int n = 0;
+
+  if( ztk->arena )
+    for( block=ztk->arena->block; block; block=block->prev ) n++;
+  return n;
+}
+
+/* measure the best time of each process out of trials */
+void measure(const char *name, shape_t *shape, long size, bool arena)
+{
+  ZTK ztk;
+  ZTKPrp prp_tag[] = { { "tag", -1, eval_tag, NULL } };
+  FILE *fp;
+  char filename[BUFSIZ];
+  clock_t c;
+  double t, t_parse = HUGE_VAL, t_eval = HUGE_VAL, t_print = HUGE_VAL, t_destroy = HUGE_VAL, sum = 0;
+  long printsize = 0, objnum = 0;
+  int i, blocknum = 0;
+
+  sprintf( filename, BENCH_FILE, 0 );
+  if( !( fp = tmpfile() ) ){
+    ZOPENERROR( "tmpfile" );
+    return;
+  }
+  for( i=0; i<BENCH_TRIAL; i++ ){
+    ZTKInit( &ztk );
+    if( arena ) ZTKEnableArena( &ztk, 0 );
+    c = clock();
+    ZTKParse( &ztk, filename );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_parse ) t_parse = t;
+    sum = 0;
+    c = clock();
+    ZTKEvalTag( &sum, &shape->keynum, &ztk, prp_tag, 1 );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_eval ) t_eval = t;
+    rewind( fp );
+    c = clock();
+    ZTKFPrint( fp, &ztk );
+    fflush( fp );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_print ) t_print = t;
+    printsize = ftell( fp );
+    blocknum = arena_blocknum( &ztk );
+    objnum = count( &ztk );
+    c = clock();
+    ZTKDestroy( &ztk );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_destroy ) t_destroy = t;
+  }
+  fclose( fp );
+  printf( "[%s]\n", name );
+  printf( "ZTKParse        : %g sec. (%g MB/s)\n", t_parse, size / t_parse * 1.0e-6 );
+  printf( "ZTKEvalTag      : %g sec. (%g MB/s, checksum=%g)\n", t_eval, size / t_eval * 1.0e-6, sum );
+  printf( "ZTKFPrint       : %g sec. (%g MB/s)\n", t_print, printsize / t_print * 1.0e-6 );
+  printf( "ZTKDestroy      : %g sec.\n", t_destroy );
+  if( arena )
+    printf( "allocations     : %d arena blocks\n", blocknum );
+  else
+    printf( "allocations     : %ld objects\n", objnum );
+}
+
+int main(int argc, char *argv[])
+{
+  shape_t shape;
+  long size;
+
+  shape.tagnum = argc > 1 ? atoi( argv[1] ) : 10000;
+  shape.keynum = argc > 2 ? atoi( argv[2] ) : 8;
+  shape.valnum = argc > 3 ? atoi( argv[3] ) : 12;
+  shape.depth  = argc > 4 ? atoi( argv[4] ) : 4;
+  if( shape.tagnum < 0 || shape.keynum <= 0 || shape.valnum < 0 || shape.depth < 0 ){
+    fprintf( stderr, "usage: %s [tags] [keys per tag] [values per key] [depth of includes]\n", argv[0] );
+    return EXIT_FAILURE;
+  }
+  if( !prp_key_create( shape.keynum ) || ( size = generate( &shape ) ) < 0 ) return EXIT_FAILURE;
+  printf( "tag fields      : %d (%d keys x %d values each, %d nested files)\n", shape.tagnum, shape.keynum, shape.valnum, shape.depth + 1 );
+  printf( "file size       : %g MB\n", size * 1.0e-6 );
+  measure( "heap", &shape, size, false );
+  measure( "arena", &shape, size, true );
+  cleanup( &shape );
+  free( prp_key );
+  free( prp_key_str );
+  return 0;
+}
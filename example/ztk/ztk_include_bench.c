@@ -0,0 +1,116 @@
+/* benchmark of ZTK parsers: serial vs. concurrent parsing of included files vs. the shared cache of included files */
+#include <zeda/zeda_ztk.h>
+
+#define BENCH_FILE "ztk_include_bench.ztk"
+#define BENCH_INC_FILE "ztk_include_bench_%d.ztk"
+
+/* generate a synthetic ZTK file which includes many files */
+bool generate(int filenum, int tagnum)
+{
+  FILE *fp, *fp_inc;
+  char filename[BUFSIZ];
+  int i, j;
+
+  if( !( fp = fopen( BENCH_FILE, "w" ) ) ){
+    ZOPENERROR( BENCH_FILE );
+    return false;
+  }
+  for( i=0; i<filenum; i++ ){
+    sprintf( filename, BENCH_INC_FILE, i );
+    fprintf( fp, "[file]\nid: %d\ninclude %s\n", i, filename );
+    if( !( fp_inc = fopen( filename, "w" ) ) ){
+      ZOPENERROR( filename );
+      fclose( fp );
+      return false;
+    }
+    for( j=0; j<tagnum; j++ )
+      fprintf( fp_inc, "[link]\nname: link#%d_%d\nmass: %g\nframe: { 1, 0, 0, %g, 0, 1, 0, %g, 0, 0, 1, %g }\n", i, j, 0.1 * j, 0.1 * i, 0.2 * j, 0.3 );
+    fclose( fp_inc );
+  }
+  fclose( fp );
+  return true;
+}
+
+/* remove generated files */
+void cleanup(int filenum)
+{
+  char filename[BUFSIZ];
+  int i;
+
+  for( i=0; i<filenum; i++ ){
+    sprintf( filename, BENCH_INC_FILE, i );
+    remove( filename );
+  }
+  remove( BENCH_FILE );
+}
+
+/* compare two parsed trees by their printed images */
+bool compare(ZTK *ztk1, ZTK *ztk2)
+{
+  FILE *fp1, *fp2;
+  int c1, c2;
+  bool ret = true;
+
+  fp1 = tmpfile();
+  fp2 = tmpfile();
+  ZTKFPrint( fp1, ztk1 ); rewind( fp1 );
+  ZTKFPrint( fp2, ztk2 ); rewind( fp2 );
+  do{
+    c1 = fgetc( fp1 );
+    c2 = fgetc( fp2 );
+    if( c1 != c2 ){
+      ret = false;
+      break;
+    }
+  } while( c1 != EOF );
+  fclose( fp1 );
+  fclose( fp2 );
+  return ret;
+}
+
+/* measure wall-clock and CPU time to parse a file */
+void measure(ZTK *ztk, int threadnum, bool inccache)
+{
+  time_t t;
+  clock_t c;
+  int n;
+
+  ZTKInit( ztk );
+  ZTKEnableConcurrentInclude( ztk, threadnum );
+  if( inccache ) ZTKEnableIncludeCache( ztk );
+  c = clock();
+  /* repeat parsing for two seconds at least, since time() has a resolution of a second */
+  for( t=time(NULL), n=1; ; n++ ){
+    ZTKParse( ztk, BENCH_FILE );
+    if( time(NULL) - t >= 2 ) break;
+    ZTKDestroy( ztk );
+  }
+  printf( "threads=%-2d%-6s: %g sec. (wall-clock), %g sec. (CPU) per parsing\n", threadnum, inccache ? "+cache" : "",
+    (double)( time(NULL) - t ) / n, (double)( clock() - c ) / CLOCKS_PER_SEC / n );
+}
+
+int main(int argc, char *argv[])
+{
+  ZTK ztk_serial, ztk_concurrent, ztk_cached, ztk_holder;
+  int filenum, tagnum, threadnum;
+
+  filenum = argc > 1 ? atoi( argv[1] ) : 64;
+  tagnum = argc > 2 ? atoi( argv[2] ) : 2000;
+  threadnum = argc > 3 ? atoi( argv[3] ) : 4;
+  if( !generate( filenum, tagnum ) ) return EXIT_FAILURE;
+  printf( "included files  : %d (%d tag fields each)\n", filenum, tagnum );
+  measure( &ztk_serial, 0, false );
+  measure( &ztk_concurrent, threadnum, false );
+  /* another processor keeps the included files in the cache */
+  ZTKInit( &ztk_holder );
+  ZTKEnableIncludeCache( &ztk_holder );
+  ZTKParse( &ztk_holder, BENCH_FILE );
+  measure( &ztk_cached, 0, true );
+  printf( "identical trees : %s\n", zBoolStr( compare( &ztk_serial, &ztk_concurrent ) && compare( &ztk_serial, &ztk_cached ) ) );
+  ZTKDestroy( &ztk_serial );
+  ZTKDestroy( &ztk_concurrent );
+  ZTKDestroy( &ztk_cached );
+  ZTKDestroy( &ztk_holder );
+  cleanup( filenum );
+  return 0;
+}
@@ -0,0 +1,88 @@
+/* benchmark of retrieval of numeric values: one-by-one conversion vs. blocks of numeric values */
+#include <zeda/zeda_ztk.h>
+
+#define VAL_NUM 1000
+
+/* build a synthetic text of long numeric lists */
+char *generate(int tagnum)
+{
+  char *text, *cp;
+  int i, j;
+
+  if( !( text = zAlloc( char, (size_t)tagnum * ( VAL_NUM * 16 + 32 ) ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  for( cp=text, i=0; i<tagnum; i++ ){
+    cp += sprintf( cp, "[data]\nval: " );
+    for( j=0; j<VAL_NUM; j++ )
+      cp += sprintf( cp, "%.10g ", 0.001 * ( i * VAL_NUM + j ) );
+    cp += sprintf( cp, "\n" );
+  }
+  return text;
+}
+
+/* measure time to parse a text */
+double parse(ZTK *ztk, const char *text, bool numblock)
+{
+  clock_t c;
+
+  ZTKInit( ztk );
+  if( numblock ) ZTKEnableNumBlock( ztk );
+  c = clock();
+  ZTKParseMem( ztk, text, strlen(text) );
+  return (double)( clock() - c ) / CLOCKS_PER_SEC;
+}
+
+/* measure time to retrieve all values by ZTKDouble() */
+double retrieve_each(ZTK *ztk, double *val, double *sum)
+{
+  clock_t c;
+  int i;
+
+  *sum = 0;
+  c = clock();
+  for( ZTKRewind( ztk ); ZTKTagPtr(ztk); ZTKTagNext( ztk ) ){
+    for( i=0; i<VAL_NUM; i++ ) val[i] = ZTKDouble( ztk );
+    *sum += val[VAL_NUM-1];
+  }
+  return (double)( clock() - c ) / CLOCKS_PER_SEC;
+}
+
+/* measure time to retrieve all values by ZTKDoubleN() */
+double retrieve_bulk(ZTK *ztk, double *val, double *sum)
+{
+  clock_t c;
+
+  *sum = 0;
+  c = clock();
+  for( ZTKRewind( ztk ); ZTKTagPtr(ztk); ZTKTagNext( ztk ) ){
+    ZTKDoubleN( ztk, val, VAL_NUM );
+    *sum += val[VAL_NUM-1];
+  }
+  return (double)( clock() - c ) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+  ZTK ztk_str, ztk_num;
+  char *text;
+  double val[VAL_NUM], t_parse_str, t_parse_num, t_each, t_bulk, sum_each, sum_bulk;
+  int tagnum;
+
+  tagnum = argc > 1 ? atoi( argv[1] ) : 200;
+  if( !( text = generate( tagnum ) ) ) return EXIT_FAILURE;
+  t_parse_str = parse( &ztk_str, text, false );
+  t_parse_num = parse( &ztk_num, text, true );
+  t_each = retrieve_each( &ztk_str, val, &sum_each );
+  t_bulk = retrieve_bulk( &ztk_num, val, &sum_bulk );
+  printf( "values          : %d x %d\n", tagnum, VAL_NUM );
+  printf( "ZTKParseMem     : %g sec. (strings), %g sec. (numeric blocks)\n", t_parse_str, t_parse_num );
+  printf( "ZTKDouble       : %g sec.\n", t_each );
+  printf( "ZTKDoubleN      : %g sec.\n", t_bulk );
+  printf( "identical result: %s\n", zBoolStr( sum_each == sum_bulk ) );
+  ZTKDestroy( &ztk_str );
+  ZTKDestroy( &ztk_num );
+  free( text );
+  return 0;
+}
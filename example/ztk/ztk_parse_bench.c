@@ -0,0 +1,133 @@
+/* benchmark of ZTK parsers: stream scanning vs. in-memory scanning (with/without a memory arena) vs. binary cache */
+#include <zeda/zeda_ztk.h>
+#include <math.h>
+
+#define BENCH_FILE "ztk_parse_bench.ztk"
+
+/* generate a synthetic ZTK file */
+bool generate(const char *filename, int tagnum)
+{
+  FILE *fp;
+  int i, j;
+
+  if( !( fp = fopen( filename, "w" ) ) ){
+    ZOPENERROR( filename );
+    return false;
+  }
+  for( i=0; i<tagnum; i++ ){
+    fprintf( fp, "%% tag field #%d\n", i );
+    fprintf( fp, "[link]\n" );
+    fprintf( fp, "name: link#%d\n", i );
+    fprintf( fp, "jointtype: revolute\n" );
+    fprintf( fp, "mass: %g\n", 0.1 * i );
+    fprintf( fp, "frame: {\n" );
+    for( j=0; j<3; j++ )
+      fprintf( fp, " %g, %g, %g, %g\n", 1.0*j, 0.5*i, -0.25*j, 0.125*i );
+    fprintf( fp, "}\n" );
+    fprintf( fp, "parent: link#%d\n\n", i > 0 ? i - 1 : 0 );
+  }
+  fclose( fp );
+  return true;
+}
+
+/* parse a file by stream scanning */
+bool parse_fp(ZTK *ztk, const char *filename)
+{
+  FILE *fp;
+  bool ret;
+
+  if( !( fp = fopen( filename, "r" ) ) ){
+    ZOPENERROR( filename );
+    return false;
+  }
+  ret = ZTKParseFP( ztk, fp );
+  fclose( fp );
+  return ret;
+}
+
+/* compare two parsed trees by their printed images */
+bool compare(ZTK *ztk1, ZTK *ztk2)
+{
+  FILE *fp1, *fp2;
+  int c1, c2;
+  bool ret = true;
+
+  fp1 = tmpfile();
+  fp2 = tmpfile();
+  ZTKFPrint( fp1, ztk1 ); rewind( fp1 );
+  ZTKFPrint( fp2, ztk2 ); rewind( fp2 );
+  do{
+    c1 = fgetc( fp1 );
+    c2 = fgetc( fp2 );
+    if( c1 != c2 ){
+      ret = false;
+      break;
+    }
+  } while( c1 != EOF );
+  fclose( fp1 );
+  fclose( fp2 );
+  return ret;
+}
+
+/* parse a file with a memory arena */
+bool parse_arena(ZTK *ztk, const char *filename)
+{
+  return ZTKEnableArena( ztk, 0 ) && ZTKParse( ztk, filename );
+}
+
+/* load the binary cache of a file with a memory arena */
+bool parse_cache(ZTK *ztk, const char *filename)
+{
+  char cachepath[BUFSIZ];
+
+  return ZTKEnableArena( ztk, 0 ) && ZTKReadCache( ztk, ZTKCachePath( filename, cachepath, BUFSIZ ) );
+}
+
+/* measure time to parse and destroy a file */
+void measure(const char *name, bool (* parse)(ZTK*,const char*), const char *filename, int trial)
+{
+  ZTK ztk;
+  clock_t c;
+  double t, t_parse = HUGE_VAL, t_destroy = HUGE_VAL;
+  int i;
+
+  for( i=0; i<trial; i++ ){
+    ZTKInit( &ztk );
+    c = clock();
+    parse( &ztk, filename );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_parse ) t_parse = t;
+    c = clock();
+    ZTKDestroy( &ztk );
+    if( ( t = (double)( clock() - c ) / CLOCKS_PER_SEC ) < t_destroy ) t_destroy = t;
+  }
+  printf( "%-16s: parse %g sec., destroy %g sec.\n", name, t_parse, t_destroy );
+}
+
+int main(int argc, char *argv[])
+{
+  ZTK ztk_fp, ztk_mem, ztk_cache;
+  char cachepath[BUFSIZ];
+  int tagnum;
+
+  tagnum = argc > 1 ? atoi( argv[1] ) : 100000;
+  if( !generate( BENCH_FILE, tagnum ) ) return EXIT_FAILURE;
+  printf( "tag fields      : %d\n", tagnum );
+  measure( "ZTKParseFP", parse_fp, BENCH_FILE, 5 );
+  measure( "ZTKParse (mem)", ZTKParse, BENCH_FILE, 5 );
+  measure( "ZTKParse (arena)", parse_arena, BENCH_FILE, 5 );
+  ZTKInit( &ztk_fp );
+  ZTKInit( &ztk_mem );
+  ZTKInit( &ztk_cache );
+  parse_fp( &ztk_fp, BENCH_FILE );
+  parse_arena( &ztk_mem, BENCH_FILE );
+  ZTKWriteCache( &ztk_mem, ZTKCachePath( BENCH_FILE, cachepath, BUFSIZ ) );
+  measure( "ZTKReadCache", parse_cache, BENCH_FILE, 5 );
+  parse_cache( &ztk_cache, BENCH_FILE );
+  printf( "identical trees : %s\n", zBoolStr( compare( &ztk_fp, &ztk_mem ) && compare( &ztk_fp, &ztk_cache ) ) );
+  ZTKDestroy( &ztk_fp );
+  ZTKDestroy( &ztk_mem );
+  ZTKDestroy( &ztk_cache );
+  remove( BENCH_FILE );
+  remove( cachepath );
+  return 0;
+}
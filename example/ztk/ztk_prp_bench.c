@@ -0,0 +1,89 @@
+/* benchmark of ZTK evaluators: linear search of properties (with/without interned strings) vs. a compiled table */
+#include <zeda/zeda_ztk.h>
+
+#define PRP_NUM 32
+
+void *eval_key(void *obj, int i, void *arg, ZTK *ztk)
+{
+  *(double *)obj += strlen( ZTKVal(ztk) );
+  return obj;
+}
+
+ZTKPrp prp_key[PRP_NUM], prp_key_interned[PRP_NUM];
+char prp_str[PRP_NUM][BUFSIZ];
+
+void *eval_tag_linear(void *obj, int i, void *arg, ZTK *ztk)
+{
+  return ZTKEvalKey( obj, NULL, ztk, prp_key, PRP_NUM );
+}
+
+void *eval_tag_interned(void *obj, int i, void *arg, ZTK *ztk)
+{
+  return ZTKEvalKey( obj, NULL, ztk, prp_key_interned, PRP_NUM );
+}
+
+void *eval_tag_table(void *obj, int i, void *arg, ZTK *ztk)
+{
+  return ZTKEvalKeyTable( obj, NULL, ztk, (ZTKPrpTable *)arg );
+}
+
+/* build a synthetic tag-and-key list */
+void generate(ZTK *ztk, int tagnum)
+{
+  int i, j;
+
+  for( i=0; i<tagnum; i++ ){
+    ZTKAddTag( ztk, "object" );
+    for( j=0; j<PRP_NUM; j++ ){
+      ZTKAddKey( ztk, prp_str[PRP_NUM-1-j] );
+      ZTKAddDouble( ztk, 0.5 * j );
+    }
+  }
+}
+
+/* measure time to evaluate a tag-and-key list */
+double measure(ZTK *ztk, ZTKPrp *prp_tag, ZTKPrpTable *table, double *val)
+{
+  clock_t c;
+
+  *val = 0;
+  c = clock();
+  ZTKEvalTag( val, table, ztk, prp_tag, 1 );
+  return (double)( clock() - c ) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+  ZTK ztk;
+  ZTKPrp prp_tag_linear[] = { { "object", -1, eval_tag_linear, NULL } };
+  ZTKPrp prp_tag_interned[] = { { "object", -1, eval_tag_interned, NULL } };
+  ZTKPrp prp_tag_table[] = { { "object", -1, eval_tag_table, NULL } };
+  ZTKPrpTable table;
+  double t_linear, t_interned, t_table, val_linear, val_interned, val_table;
+  int i, tagnum;
+
+  tagnum = argc > 1 ? atoi( argv[1] ) : 20000;
+  for( i=0; i<PRP_NUM; i++ ){
+    sprintf( prp_str[i], "property_%d", i );
+    prp_key[i].str = prp_str[i];
+    prp_key[i].num = 1;
+    prp_key[i]._eval = eval_key;
+    prp_key[i]._fprint = NULL;
+  }
+  ZTKInit( &ztk );
+  generate( &ztk, tagnum );
+  memcpy( prp_key_interned, prp_key, sizeof(prp_key) );
+  if( !ZTKPrpIntern( &ztk, prp_key_interned, PRP_NUM ) ) return EXIT_FAILURE;
+  if( !ZTKPrpTableCompile( &table, prp_key, PRP_NUM ) ) return EXIT_FAILURE;
+  t_linear = measure( &ztk, prp_tag_linear, NULL, &val_linear );
+  t_interned = measure( &ztk, prp_tag_interned, NULL, &val_interned );
+  t_table = measure( &ztk, prp_tag_table, &table, &val_table );
+  printf( "tag fields      : %d (%d keys each)\n", tagnum, PRP_NUM );
+  printf( "ZTKEvalKey      : %g sec.\n", t_linear );
+  printf( "ZTKEvalKey      : %g sec. (interned)\n", t_interned );
+  printf( "ZTKEvalKeyTable : %g sec.\n", t_table );
+  printf( "identical result: %s\n", zBoolStr( val_linear == val_interned && val_linear == val_table ) );
+  ZTKPrpTableDestroy( &table );
+  ZTKDestroy( &ztk );
+  return 0;
+}
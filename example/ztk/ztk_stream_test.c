@@ -0,0 +1,39 @@
+/* how to scan a ZTK file by a streaming parser without building a tag-and-key list */
+#include <zeda/zeda_ztk.h>
+
+typedef struct{
+  int tagnum, keynum, valnum;
+} count_t;
+
+bool on_tag(void *count, const char *tag, size_t len)
+{
+  printf( "tag  : %.*s\n", (int)len, tag );
+  ((count_t *)count)->tagnum++;
+  return true;
+}
+
+bool on_key(void *count, const char *key, size_t len)
+{
+  printf( " key : %.*s\n", (int)len, key );
+  ((count_t *)count)->keynum++;
+  return true;
+}
+
+bool on_val(void *count, const char *val, size_t len)
+{
+  printf( "  val: %.*s\n", (int)len, val );
+  ((count_t *)count)->valnum++;
+  return true;
+}
+
+int main(int argc, char *argv[])
+{
+  ZTKStream stream;
+  count_t count = { 0, 0, 0 };
+
+  ZTKStreamInit( &stream, on_tag, on_key, on_val, &count );
+  ZTKStreamParse( &stream, argc > 1 ? argv[1] : "test1.ztk" );
+  ZTKStreamDestroy( &stream );
+  printf( "%d tags, %d keys, %d values\n", count.tagnum, count.keynum, count.valnum );
+  return 0;
+}
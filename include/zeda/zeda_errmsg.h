@@ -44,6 +44,7 @@
 #define ZEDA_WARN_ZTK_NOT_TAGGED           "not in a tagged field, skipped."
 #define ZEDA_WARN_ZTK_DUPDEF               "duplicate entry of tag=%s, skipped."
 #define ZEDA_WARN_ZTK_UNKNOWN_VAL          "unknown value %s in the field of tag=%s key=%s"
+#define ZEDA_WARN_ZTK_CACHE_BROKEN         "%s: broken binary cache, ignored."
 
 #define ZEDA_WARN_UNKNOWNOPT               "unknown option: %s"
 
@@ -84,6 +85,9 @@
 
 #define ZEDA_ERR_ZTK_PRP_UNMODIFIABLE      "not permitted to modify the number of fields %s"
 #define ZEDA_ERR_ZTK_UNKNOWN_VAL           "unknown value %s in the field of tag=%s key=%s"
+#define ZEDA_ERR_ZTK_ARENA_NONEMPTY        "memory arena has to be enabled before any tag is added"
+#define ZEDA_ERR_ZTK_RELOAD_UNSPLICEABLE   "cannot reload tagged fields not parsed from a single file"
+#define ZEDA_ERR_ZTK_CACHE_UNREPLACEABLE   "%s: cannot replace the binary cache"
 
 #define ZEDA_ERR_FATAL                     "fatal error! - please report to the author"
 
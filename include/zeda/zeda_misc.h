@@ -148,6 +148,75 @@ __ZEDA_EXPORT void *zCloneMem(const void *src, size_t size);
 #define zClone(src,type,nmemb) (type *)zCloneMem( src, sizeof(type)*nmemb )
 #endif /* __KERNEL__ */
 
+#ifndef __KERNEL__
+/* ********************************************************** */
+/*! \struct zArena
+ * \brief memory arena.
+ *
+ * zArena class allocates a number of small memory spaces from a few
+ * large blocks by just bumping a pointer, and releases all of them
+ * at once when it is destroyed. Each memory space cannot be freed
+ * individually.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zArenaBlock ){
+  zArenaBlock *prev; /*!< the previous block */
+  size_t size;       /*!< size of the data area */
+  size_t used;       /*!< size of the used area */
+};
+
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zArena ){
+  zArenaBlock *block; /*!< the latest block */
+  size_t blocksize;   /*!< the default size of a block */
+};
+
+/*! \brief default size of a block of a memory arena. */
+#define ZARENA_DEFAULT_BLOCKSIZE ( BUFSIZ * 16 )
+
+/*! \brief initialize a memory arena.
+ *
+ * zArenaInit() initializes a memory arena \a arena. \a blocksize is the
+ * size of each block to be allocated. If zero is given for \a blocksize,
+ * ZARENA_DEFAULT_BLOCKSIZE is applied instead.
+ * \return
+ * zArenaInit() returns a pointer \a arena.
+ */
+__ZEDA_EXPORT zArena *zArenaInit(zArena *arena, size_t blocksize);
+
+/*! \brief allocate memory from a memory arena.
+ *
+ * zArenaAlloc() allocates a memory space with \a size bytes from a memory
+ * arena \a arena. The memory space is aligned in the same way with malloc(),
+ * and is cleared by zero. If the rest of the latest block is not enough,
+ * a new block is allocated.
+ *
+ * zArenaAllocType() allocates memory for \a nmemb data of a data type \a type
+ * from \a arena.
+ * \return
+ * zArenaAlloc() and zArenaAllocType() return a pointer to the allocated memory
+ * space. If they fail to allocate a new block, the null pointer is returned.
+ */
+__ZEDA_EXPORT void *zArenaAlloc(zArena *arena, size_t size);
+#define zArenaAllocType(arena,type,nmemb) (type *)zArenaAlloc( arena, sizeof(type)*(nmemb) )
+
+/*! \brief clone a string into a memory arena.
+ *
+ * zArenaStrCloneN() allocates memory for \a len charactors and the terminating
+ * null charactor from a memory arena \a arena, and copies the first \a len
+ * charactors of \a str there.
+ * \return
+ * zArenaStrCloneN() returns a pointer to the cloned string. If \a str is the
+ * null pointer or it fails to allocate memory, the null pointer is returned.
+ */
+__ZEDA_EXPORT char *zArenaStrCloneN(zArena *arena, const char *str, size_t len);
+
+/*! \brief destroy a memory arena.
+ *
+ * zArenaDestroy() frees all blocks of a memory arena \a arena at once.
+ * All memory spaces allocated from \a arena are invalidated.
+ */
+__ZEDA_EXPORT void zArenaDestroy(zArena *arena);
+#endif /* __KERNEL__ */
+
 /*! \} */
 
 /* ********************************************************** */
@@ -175,6 +244,41 @@ __ZEDA_EXPORT size_t zFileSize(FILE *fp);
 __ZEDA_EXPORT bool zFileIsIdent(FILE *fp1, FILE *fp2);
 #endif /* __KERNEL__ */
 
+/*! \struct zFileStamp
+ * \brief stamp of a file to detect modification of it.
+ *
+ * zFileStampGet() gets a stamp \a stamp of a file \a fp, which consists of the device ID,
+ * the inode number, the last modification time in seconds and nanoseconds and the size of
+ * the file.
+ * zFileStampGetPath() gets a stamp of a file named \a path.
+ *
+ * zFileStampIsEqual() checks if two stamps \a stamp1 and \a stamp2 are the same. Two stamps
+ * of a file are regarded different if the file is replaced or modified.
+ * zFileStampIsIdent() checks if two stamps \a stamp1 and \a stamp2 are of the identical file
+ * in the same way with zFileIsIdent().
+ * \return
+ * zFileStampGet() and zFileStampGetPath() return the true value if they succeed to get the
+ * stamp. Otherwise, the false value is returned.
+ * \notes
+ * The nanoseconds of the modification time are available on POSIX.1-2008 systems, and are
+ * zero otherwise. Then, modifications of a file within a second are detected only when the
+ * size of the file changes. The actual resolution depends on the file system.
+ */
+#ifndef __KERNEL__
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zFileStamp ){
+  ulong dev;        /*!< device ID */
+  ulong ino;        /*!< inode number */
+  ulong mtime;      /*!< last modification time */
+  ulong mtime_nsec; /*!< nanoseconds of the last modification time */
+  ulong size;       /*!< size of the file */
+};
+
+__ZEDA_EXPORT bool zFileStampGet(FILE *fp, zFileStamp *stamp);
+__ZEDA_EXPORT bool zFileStampGetPath(const char *path, zFileStamp *stamp);
+#define zFileStampIsEqual(stamp1,stamp2) ( (stamp1)->dev == (stamp2)->dev && (stamp1)->ino == (stamp2)->ino && (stamp1)->mtime == (stamp2)->mtime && (stamp1)->mtime_nsec == (stamp2)->mtime_nsec && (stamp1)->size == (stamp2)->size )
+#define zFileStampIsIdent(stamp1,stamp2) ( (stamp1)->dev == (stamp2)->dev && (stamp1)->ino == (stamp2)->ino )
+#endif /* __KERNEL__ */
+
 /*! \brief compare two files.
  *
  * zFileSize() compares two files \a filename1 and \a filename2.
@@ -279,7 +383,9 @@ __ZEDA_EXPORT char *zI2A(int val, char *buf);
  *
  * zF2A() converts a double-precision floating point
  * value \a val to an ASCII string and copies it to an
- * array pointed by \a buf.
+ * array pointed by \a buf. The string is the shortest
+ * one that is read back to exactly \a val (see
+ * zNumFormatDouble()).
  * \return a pointer \a buf.
  * \note
  * zI2A() does not check the size of \a buf.
@@ -0,0 +1,86 @@
+/* ZEDA - Elementary Data and Algorithms
+ * Copyright (C) 1998 Tomomichi Sugihara (Zhidao)
+ */
+/*! \file zeda_number.h
+ * \brief conversion between numbers and strings.
+ * \author Zhidao
+ */
+
+#ifndef __ZEDA_NUMBER_H__
+#define __ZEDA_NUMBER_H__
+
+/*! conversion of floating-point numbers is not available in the kernel space */
+#ifndef __KERNEL__
+
+#include <zeda/zeda_misc.h>
+
+__BEGIN_DECLS
+
+/* ********************************************************** */
+/*! \defgroup number_parse parse numbers in strings.
+ * \{ *//* ************************************************** */
+
+/*! \brief parse a number in a string.
+ *
+ * zNumParseInt() parses an integer number in the first \a len bytes of a string \a str
+ * in the same way with strtol() in base 10, and stores it where \a val points. If the
+ * number is out of the range of int, it is saturated to INT_MAX or INT_MIN.
+ *
+ * zNumParseDouble() parses a real number in the first \a len bytes of \a str in the same
+ * way with strtod(), and stores it where \a val points. A decimal number, a hexadecimal
+ * number with the prefix 0x, infinity (inf or infinity) and NaN (nan) are accepted.
+ * A decimal number is correctly rounded to the nearest double-precision floating-point
+ * value. It is converted by multiplication of an exact power of ten if possible, and
+ * otherwise by Eisel-Lemire algorithm with a 128-bit approximation of a power of five.
+ * Only a few rare cases such as numbers with more than 19 significant digits ambiguously
+ * rounded and subnormal numbers fall back on strtod().
+ *
+ * Both functions skip leading white spaces, and do not refer to charactors beyond \a len
+ * bytes, so that \a str does not have to be terminated by the null charactor. Unlike
+ * strtol() and strtod(), they do not depend on the current locale; the decimal point
+ * is always '.'.
+ * \return
+ * zNumParseInt() and zNumParseDouble() return the number of bytes consumed. If no number
+ * is found, zero is returned, and zero is stored where \a val points.
+ */
+__ZEDA_EXPORT size_t zNumParseInt(const char *str, size_t len, int *val);
+__ZEDA_EXPORT size_t zNumParseDouble(const char *str, size_t len, double *val);
+
+/*! \} */
+
+/* ********************************************************** */
+/*! \defgroup number_format format numbers to strings.
+ * \{ *//* ************************************************** */
+
+/*! \brief sizes of buffers enough to store a formatted number with the null charactor. */
+#define ZEDA_NUM_INT_BUFSIZ    12
+#define ZEDA_NUM_DOUBLE_BUFSIZ 25
+
+/*! \brief format a number to a string.
+ *
+ * zNumFormatInt() formats an integer number \a val in decimal digits, and stores it in a buffer
+ * \a buf terminated by the null charactor.
+ *
+ * zNumFormatDouble() formats a double-precision floating-point value \a val to the shortest
+ * decimal digits that are read back to exactly the same value by zNumParseDouble() or strtod(),
+ * which are found by Ryu algorithm. The digits are stored in \a buf in the same notation with
+ * \"%g\" format of printf(), namely, in the exponential notation as 1.25e-05 or 1e+20 if the
+ * exponent is less than -4 or not less than 17, and otherwise in the fixed-point notation as
+ * 0.1 or 12500. Infinity and NaN are formatted as inf, -inf and nan.
+ *
+ * Both functions do not depend on the current locale; the decimal point is always '.'.
+ * \a buf has to have ZEDA_NUM_INT_BUFSIZ and ZEDA_NUM_DOUBLE_BUFSIZ bytes at least,
+ * respectively.
+ * \return
+ * zNumFormatInt() and zNumFormatDouble() return the length of the formatted string.
+ */
+__ZEDA_EXPORT size_t zNumFormatInt(int val, char *buf);
+__ZEDA_EXPORT size_t zNumFormatDouble(double val, char *buf);
+
+/*! \} */
+
+__END_DECLS
+
+#endif /* __KERNEL__ */
+
+#endif /* __ZEDA_NUMBER_H__ */
@@ -0,0 +1,182 @@
+/* ZEDA - Elementary Data and Algorithms
+ * Copyright (C) 1998 Tomomichi Sugihara (Zhidao)
+ */
+/*! \file zeda_scanner.h
+ * \brief buffered scanner of texts.
+ * \author Zhidao
+ */
+
+#ifndef __ZEDA_SCANNER_H__
+#define __ZEDA_SCANNER_H__
+
+/*! buffered scanner is not available in the kernel space */
+#ifndef __KERNEL__
+
+#include <zeda/zeda_string.h>
+
+__BEGIN_DECLS
+
+/*! \brief default size of the internal buffer of a scanner. */
+#define ZEDA_SCANNER_BUFSIZ 0x10000
+
+/* ********************************************************** */
+/*! \struct zScanner
+ * \brief buffered scanner of texts.
+ *
+ * zScanner scans texts in a memory buffer, a file mapped onto memory, or a file stream
+ * read through an internal buffer. Any number of charactors ahead of the current position
+ * can be looked up, and tokens are given as slices of the buffer without being copied.
+ * The null charactor is regarded as the end of texts in tokenizing functions.
+ *
+ * Tokens are delimited according to a configuration of tokenizers \a config, which is the
+ * current one of the thread at initialization (see zTokenizerConfigSelect()), and can be
+ * replaced by zScannerSetTokenizer().
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zScanner ){
+  const char *cur; /*!< current position */
+  const char *end; /*!< end of the buffered texts */
+  const char *tkn; /*!< head of the last token */
+  size_t tknlen;   /*!< length of the last token */
+  const zTokenizerConfig *config; /*!< configuration of tokenizers */
+  /*! \cond */
+  const char *_mark; /* head of the last token, which is kept in the buffer at refilling */
+  char *_buf;        /* internal buffer for a file stream */
+  size_t _size;      /* size of the internal buffer */
+  FILE *_fp;         /* file stream to be read */
+  void *_map;        /* image of a file mapped onto memory */
+  size_t _mapsize;   /* size of the mapped image */
+  /*! \endcond */
+};
+
+/*! \brief initialize and destroy a scanner.
+ *
+ * zScannerInitMem() initializes a scanner \a scanner to scan \a len bytes of a buffer \a buf.
+ * The buffer does not have to be terminated by the null charactor.
+ *
+ * zScannerInitFP() initializes \a scanner to scan a file stream \a fp through an internal
+ * buffer of \a size bytes. If \a size is zero, ZEDA_SCANNER_BUFSIZ is applied. The buffer is
+ * enlarged only if a token longer than it is scanned.
+ *
+ * zScannerMapFP() maps the whole file of \a fp onto memory and initializes \a scanner to scan
+ * it from the current position of \a fp. If \a fp is not a regular file or the file cannot be
+ * mapped, it works in the same way with zScannerInitFP() with the default buffer size.
+ *
+ * zScannerDestroy() destroys \a scanner. If \a scanner scans a file stream, the position of the
+ * stream is set for the charactor next to the last one scanned, so that the following texts
+ * can be read from the stream. Note that it is not possible for a stream that cannot seek.
+ * \return
+ * zScannerInitMem() and zScannerMapFP() return a pointer \a scanner. zScannerInitFP() returns
+ * the null pointer if it fails to allocate the internal buffer. Otherwise, \a scanner is returned.
+ */
+__ZEDA_EXPORT zScanner *zScannerInitMem(zScanner *scanner, const char *buf, size_t len);
+__ZEDA_EXPORT zScanner *zScannerInitFP(zScanner *scanner, FILE *fp, size_t size);
+__ZEDA_EXPORT zScanner *zScannerMapFP(zScanner *scanner, FILE *fp);
+__ZEDA_EXPORT void zScannerDestroy(zScanner *scanner);
+
+/*! \brief specify a configuration of tokenizers of a scanner.
+ *
+ * zScannerSetTokenizer() makes a scanner \a scanner refer to a configuration of tokenizers
+ * \a config, which has to be kept until \a scanner is destroyed.
+ */
+#define zScannerSetTokenizer(scanner,c) ( (scanner)->config = (c) )
+
+/*! \brief look ahead texts of a scanner.
+ *
+ * zScannerFill() reads texts of the file stream of a scanner \a scanner into its buffer until
+ * \a n bytes are stored after the current position.
+ *
+ * zScannerPeek() looks up the charactor \a n bytes ahead of the current position of \a scanner
+ * without moving the position.
+ *
+ * zScannerIsEnd() checks if \a scanner reached the end of texts or the null charactor.
+ * \return
+ * zScannerFill() returns the false value if less than \a n bytes remain in the texts.
+ * Otherwise, the true value is returned.
+ *
+ * zScannerPeek() returns the charactor as an unsigned char casted to an int, or EOF if the
+ * texts end before it.
+ */
+__ZEDA_EXPORT bool zScannerFill(zScanner *scanner, size_t n);
+__ZEDA_EXPORT int zScannerPeek(zScanner *scanner, size_t n);
+#define zScannerIsEnd(scanner) ( ( (scanner)->cur >= (scanner)->end && !zScannerFill( scanner, 1 ) ) || *(scanner)->cur == '\0' )
+
+/*! \brief clear the last token of a scanner.
+ *
+ * zScannerClearToken() discards the last token of a scanner \a scanner, so that the buffer is
+ * refilled without keeping it. It is necessary to read texts through \a scanner->cur and
+ * zScannerFill() after scanning tokens.
+ */
+__ZEDA_EXPORT void zScannerClearToken(zScanner *scanner);
+
+/*! \brief skip delimiters and comments in texts of a scanner.
+ *
+ * zScanSkipDelimiter() skips delimiters (see zTokenizerConfigSetDelimiter()) from the current position of
+ * a scanner \a scanner.
+ *
+ * zScanSkipComment() skips delimiters and comment lines that begin with the comment identifier
+ * (see zSetCommentIdent()).
+ * \return
+ * These functions return the next charactor as an unsigned char casted to an int, or EOF if
+ * \a scanner reached the end of texts.
+ */
+__ZEDA_EXPORT int zScanSkipDelimiter(zScanner *scanner);
+__ZEDA_EXPORT int zScanSkipComment(zScanner *scanner);
+
+/*! \brief check if the last token scanned by a scanner is a key.
+ *
+ * zScanPostCheckKey() skips delimiters after the last token of a scanner \a scanner, and checks
+ * if the key identifier (see zSetKeyIdent()) follows. If so, the identifier is also skipped.
+ * \return
+ * zScanPostCheckKey() returns the true value if the last token is a key. Otherwise, the false
+ * value is returned.
+ */
+__ZEDA_EXPORT bool zScanPostCheckKey(zScanner *scanner);
+
+/*! \brief get a token from texts of a scanner.
+ *
+ * zScanToken() skips delimiters and comments of a scanner \a scanner, and gets the next token
+ * as a slice of the buffer of \a scanner, whose head and length are stored in \a scanner->tkn
+ * and \a scanner->tknlen, respectively. The token is not terminated by the null charactor.
+ * A string quoted by \" or \' is regarded as a token without the quotation marks, and a string
+ * fenced by the tag identifiers (see zSetTagIdent()) is regarded as a token with the identifiers.
+ *
+ * zScanIntToken() gets a token that represents an integer number, and zScanNumToken() gets a
+ * token that represents a real number in the same way with zFIntToken() and zFNumToken(),
+ * respectively. They do not skip delimiters, and look ahead texts to check if a number
+ * continues without moving the current position backward.
+ *
+ * zScanTokenCopy() gets a token in the same way with zScanToken(), and copies it to a buffer
+ * \a tkn of \a size bytes, which is terminated by the null charactor.
+ *
+ * The slice is available until the next token is scanned, or zScanSkipDelimiter() or
+ * zScanSkipComment() is called. zScanPostCheckKey() keeps it, while the buffer might be moved
+ * to read the following texts; \a scanner->tkn has to be referred after it.
+ * \return
+ * zScanToken() returns the false value if \a scanner reaches the end of texts before any token.
+ * zScanIntToken() and zScanNumToken() return the false value if no number is found.
+ * Otherwise, the true value is returned.
+ *
+ * zScanTokenCopy() returns a pointer \a tkn, or the null pointer if no token is found.
+ */
+__ZEDA_EXPORT bool zScanToken(zScanner *scanner);
+__ZEDA_EXPORT bool zScanIntToken(zScanner *scanner);
+__ZEDA_EXPORT bool zScanNumToken(zScanner *scanner);
+__ZEDA_EXPORT char *zScanTokenCopy(zScanner *scanner, char *tkn, size_t size);
+
+/*! \brief get a number from texts of a scanner.
+ *
+ * zScanInt() and zScanDouble() get the next token of a scanner \a scanner, and convert it to
+ * an integer value and a double-precision floating-point value, respectively. The value is
+ * stored where \a val points.
+ * \return
+ * These functions return the false value if no token is found. Otherwise, the true value is
+ * returned.
+ */
+__ZEDA_EXPORT bool zScanInt(zScanner *scanner, int *val);
+__ZEDA_EXPORT bool zScanDouble(zScanner *scanner, double *val);
+
+__END_DECLS
+
+#endif /* __KERNEL__ */
+
+#endif /* __ZEDA_SCANNER_H__ */
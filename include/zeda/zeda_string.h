@@ -10,6 +10,7 @@
 #define __ZEDA_STRING_H__
 
 #include <zeda/zeda_misc.h>
+#include <zeda/zeda_number.h>
 
 __BEGIN_DECLS
 
@@ -52,6 +53,33 @@ __ZEDA_EXPORT char *zStrCopy(char *dest, const char *src, size_t size);
  */
 __ZEDA_EXPORT char *zStrClone(const char *str);
 
+/*! \brief clone a part of a string.
+ *
+ * zStrCloneN() allocates memory for \a len charactors and the
+ * terminating null charactor, and copies the first \a len
+ * charactors of \a str there. \a str does not have to be
+ * terminated by the null charactor.
+ * \return
+ * a pointer to the memory allocated.
+ * When it fails to allocate memory or \a str is the null pointer,
+ * the null pointer is returned.
+ */
+__ZEDA_EXPORT char *zStrCloneN(const char *str, size_t len);
+
+/*! \brief hash value of a string.
+ *
+ * zStrHash() computes a hash value of a string \a str based on FNV-1a
+ * algorithm.
+ * zStrHashN() computes the hash value of the first \a len charactors
+ * of \a str, which does not have to be terminated by the null charactor.
+ * \return
+ * zStrHash() and zStrHashN() return the hash value of \a str.
+ * zStrHashN() returns the same value with zStrHash() for a string of
+ * length \a len.
+ */
+__ZEDA_EXPORT ulong zStrHash(const char *str);
+__ZEDA_EXPORT ulong zStrHashN(const char *str, size_t len);
+
 /*! \brief concatenate a string to another.
  *
  * zStrCat() concatenates a string \a src to another \a dest.
@@ -217,6 +245,105 @@ __ZEDA_EXPORT char *zStrToLower(const char *src, size_t size, char *dest);
 /*! \defgroup token tokenization.
  * \{ *//* ************************************************** */
 
+/*! \brief classes of charactors for tokenization. */
+#define ZEDA_CHAR_DELIMITER 0x1
+#define ZEDA_CHAR_OPERATOR  0x2
+#define ZEDA_CHAR_COMMENT   0x4
+
+/*! \brief maximum number of delimiters to be vectorized. */
+#define ZEDA_DELIMITER_VEC_MAX 16
+
+/* ********************************************************** */
+/*! \struct zTokenizerConfig
+ * \brief configuration of tokenizers.
+ *
+ * zTokenizerConfig holds a delimiter set, an operator set, the comment
+ * identifier, the tag identifiers and the key identifier which the
+ * tokenizers refer to, and a table of classes of charactors built
+ * from them.
+ *
+ * Each thread refers to its own current configuration, which is the
+ * default configuration shared by all threads unless another one is
+ * selected by zTokenizerConfigSelect(). zSetDelimiter(), zSetOperator(),
+ * zSetCommentIdent(), zSetTagIdent() and zSetKeyIdent() modify the
+ * current configuration of the calling thread. Hence, threads that
+ * tokenize texts in different formats at once have to select their
+ * own configurations in advance.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zTokenizerConfig ){
+  ubyte char_class[0x100]; /*!< table of classes of charactors */
+  /*! \cond */
+  ubyte delimiter_vec[ZEDA_DELIMITER_VEC_MAX][32]; /* delimiters broadcasted to vectors */
+  int delimiter_vec_num;   /* -1 if too many delimiters to be vectorized */
+  /*! \endcond */
+  const char *delimiter;   /*!< delimiter set */
+  const char *operators;   /*!< operator set */
+  char comment_ident;      /*!< comment identifier */
+  char tag_begin_ident;    /*!< beginning identifier of tags */
+  char tag_end_ident;      /*!< ending identifier of tags */
+  char key_ident;          /*!< key identifier */
+};
+
+/*! \brief initialize a configuration of tokenizers.
+ *
+ * zTokenizerConfigInit() initializes a configuration of tokenizers
+ * \a config with the default delimiter set, operator set and
+ * identifiers (see zResetDelimiter(), zResetOperator(),
+ * zResetCommentIdent(), zResetTagIdent() and zResetKeyIdent()).
+ * \return
+ * zTokenizerConfigInit() returns a pointer \a config.
+ */
+__ZEDA_EXPORT zTokenizerConfig *zTokenizerConfigInit(zTokenizerConfig *config);
+
+/*! \brief modify a configuration of tokenizers.
+ *
+ * zTokenizerConfigSetDelimiter(), zTokenizerConfigSetOperator(),
+ * zTokenizerConfigSetCommentIdent(), zTokenizerConfigSetTagIdent()
+ * and zTokenizerConfigSetKeyIdent() are the same with zSetDelimiter(),
+ * zSetOperator(), zSetCommentIdent(), zSetTagIdent() and zSetKeyIdent(),
+ * respectively, except that they modify a configuration \a config.
+ * \note
+ * The delimiter set and the operator set are not copied, but referred
+ * by \a config.
+ */
+__ZEDA_EXPORT void zTokenizerConfigSetDelimiter(zTokenizerConfig *config, const char s[]);
+__ZEDA_EXPORT void zTokenizerConfigSetOperator(zTokenizerConfig *config, const char s[]);
+__ZEDA_EXPORT void zTokenizerConfigSetCommentIdent(zTokenizerConfig *config, char ident);
+__ZEDA_EXPORT void zTokenizerConfigSetTagIdent(zTokenizerConfig *config, char begin_ident, char end_ident);
+__ZEDA_EXPORT void zTokenizerConfigSetKeyIdent(zTokenizerConfig *config, char ident);
+
+/*! \brief select the current configuration of tokenizers.
+ *
+ * zTokenizerConfigSelect() selects a configuration \a config as the
+ * current configuration of the calling thread. If \a config is the
+ * null pointer, the default configuration is selected.
+ *
+ * zTokenizerConfigCurrent() returns the current configuration of the
+ * calling thread.
+ *
+ * The current configuration is held thread-locally if the compiler
+ * supports thread-local storage. Otherwise, it is shared by all threads.
+ * \return
+ * zTokenizerConfigSelect() returns a pointer to the configuration
+ * selected previously, which is to be passed to zTokenizerConfigSelect()
+ * again to restore it.
+ * zTokenizerConfigCurrent() returns a pointer to the current configuration.
+ */
+__ZEDA_EXPORT zTokenizerConfig *zTokenizerConfigSelect(zTokenizerConfig *config);
+__ZEDA_EXPORT zTokenizerConfig *zTokenizerConfigCurrent(void);
+
+/*! \brief classes of a charactor in a configuration of tokenizers.
+ *
+ * zTokenizerCharClass() is a bitmap of classes of a charactor \a c
+ * in a configuration \a config, which is a combination of
+ * ZEDA_CHAR_DELIMITER, ZEDA_CHAR_OPERATOR and ZEDA_CHAR_COMMENT.
+ * zTokenizerIsDelimiter() and zTokenizerIsOperator() check if \a c is
+ * a delimiter and an operator in \a config, respectively.
+ */
+#define zTokenizerCharClass(config,c)   (config)->char_class[(ubyte)(c)]
+#define zTokenizerIsDelimiter(config,c) ( zTokenizerCharClass(config,c) & ZEDA_CHAR_DELIMITER )
+#define zTokenizerIsOperator(config,c)  ( zTokenizerCharClass(config,c) & ZEDA_CHAR_OPERATOR )
+
 /*! \brief specify a delimiter set.
  *
  * zSetDelimiter() specifies a delimiter set for \a s.
@@ -309,6 +436,20 @@ __ZEDA_EXPORT bool zIsIncludedChar(char c, const char *s);
  */
 #define zIsWS(c) ( (c) == ' ' || (c) == '\t' )
 
+/*! \brief classes of charactors for tokenization.
+ *
+ * zCharClass() is a bitmap of classes of a charactor \a c in the
+ * current configuration of tokenizers (see zTokenizerCharClass()).
+ * The table of classes is rebuilt every time zSetDelimiter(),
+ * zSetOperator() or zSetCommentIdent() is called, so that a charactor
+ * is classified by a single lookup.
+ * _zIsDelimiter() and _zIsOperator() are macro versions of
+ * zIsDelimiter() and zIsOperator(), respectively.
+ */
+#define zCharClass(c)    zTokenizerCharClass( zTokenizerConfigCurrent(), c )
+#define _zIsDelimiter(c) zTokenizerIsDelimiter( zTokenizerConfigCurrent(), c )
+#define _zIsOperator(c)  zTokenizerIsOperator( zTokenizerConfigCurrent(), c )
+
 /*! \brief check if a charactor is a delimiter.
  *
  * zIsDelimiter() checks if a charactor \a c is a
@@ -414,6 +555,32 @@ __ZEDA_EXPORT char zFSkipDelimiter(FILE *fp);
  */
 __ZEDA_EXPORT char *zSSkipDelimiter(char *str);
 
+/*! \brief skip delimiters or a token in a memory buffer.
+ *
+ * zMemSkipDelimiter() skips delimiters in a memory buffer from
+ * \a str until \a end.
+ * zMemSkipToken() skips charactors other than delimiters and the
+ * null charactor in a memory buffer from \a str until \a end.
+ *
+ * Both functions scan 16 or 32 bytes at once with SSE2 or AVX2
+ * instructions if the library is built for them and the delimiter
+ * set has at most 16 charactors. Otherwise, each charactor is
+ * classified by zCharClass().
+ *
+ * zTokenizerMemSkipDelimiter() and zTokenizerMemSkipToken() do the
+ * same with a configuration of tokenizers \a config instead of the
+ * current one.
+ * \return
+ * zMemSkipDelimiter() returns a pointer to the first charactor
+ * which is not a delimiter, and zMemSkipToken() returns a pointer
+ * to the first delimiter or null charactor. If no such charactor
+ * is found, \a end is returned.
+ */
+__ZEDA_EXPORT const char *zTokenizerMemSkipDelimiter(const zTokenizerConfig *config, const char *str, const char *end);
+__ZEDA_EXPORT const char *zTokenizerMemSkipToken(const zTokenizerConfig *config, const char *str, const char *end);
+#define zMemSkipDelimiter(str,end) zTokenizerMemSkipDelimiter( zTokenizerConfigCurrent(), str, end )
+#define zMemSkipToken(str,end)     zTokenizerMemSkipToken( zTokenizerConfigCurrent(), str, end )
+
 #define ZDEFAULT_COMMENT_IDENT '%'
 
 /*! \brief specify the comment identifier. */
@@ -422,6 +589,9 @@ __ZEDA_EXPORT void zSetCommentIdent(char ident);
 /*! \brief reset the comment identifier. */
 __ZEDA_EXPORT void zResetCommentIdent(void);
 
+/*! \brief the current comment identifier. */
+__ZEDA_EXPORT char zCommentIdent(void);
+
 /*! \brief skip comments.
  *
  * zFSkipComment() skips comments, i.e., a one-line string which
@@ -449,6 +619,11 @@ __ZEDA_EXPORT void zSetTagIdent(char begin_ident, char end_ident);
 /*! \brief reset the tag identifiers. */
 __ZEDA_EXPORT void zResetTagIdent(void);
 
+/*! \brief the current beginning identifier of tags. */
+__ZEDA_EXPORT char zTagBeginIdent(void);
+/*! \brief the current ending identifier of tags. */
+__ZEDA_EXPORT char zTagEndIdent(void);
+
 /*! \brief check if a string is a tag.
  *
  * zStrIsTag() checks if a token pointed by \a str is a tag, namely, \a str is bracketed by [] or not.
@@ -477,6 +652,9 @@ __ZEDA_EXPORT void zSetKeyIdent(char ident);
 /*! \brief reset the key identifier. */
 __ZEDA_EXPORT void zResetKeyIdent(void);
 
+/*! \brief the current key identifier. */
+__ZEDA_EXPORT char zKeyIdent(void);
+
 /*! \brief  check if the last token is a key. */
 __ZEDA_EXPORT bool zFPostCheckKey(FILE *fp);
 
@@ -689,6 +867,56 @@ __ZEDA_EXPORT char *zStrSearchKMP(char *text, char *pat);
  */
 __ZEDA_EXPORT char *zStrSearchBM(char *text, char *pat);
 
+/* ********************************************************** */
+/*! \struct zStrPattern
+ * \brief compiled pattern for string search.
+ *
+ * zStrPattern is a pattern compiled in advance to be searched in
+ * many texts. Any byte including the null charactor can be a part
+ * of the pattern.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zStrPattern ){
+  char *pat;  /*!< pattern terminated by the null charactor */
+  size_t len; /*!< length of the pattern */
+  /*! \cond */
+  size_t _skip[0x100]; /* skip table of Boyer-Moore-Horspool algorithm */
+  /*! \endcond */
+};
+
+/*! \brief compile and destroy a pattern for string search.
+ *
+ * zStrPatternCompile() compiles \a len bytes of a pattern \a pat
+ * into \a pattern. \a pat is copied, so that it can be released
+ * after compilation.
+ * zStrPatternCompileStr() compiles a string \a pat terminated by
+ * the null charactor.
+ *
+ * zStrPatternDestroy() destroys \a pattern.
+ * \return
+ * zStrPatternCompile() and zStrPatternCompileStr() return a pointer
+ * \a pattern, or the null pointer if they fail to allocate memory.
+ */
+__ZEDA_EXPORT zStrPattern *zStrPatternCompile(zStrPattern *pattern, const char *pat, size_t len);
+#define zStrPatternCompileStr(pattern,pat) zStrPatternCompile( pattern, pat, strlen(pat) )
+__ZEDA_EXPORT void zStrPatternDestroy(zStrPattern *pattern);
+
+/*! \brief search a compiled pattern in a memory buffer.
+ *
+ * zStrPatternSearch() searches a compiled pattern \a pattern in
+ * \a len bytes of a buffer \a text, which does not have to be
+ * terminated by the null charactor.
+ * Candidates of the position are filtered by the first and the last
+ * charactors of the pattern with SSE2/AVX2 instructions if the library
+ * is built for them. The rest of the buffer and the whole buffer on
+ * other architectures are scanned by Boyer-Moore-Horspool algorithm.
+ * \return
+ * zStrPatternSearch() returns a pointer to the first charactor of
+ * the first occurrence of the pattern in \a text. If the pattern is
+ * not included in \a text, the null pointer is returned. An empty
+ * pattern matches the head of \a text.
+ */
+__ZEDA_EXPORT const char *zStrPatternSearch(const zStrPattern *pattern, const char *text, size_t len);
+
 /*! \} */
 
 #endif /* __KERNEL__ */
@@ -11,6 +11,7 @@
 
 #include <zeda/zeda_list.h>
 #include <zeda/zeda_string.h>
+#include <zeda/zeda_scanner.h>
 
 __BEGIN_DECLS
 
@@ -65,6 +66,77 @@ __ZEDA_EXPORT zStrAddrListCell *zStrAddrListAdd(zStrAddrList *list, char *str);
 #define zStrAddrListFPrint zStrListFPrint
 #define zStrAddrListPrint zStrListPrint
 
+/* ********************************************************** */
+/*! \struct zStrMultiSearch
+ * \brief automaton to search multiple patterns at once.
+ *
+ * zStrMultiSearch is an Aho-Corasick automaton built from a list of
+ * patterns, which finds all occurrences of all the patterns, including
+ * overlapping ones, in a single pass over texts. The transitions are
+ * stored in a dense table over classes of bytes that appear in the
+ * patterns, so that each byte of texts is processed by a lookup.
+ *
+ * The identifier of a pattern is its index in the list in order of
+ * zListForEach(), namely, the order of addition by zStrListAdd().
+ * An empty pattern never matches.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, zStrMultiSearch ){
+  int num; /*!< number of patterns */
+  /*! \cond */
+  size_t *_len;   /* lengths of patterns */
+  int *_next;     /* next identifier of an identical pattern */
+  int _class[0x100]; /* classes of bytes */
+  int _classnum;  /* number of classes of bytes */
+  int _statenum;  /* number of states */
+  int *_delta;    /* transition table */
+  int *_match;    /* identifier of a pattern that ends at each state */
+  int *_out;      /* the nearest state with a match along the failure links */
+  int *_link;     /* the next state with a match along the failure links */
+  /*! \endcond */
+};
+
+/*! \brief compile and destroy an automaton to search multiple patterns.
+ *
+ * zStrMultiSearchCompile() builds an automaton \a ms from a list of
+ * patterns \a list. The patterns are not referred by \a ms after
+ * compilation.
+ *
+ * zStrMultiSearchDestroy() destroys \a ms.
+ * \return
+ * zStrMultiSearchCompile() returns a pointer \a ms, or the null pointer
+ * if it fails to allocate memory.
+ */
+__ZEDA_EXPORT zStrMultiSearch *zStrMultiSearchCompile(zStrMultiSearch *ms, zStrList *list);
+__ZEDA_EXPORT void zStrMultiSearchDestroy(zStrMultiSearch *ms);
+
+/*! \brief search multiple patterns in texts.
+ *
+ * zStrMultiSearchMem() searches all patterns of an automaton \a ms in
+ * \a len bytes of a buffer \a text.
+ *
+ * zStrMultiSearchFP() searches them in the rest of a file stream \a fp.
+ *
+ * zStrMultiSearchScanner() searches them in the rest of texts of a
+ * scanner \a scanner, and moves its current position to the end of
+ * texts, or next to the last occurrence if the search is stopped.
+ *
+ * Every occurrence is notified to a callback function \a match in
+ * order of the position of its last charactor, together with \a arg,
+ * the identifier of the pattern and the offset of its first charactor
+ * from the head of the searched texts. If \a match returns the false
+ * value, the search stops. \a match can be the null pointer to just
+ * count occurrences.
+ *
+ * The bytes of texts are compared as they are, namely, neither the
+ * null charactor nor delimiters are specially treated. \a ms is not
+ * modified, so that it can be shared by multiple threads.
+ * \return
+ * These functions return the number of occurrences notified.
+ */
+__ZEDA_EXPORT int zStrMultiSearchMem(const zStrMultiSearch *ms, const char *text, size_t len, bool (* match)(void*,int,size_t), void *arg);
+__ZEDA_EXPORT int zStrMultiSearchFP(const zStrMultiSearch *ms, FILE *fp, bool (* match)(void*,int,size_t), void *arg);
+__ZEDA_EXPORT int zStrMultiSearchScanner(const zStrMultiSearch *ms, zScanner *scanner, bool (* match)(void*,int,size_t), void *arg);
+
 #endif /* __KERNEL__ */
 
 __END_DECLS
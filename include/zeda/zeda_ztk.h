@@ -14,6 +14,7 @@
 
 #include <zeda/zeda_strlist.h>
 #include <zeda/zeda_pathname.h>
+#include <zeda/zeda_scanner.h>
 
 __BEGIN_DECLS
 
@@ -49,13 +50,77 @@ __ZEDA_EXPORT zFileStack *zFileStackPop(zFileStack *head);
 /*! \brief destroy a file stack. */
 __ZEDA_EXPORT void zFileStackDestroy(zFileStack *head);
 
+/* ********************************************************** */
+/*! \struct ZTKIndex
+ * \brief hash index of tagged fields or key fields of ZTK format.
+ *
+ * An entry of the index is associated with a tag (or a key), and holds the
+ * first and the last fields with the tag (or the key) and the number of them.
+ * The fields with the same tag (or key) are chained by \a sibling member in
+ * order of appearance.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKIndexEntry ){
+  const char *str; /*!< tag or key */
+  ulong hash;      /*!< hash value of the tag or key */
+  int num;         /*!< number of fields */
+  void *head;      /*!< the first field */
+  void *tail;      /*!< the last field */
+};
+
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKIndex ){
+  uint size;            /*!< number of entries */
+  uint capacity;        /*!< number of slots */
+  ZTKIndexEntry *entry; /*!< hash table */
+};
+
+/* ********************************************************** */
+/*! \struct ZTKNumBlock
+ * \brief block of numeric values of a key field of ZTK format.
+ *
+ * A copy of the values of a key field converted to double-precision floating-point
+ * values at parsing, which is stored in a contiguous array. It is built only for a key
+ * field all of whose values are numbers (see ZTKEnableNumBlock()).
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKNumBlock ){
+  int size;     /*!< number of values */
+  int capacity; /*!< size of the allocated array */
+  bool isint;   /*!< true if all values are integers */
+  double *val;  /*!< array of values */
+};
+
+/* ********************************************************** */
+/*! \struct ZTKValList
+ * \brief list of value strings of a key field of ZTK format.
+ *
+ * Value strings are stored one after another in a contiguous buffer \a buf, each of
+ * which is terminated by the null character. \a offset is an array of offsets of the
+ * values in the buffer, and \a size is the number of values.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKValList ){
+  int size;       /*!< number of values */
+  int capacity;   /*!< size of the allocated array of offsets */
+  uint *offset;   /*!< offsets of values in the buffer */
+  char *buf;      /*!< buffer of values */
+  size_t len;     /*!< used size of the buffer */
+  size_t bufsize; /*!< size of the allocated buffer */
+};
+
+/*! \brief the number of values in a list of value strings of ZTK format. */
+#define ZTKValListSize(list)  (list)->size
+/*! \brief the \a i th value string in a list of value strings of ZTK format. */
+#define ZTKValListStr(list,i) ( (const char *)(list)->buf + (list)->offset[i] )
+/*! \brief the length of the \a i th value string in a list of value strings of ZTK format. */
+#define ZTKValListLen(list,i) ( ( (i)+1 < (list)->size ? (list)->offset[(i)+1] : (list)->len ) - (list)->offset[i] - 1 )
+
 /* ********************************************************** */
 /*! \struct ZTKKeyField
  * \brief key field of ZTK format.
  *//* ******************************************************* */
 ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKKeyField ){
-  char *key;        /*!< parsed key */
-  zStrList vallist; /*!< parsed list of strings */
+  char *key;             /*!< parsed key */
+  ZTKValList vallist;    /*!< parsed list of strings */
+  ZTKNumBlock *numblock; /*!< block of numeric values (optional) */
+  ZTKKeyField *sibling;  /*!< the next key field with the same key */
 };
 
 /*! \brief print out a key field of ZTK format. */
@@ -76,6 +141,8 @@ __ZEDA_EXPORT void ZTKKeyFieldListHeadDestroy(ZTKKeyFieldList *list);
 /*! \brief destroy a list of key fields of ZTK format. */
 __ZEDA_EXPORT void ZTKKeyFieldListDestroy(ZTKKeyFieldList *list);
 
+ZDECL_STRUCT( ZTKSrc );
+
 /* ********************************************************** */
 /*! \struct ZTKTagField
  * \brief tagged field of ZTK format.
@@ -83,6 +150,9 @@ __ZEDA_EXPORT void ZTKKeyFieldListDestroy(ZTKKeyFieldList *list);
 ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKTagField ){
   char *tag;
   ZTKKeyFieldList kflist;
+  ZTKIndex keyindex;    /*!< hash index of keys */
+  ZTKTagField *sibling; /*!< the next tagged field with the same tag */
+  ZTKSrc *src;          /*!< source file of the tag (the null pointer if not parsed from a file) */
 };
 
 /*! \brief print out a tagged field of ZTK format (for debug). */
@@ -103,6 +173,130 @@ __ZEDA_EXPORT void ZTKTagFieldListDestroy(ZTKTagFieldList *list);
 /*! \brief print out a list of tagged fields of ZTK format (for debug). */
 __ZEDA_EXPORT void ZTKTagFieldListFPrint(FILE *fp, ZTKTagFieldList *list);
 
+/* ********************************************************** */
+/*! \struct ZTKStream
+ * \brief streaming parser of ZTK format.
+ *
+ * A streaming parser scans ZTK format texts, and notifies tags, keys and values to callback
+ * functions \a on_tag, \a on_key and \a on_val in order of appearance without building a
+ * tag-and-key list. The first argument of the callback functions is \a arg, and the second
+ * and the third arguments are the pointer to the head of the string and its length. Note
+ * that the string is not necessarily terminated by the null charactor, and is valid only
+ * while the callback function is called. If a callback function returns the false value,
+ * the parser stops scanning. Any of the callback functions can be the null pointer, and
+ * then the corresponding events are ignored.
+ *
+ * As well as ZTKParse(), a value that appears before any key is notified after a null key,
+ * and a key that appears before any tag is notified after a null tag. Files specified by
+ * the \c include directive are also scanned in the same manner, where inclusion of the same
+ * file in a nested manner is detected by \a fs.
+ *
+ * Texts are tokenized according to a configuration of tokenizers \a tokenizer, which is the
+ * current one of the calling thread of ZTKStreamInit() (see zTokenizerConfigSelect()).
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKStream ){
+  bool (* on_tag)(void *, const char *, size_t); /*!< callback function for a tag */
+  bool (* on_key)(void *, const char *, size_t); /*!< callback function for a key */
+  bool (* on_val)(void *, const char *, size_t); /*!< callback function for a value */
+  void *arg;     /*!< argument for the callback functions */
+  const zTokenizerConfig *tokenizer; /*!< configuration of tokenizers */
+  zFileStack fs; /*!< stack of included files */
+  /*! \cond */
+  bool _tagged; /* a tagged field is active */
+  bool _keyed;  /* a key field is active */
+  bool (* _include)(ZTKStream *, const char *); /* inclusion of a file */
+  /*! \endcond */
+};
+
+/*! \brief initialize and destroy a streaming parser of ZTK format.
+ *
+ * ZTKStreamInit() initializes a streaming parser \a stream with callback functions \a on_tag,
+ * \a on_key and \a on_val, and an argument \a arg for them.
+ *
+ * ZTKStreamDestroy() destroys \a stream.
+ * \return
+ * ZTKStreamInit() returns a pointer \a stream.
+ */
+__ZEDA_EXPORT ZTKStream *ZTKStreamInit(ZTKStream *stream, bool (* on_tag)(void*,const char*,size_t), bool (* on_key)(void*,const char*,size_t), bool (* on_val)(void*,const char*,size_t), void *arg);
+__ZEDA_EXPORT void ZTKStreamDestroy(ZTKStream *stream);
+
+/*! \brief scan ZTK format texts by a streaming parser.
+ *
+ * ZTKStreamParseFP() scans a file stream \a fp by a streaming parser \a stream. Since the
+ * stream is read through a buffer of a fixed size (see zScannerInitFP()), a file of any size
+ * can be scanned in a constant space.
+ *
+ * ZTKStreamParseMem() scans \a len bytes of a buffer \a buf.
+ *
+ * ZTKStreamParse() opens a file \a path and scans it by ZTKStreamParseFP().
+ * \return
+ * These functions return the false value if a callback function returns the false value or
+ * \a path cannot be opened. Otherwise, the true value is returned.
+ */
+__ZEDA_EXPORT bool ZTKStreamParseFP(ZTKStream *stream, FILE *fp);
+__ZEDA_EXPORT bool ZTKStreamParseMem(ZTKStream *stream, const char *buf, size_t len);
+__ZEDA_EXPORT bool ZTKStreamParse(ZTKStream *stream, const char *path);
+
+/* ********************************************************** */
+/*! \struct ZTKSrc
+ * \brief source file of ZTK format.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKSrc ){
+  char *path;       /*!< absolute path to the file */
+  zFileStamp stamp; /*!< stamp of the file when parsed (zeros if the file to be included was not found) */
+  ZTKSrc *parent;   /*!< source file which includes the file */
+  ZTKTagFieldListCell *head; /*!< the first tagged field parsed from the file and included files */
+  int num;          /*!< number of tagged fields parsed from the file and included files */
+  bool shared;      /*!< a tagged field is shared with another file */
+  void *doc;        /*!< document of the file shared via the cache of included files (internal use) */
+};
+
+/* ********************************************************** */
+/*! \struct ZTKSrcList
+ * \brief list of source files of ZTK format.
+ *//* ******************************************************* */
+zListClass( ZTKSrcList, ZTKSrcListCell, ZTKSrc );
+
+/*! \brief destroy a list of source files of ZTK format. */
+__ZEDA_EXPORT void ZTKSrcListDestroy(ZTKSrcList *list);
+
+/* ********************************************************** */
+/*! \struct ZTKPrpStats
+ * \brief statistics of evaluations of a ZTK property.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKPrpStats ){
+  char *str;   /*!< tag/key string of the property */
+  long count;  /*!< number of calls of the evaluation function */
+  double time; /*!< time spent in the evaluation function in seconds (including nested evaluations) */
+};
+
+/* ********************************************************** */
+/*! \struct ZTKStats
+ * \brief statistics of a ZTK format processor.
+ *
+ * The numbers of fields, the memory footprint and the depth of included files are always
+ * available. The timings are only measured if the library is built with __ZEDA_USE_ZTK_STATS
+ * (CONFIG_USE_ZTK_STATS in config), and are zero otherwise.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKStats ){
+  long tagnum;       /*!< number of tagged fields */
+  long keynum;       /*!< number of key fields */
+  long valnum;       /*!< number of values */
+  size_t strsize;    /*!< bytes of tag, key and value strings including the null characters */
+  size_t listsize;   /*!< bytes of lists except strings: cells, hash indices, arrays of offsets, spare buffers, blocks of numbers and source files */
+  int srcnum;        /*!< number of parsed source files */
+  int incdepth;      /*!< maximum depth of included files (zero if no file is included) */
+  double t_parse;    /*!< time spent in parsers in seconds */
+  double t_token;    /*!< time spent in tokenizing in seconds (t_parse minus t_alloc) */
+  double t_alloc;    /*!< time spent in allocating and indexing tags, keys and values in seconds */
+  int prpnum;        /*!< number of evaluated properties */
+  ZTKPrpStats *prp;  /*!< statistics of evaluations of properties by ZTKEvalTag() and ZTKEvalKey() */
+};
+
+#if defined(__cplusplus) && __cplusplus >= 201703L
+class ZTKTagRange;
+#endif /* __cplusplus >= 201703L */
+
 /* ********************************************************** */
 /*! \struct ZTK
  * \brief ZTK format processor.
@@ -112,11 +306,28 @@ ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTK ){
   ZTKTagFieldList tflist;
   ZTKTagFieldListCell *tf_cp;
   ZTKKeyFieldListCell *kf_cp;
-  zStrListCell *val_cp;
+  const char *val_cp;
+  int val_id; /*!< index of the current value in the current key field */
+  bool numblock; /*!< flag to build blocks of numeric values */
+  bool inccache; /*!< flag to share included files via the process-wide cache */
+  int threadnum; /*!< number of threads to parse included files concurrently */
+  const zTokenizerConfig *tokenizer; /*!< configuration of tokenizers (optional) */
+  zArena *arena; /*!< memory arena for the tag-and-key list (optional) */
+  ZTKIndex tagindex; /*!< hash index of tags */
+  ZTKIndex strpool; /*!< pool of interned tags and keys */
+  ZTKSrcList srclist; /*!< list of parsed source files */
+  ZTKSrc *src_cp; /*!< source file being parsed */
+  void *stats; /*!< accumulated timings (internal use; null without __ZEDA_USE_ZTK_STATS) */
 #ifdef __cplusplus
  public:
   ZTK();
   ~ZTK();
+  bool enableArena(size_t blocksize=0);
+  void enableNumBlock();
+  void enableConcurrentInclude(int threadnum);
+  void enableIncludeCache();
+  void setTokenizer(const zTokenizerConfig *config);
+  const char *intern(const char *str);
   bool addTag(const char *tag);
   bool addKey(const char *key);
   void delKey();
@@ -124,13 +335,22 @@ ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTK ){
   bool addInt(const int val);
   bool addDouble(const double val);
   bool parseFP(FILE *fp);
+  bool parseMem(const char *buf, size_t len);
   bool parse(const char *path);
+  bool reload();
+  bool readCache(const char *path);
+  bool readCacheRaw(const char *path, bool *stale);
+  bool writeCache(const char *path);
   int countTag(const char *tag);
   int countKey(const char *key);
-  zStrListCell *valptr();
+  ZTKTagFieldListCell *findTag(const char *tag);
+  ZTKTagFieldListCell *findNextTag();
+  ZTKKeyFieldListCell *findKey(const char *key);
+  ZTKKeyFieldListCell *findNextKey();
+  const char *valptr();
   const char *val();
-  zStrListCell *nextVal();
-  zStrListCell *rewindVal();
+  const char *nextVal();
+  const char *rewindVal();
   bool cmpVal(const char *str);
   const char *key();
   int keyFieldSize();
@@ -144,8 +364,17 @@ ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTK ){
   void rewind();
   int getInt();
   double getDouble();
+  int getIntN(int *val, int n);
+  int getDoubleN(double *val, int n);
+  ZTKNumBlock *numBlock();
   void fprintf(FILE *fp);
   void printf();
+  ZTKStats *getStats(ZTKStats *stats);
+  void resetStats();
+#if __cplusplus >= 201703L
+  ZTKTagRange tags() const;
+  ZTKTagRange tags(const char *tag) const;
+#endif /* __cplusplus >= 201703L */
 #endif
 };
 
@@ -155,6 +384,108 @@ __ZEDA_EXPORT ZTK *ZTKInit(ZTK *ztk);
 /*! \brief destroy a ZTK format processor. */
 __ZEDA_EXPORT void ZTKDestroy(ZTK *ztk);
 
+/*! \brief enable a memory arena of a ZTK format processor.
+ *
+ * ZTKEnableArena() lets a ZTK format processor \a ztk allocate all tags, keys, values and
+ * cells of the tag-and-key list from a memory arena, which allocates memory by a few large
+ * blocks with the size \a blocksize. If zero is given for \a blocksize, the default size
+ * is applied. ZTKDestroy() releases all the blocks at once, and the memory arena is disabled
+ * again.
+ *
+ * The memory arena has to be enabled after initializing \a ztk by ZTKInit() and before
+ * any tag is added.
+ * \return
+ * ZTKEnableArena() returns the true value if it succeeds to enable the memory arena or it
+ * is already enabled. If some tags are already added to \a ztk or it fails to allocate
+ * memory, the false value is returned.
+ */
+__ZEDA_EXPORT bool ZTKEnableArena(ZTK *ztk, size_t blocksize);
+
+/*! \brief enable blocks of numeric values of a ZTK format processor.
+ *
+ * ZTKEnableNumBlock() lets a ZTK format processor \a ztk convert values of a key field to
+ * double-precision floating-point values when they are added, and store them in a contiguous
+ * array ZTKNumBlock as well as the value strings. The array is kept only while all values of
+ * the key field are numbers, namely, strings entirely read by zNumParseDouble(). Once a
+ * non-numeric value is added, the key field has no block.
+ *
+ * The blocks have to be enabled before values are added, and are referred by ZTKKeyNumBlock(),
+ * ZTKDoubleN() and ZTKIntN().
+ */
+#define ZTKEnableNumBlock(ztk) ( (ztk)->numblock = true )
+
+/*! \brief specify a configuration of tokenizers of a ZTK format processor.
+ *
+ * ZTKSetTokenizer() lets a ZTK format processor \a ztk tokenize texts according to a
+ * configuration of tokenizers \a config (see zTokenizerConfig) instead of the current one
+ * of the calling thread, so that files in different formats can be parsed at once on
+ * different threads or even on the same thread. \a config has to be kept while \a ztk
+ * parses files. If the null pointer is given for \a config, the current configuration of
+ * the calling thread is applied at parsing, which is the default.
+ *
+ * ZTKTokenizer() is the configuration applied to \a ztk.
+ * \note
+ * Files shared via the cache of included files (see ZTKEnableIncludeCache()) are distinguished
+ * by the contents of the configurations which tokenized them, so that a configuration modified
+ * in place does not replay tokens scanned before the modification. A binary cache (see
+ * ZTKReadCache()) also records the configuration, and is loaded only with the same one.
+ */
+#define ZTKSetTokenizer(ztk,config) ( (ztk)->tokenizer = (config) )
+#define ZTKTokenizer(ztk) ( (ztk)->tokenizer ? (ztk)->tokenizer : zTokenizerConfigCurrent() )
+
+/*! \brief enable concurrent parsing of included files of a ZTK format processor.
+ *
+ * ZTKEnableConcurrentInclude() lets ZTKParse() of a ZTK format processor \a ztk read and scan
+ * the given file and files included from it on \a threadnum threads (including the calling
+ * thread). The scanned files are spliced into the tag-and-key list in the original order, so
+ * that the result is identical with that of serial parsing. Duplicate inclusions are detected
+ * in the same way with serial parsing, too. If zero is given for \a threadnum, files are
+ * parsed serially.
+ *
+ * The contents of all the files are kept on memory until the parsing finishes.
+ * \notes
+ * Files are read and scanned concurrently only if ZEDA is built with CONFIG_USE_PTHREAD=y.
+ * Otherwise, all the files are read on the calling thread in advance.
+ */
+#define ZTKEnableConcurrentInclude(ztk,threadnum) ( (ztk)->threadnum = (threadnum) )
+
+/*! \brief enable the process-wide cache of included files of a ZTK format processor.
+ *
+ * ZTKEnableIncludeCache() lets a ZTK format processor \a ztk share files included by it with
+ * other ZTK format processors in the same process. An included file is read and scanned only
+ * once, and the scanned tokens are kept with the contents of the file in a process-wide cache
+ * keyed by the device ID, the inode number, the last modification time and the size of the
+ * file. When the same file is included again, the tokens are replayed instead of reading and
+ * scanning the file. A modified file is read again since its stamp differs.
+ *
+ * Each document in the cache has a reference counter, and is released when all the ZTK format
+ * processors that include it are destroyed.
+ *
+ * ZTKIncludeCacheSize() returns the number of documents in the cache.
+ * \notes
+ * Only the tokens are shared. Each ZTK format processor builds its own tag-and-key list from
+ * them, which can be modified independently of the others.
+ */
+#define ZTKEnableIncludeCache(ztk) ( (ztk)->inccache = true )
+__ZEDA_EXPORT int ZTKIncludeCacheSize(void);
+
+/*! \brief intern a string in a ZTK format processor.
+ *
+ * Tags and keys added to a ZTK format processor are interned in a string pool of it, namely,
+ * the same tags and keys share the same string on memory. Hence, ZTKTag() and ZTKKey()
+ * return the same pointer for the same string.
+ *
+ * ZTKIntern() interns a string \a str in the pool of a ZTK format processor \a ztk, and
+ * returns the pointer to the interned string. It can be compared with ZTKTag() and ZTKKey()
+ * by ZTKTagIs() and ZTKKeyIs(), which are just comparisons of pointers.
+ *
+ * The interned string is valid until \a ztk is destroyed.
+ * \return
+ * ZTKIntern() returns a pointer to the interned string. If \a str is the null pointer or it
+ * fails to allocate memory, the null pointer is returned.
+ */
+__ZEDA_EXPORT const char *ZTKIntern(ZTK *ztk, const char *str);
+
 /*! \brief add a new tag to a ZTK format processor. */
 __ZEDA_EXPORT bool ZTKAddTag(ZTK *ztk, const char *tag);
 /*! \brief add a new key to the current tag field of a ZTK format processor. */
@@ -171,23 +502,161 @@ __ZEDA_EXPORT bool ZTKAddDouble(ZTK *ztk, const double val);
 /*! \brief scan and parse a file stream into a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT bool ZTKParseFP(ZTK *ztk, FILE *fp);
 
-/*! \brief scan a file and parse it into a tag-and-key list of a ZTK format processor. */
+/*! \brief scan and parse a memory buffer into a tag-and-key list of a ZTK format processor.
+ *
+ * ZTKParseMem() parses \a len bytes of a buffer \a buf that stores ZTK format texts, and builds
+ * the same tag-and-key list with the one ZTKParseFP() builds from a file stream. The buffer is
+ * scanned directly without copying each token, and does not have to be terminated by the null
+ * charactor. Files specified by the \c include directive are also parsed.
+ * \return
+ * ZTKParseMem() returns the false value if it fails to allocate memory for the list. Otherwise,
+ * the true value is returned.
+ */
+__ZEDA_EXPORT bool ZTKParseMem(ZTK *ztk, const char *buf, size_t len);
+
+/*! \brief scan a file and parse it into a tag-and-key list of a ZTK format processor.
+ *
+ * ZTKParse() maps the whole contents of a file \a path onto memory, and parses it in the same
+ * way with ZTKParseMem(). If the file cannot be mapped, it is scanned in the same way with
+ * ZTKParseFP() instead (see zScannerMapFP()).
+ * \a ztk has to be initialized by ZTKInit() in advance. The parsed fields are appended to
+ * the tag-and-key list of \a ztk. If the list is empty and a binary cache of \a path exists,
+ * the cache is loaded instead (see ZTKReadCache()).
+ */
 __ZEDA_EXPORT bool ZTKParse(ZTK *ztk, const char *path);
 
+/*! \brief suffix of a binary cache of ZTK format. */
+#define ZEDA_ZTK_CACHE_SUFFIX "ztkc"
+
+/*! \brief binary cache of a ZTK file.
+ *
+ * A binary cache of ZTK format is a flat image of a tag-and-key list, which can be loaded
+ * without scanning texts. It also records stamps of all the source files parsed into the
+ * list, namely, the original file and files included from it (see zFileStampGet()). Files
+ * to be included that were not found are also recorded with a stamp of zeros.
+ *
+ * ZTKCachePath() makes the path to the binary cache of a ZTK file \a path, and puts it into
+ * \a cachepath. \a size is the size of \a cachepath. The suffix ZEDA_ZTK_SUFFIX of \a path
+ * is replaced with ZEDA_ZTK_CACHE_SUFFIX, or ZEDA_ZTK_CACHE_SUFFIX is concatenated otherwise.
+ *
+ * ZTKWriteCache() writes the tag-and-key list and the source files of a ZTK format processor
+ * \a ztk to a file \a path. The cache is written to a temporary file in the same directory
+ * with \a path at first, and then it replaces \a path by rename(), so that another reader
+ * never sees a partially written cache.
+ *
+ * ZTKReadCache() reads a binary cache \a path by a single read, and appends the tag-and-key
+ * list stored in it to that of \a ztk. If any of the recorded source files is modified,
+ * replaced or removed after the cache was written, or any of the files not found is created,
+ * the cache is regarded stale and nothing is appended. The cache is also regarded stale if
+ * it was written with a configuration of tokenizers different from ZTKTokenizer() of \a ztk,
+ * namely, the table of classes of charactors or any of the identifiers differs.
+ *
+ * ZTKReadCacheRaw() reads a binary cache \a path in the same way with ZTKReadCache(), but
+ * appends the stored tag-and-key list even if the cache is stale, e.g. to convert the cache
+ * back to texts after the source files are modified or removed. If \a stale is not the null
+ * pointer, the true value is set for it if the cache is stale, or the false value otherwise.
+ *
+ * ZTKParse() tries to load the binary cache of \a path if the tag-and-key list of \a ztk is
+ * empty and the binary cache exists. If the cache is stale or broken, \a path is parsed, and
+ * the cache is rewritten. Hence, the binary cache is enabled just by creating it once by
+ * ZTKWriteCache(). If the cache cannot be rewritten, e.g. the directory is not writable, it
+ * is left as it is without any error message.
+ * \return
+ * ZTKCachePath() returns a pointer \a cachepath.
+ *
+ * ZTKWriteCache() returns the true value if it succeeds to write the cache. Otherwise, the
+ * false value is returned.
+ *
+ * ZTKReadCache() returns the true value if it succeeds to load the cache. If the cache does
+ * not exist, is stale or broken, or it fails to allocate memory, the false value is returned.
+ * ZTKReadCacheRaw() returns the false value only if the cache does not exist, is broken or it
+ * fails to allocate memory.
+ */
+__ZEDA_EXPORT char *ZTKCachePath(const char *path, char *cachepath, size_t size);
+__ZEDA_EXPORT bool ZTKWriteCache(ZTK *ztk, const char *path);
+__ZEDA_EXPORT bool ZTKReadCache(ZTK *ztk, const char *path);
+__ZEDA_EXPORT bool ZTKReadCacheRaw(ZTK *ztk, const char *path, bool *stale);
+
+/*! \brief reload changed source files of a ZTK format processor.
+ *
+ * Each tagged field of a ZTK format processor records the source file in which its tag
+ * appears (ZTKTagField::src), and each source file records the file which includes it and
+ * the range of tagged fields parsed from it and files included from it.
+ *
+ * ZTKReload() checks stamps of all the source files of a ZTK format processor \a ztk, and
+ * re-parses only the changed files. The tagged fields parsed from a changed file (and files
+ * included from it) are replaced with the new ones at the same position of the tag-and-key
+ * list, while the other tagged fields are kept as they are. The hash index of tags is
+ * rebuilt, and the memory arena, if enabled, is kept. If a file to be included was not
+ * found, the including file is re-parsed once the file is created.
+ *
+ * If a tagged field of a changed file is shared with another file, e.g. keys following an
+ * \c include directive in the including file belong to the last tagged field of the included
+ * file, the nearest including file which does not share tagged fields is re-parsed instead.
+ * If there is no such file, the whole list is re-parsed from the original file, provided that
+ * all the tagged fields are parsed from a single file.
+ *
+ * After reloading, \a ztk is rewound (see ZTKRewind()).
+ * \return
+ * ZTKReload() returns the true value if it succeeds to reload the changed files or no file is
+ * changed. If the changed files cannot be re-parsed, or the whole list has to be but some
+ * tagged fields are not parsed from a single file, the false value is returned.
+ */
+__ZEDA_EXPORT bool ZTKReload(ZTK *ztk);
+
 /*! \brief count the number of tagged fields with a specified tag in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT int ZTKCountTag(ZTK *ztk, const char *tag);
 
 /*! \brief count the number of key fields with a specified key of the current tagged field in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT int ZTKCountKey(ZTK *ztk, const char *key);
 
+/*! \brief find a tagged field with a specified tag in a tag-and-key list of a ZTK format processor.
+ *
+ * ZTKFindTag() moves the current tagged field of a ZTK format processor \a ztk to the first
+ * tagged field with a tag \a tag, and rewinds the key fields of it.
+ * ZTKFindNextTag() moves the current tagged field to the next one with the same tag.
+ * ZTKFindKey() moves the current key field of the current tagged field to the first key field
+ * with a key \a key, and rewinds the values of it.
+ * ZTKFindNextKey() moves the current key field to the next one with the same key.
+ *
+ * Fields are looked up through hash indices of tags and keys, which are updated every time
+ * a tag or a key is added by ZTKAddTag() or ZTKAddKey(), or by parsers. As well as ZTKTagNext()
+ * and ZTKKeyNext(), fields without any values are skipped.
+ * \return
+ * ZTKFindTag() and ZTKFindNextTag() return a pointer to the found tagged field, and ZTKFindKey()
+ * and ZTKFindNextKey() return a pointer to the found key field. If no field is found, the null
+ * pointer is returned, and the current field is unchanged.
+ */
+__ZEDA_EXPORT ZTKTagFieldListCell *ZTKFindTag(ZTK *ztk, const char *tag);
+__ZEDA_EXPORT ZTKTagFieldListCell *ZTKFindNextTag(ZTK *ztk);
+__ZEDA_EXPORT ZTKKeyFieldListCell *ZTKFindKey(ZTK *ztk, const char *key);
+__ZEDA_EXPORT ZTKKeyFieldListCell *ZTKFindNextKey(ZTK *ztk);
+
+/*! \brief look up fields with a specified tag or key without moving the current field.
+ *
+ * ZTKFindTagField() looks up the first tagged field with a tag \a tag in a tag-and-key list
+ * of a ZTK format processor \a ztk.
+ * ZTKFindKeyField() looks up the first key field with a key \a key in a tagged field \a tf.
+ * The following fields with the same tag or key are chained by \a sibling member.
+ *
+ * Unlike ZTKFindTag() and ZTKFindKey(), neither the current fields nor the current value of
+ * \a ztk are touched, so that multiple threads can look up fields of the same list at once.
+ * Fields without any values are not skipped.
+ * \return
+ * ZTKFindTagField() and ZTKFindKeyField() return a pointer to the found field. If no field
+ * is found, the null pointer is returned.
+ */
+__ZEDA_EXPORT ZTKTagField *ZTKFindTagField(const ZTK *ztk, const char *tag);
+__ZEDA_EXPORT ZTKKeyField *ZTKFindKeyField(const ZTKTagField *tf, const char *key);
+
 /*! \brief return a pointer to the current value string of the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
 #define ZTKValPtr(ztk) (ztk)->val_cp
 /*! \brief return the current value string of the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
-#define ZTKVal(ztk) ( ZTKValPtr(ztk) ? (const char *)ZTKValPtr(ztk)->data : "" )
+#define ZTKVal(ztk) ( ZTKValPtr(ztk) ? ZTKValPtr(ztk) : "" )
 /*! \brief move to the next value string in the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
-__ZEDA_EXPORT zStrListCell *ZTKValNext(ZTK *ztk);
+__ZEDA_EXPORT const char *ZTKValNext(ZTK *ztk);
 /*! \brief rewind the list of value strings of the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
-__ZEDA_EXPORT zStrListCell *ZTKValRewind(ZTK *ztk);
+__ZEDA_EXPORT const char *ZTKValRewind(ZTK *ztk);
 /*! \brief check if a string is the same with the current value string of the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
 #define ZTKValCmp(ztk,str) ( strcmp( ZTKVal(ztk), str ) == 0 )
 
@@ -196,13 +665,15 @@ __ZEDA_EXPORT zStrListCell *ZTKValRewind(ZTK *ztk);
 /*! \brief return the current key of the current tagged field in a tag-and-key list of a ZTK format processor. */
 #define ZTKKey(ztk) ( ZTKKeyPtr(ztk) ? (const char *)ZTKKeyPtr(ztk)->data.key : "" )
 /*! \brief return the number of values of the current key field of a ZTK format processor. */
-#define ZTKKeyFieldSize(ztk) ( ZTKKeyPtr(ztk) ? zListSize(&ZTKKeyPtr(ztk)->data.vallist): 0 )
+#define ZTKKeyFieldSize(ztk) ( ZTKKeyPtr(ztk) ? ZTKValListSize(&ZTKKeyPtr(ztk)->data.vallist) : 0 )
 /*! \brief move to the next key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT ZTKKeyFieldListCell *ZTKKeyNext(ZTK *ztk);
 /*! \brief rewind the list of key fields of the current tagged field in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT ZTKKeyFieldListCell *ZTKKeyRewind(ZTK *ztk);
 /*! \brief check if a string is the same with the current key of the current tagged field in a tag-and-key list of a ZTK format processor. */
-#define ZTKKeyCmp(ztk,str) ( strcmp( ZTKKey(ztk), str ) == 0 )
+#define ZTKKeyCmp(ztk,str) ( ZTKKey(ztk) == (str) || strcmp( ZTKKey(ztk), str ) == 0 )
+/*! \brief check if a string interned by ZTKIntern() is the current key of the current tagged field of a ZTK format processor. */
+#define ZTKKeyIs(ztk,str) ( ZTKKeyPtr(ztk) && ZTKKeyPtr(ztk)->data.key == (str) )
 
 /*! \brief a pointer to the current tagged field in tag-and-key list of a ZTK format processor. */
 #define ZTKTagPtr(ztk) (ztk)->tf_cp
@@ -213,7 +684,9 @@ __ZEDA_EXPORT ZTKTagFieldListCell *ZTKTagNext(ZTK *ztk);
 /*! \brief rewind the list of tagged field in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT ZTKTagFieldListCell *ZTKTagRewind(ZTK *ztk);
 /*! \brief check if a string is the same with the current tag in a tag-and-key list of a ZTK format processor. */
-#define ZTKTagCmp(ztk,str) ( strcmp( ZTKTag(ztk), str ) == 0 )
+#define ZTKTagCmp(ztk,str) ( ZTKTag(ztk) == (str) || strcmp( ZTKTag(ztk), str ) == 0 )
+/*! \brief check if a string interned by ZTKIntern() is the current tag of a ZTK format processor. */
+#define ZTKTagIs(ztk,str) ( ZTKTagPtr(ztk) && ZTKTagPtr(ztk)->data.tag == (str) )
 
 /*! \brief rewind a tag-and-key list of a ZTK format processor. */
 #define ZTKRewind(ztk) ZTKTagRewind( ztk )
@@ -223,13 +696,125 @@ __ZEDA_EXPORT int ZTKInt(ZTK *ztk);
 /*! \brief retrieve a real value from the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
 __ZEDA_EXPORT double ZTKDouble(ZTK *ztk);
 
-/*! \brief print out ZTK to a file. */
+/*! \brief block of numeric values of the current key field of a ZTK format processor.
+ *
+ * ZTKKeyNumBlock() returns a pointer to the block of numeric values of the current key field
+ * of a ZTK format processor \a ztk, which is built at parsing if ZTKEnableNumBlock() is applied.
+ * The block covers all values of the key field regardless of the current value. It is valid
+ * until \a ztk is destroyed.
+ * If the current key field does not have the block, the null pointer is returned.
+ */
+#define ZTKKeyNumBlock(ztk) ( ZTKKeyPtr(ztk) ? ZTKKeyPtr(ztk)->data.numblock : NULL )
+
+/*! \brief retrieve integer/real values from the current key field of a ZTK format processor.
+ *
+ * ZTKIntN() and ZTKDoubleN() retrieve at most \a n integer values and real values from the
+ * current value of the current key field of a ZTK format processor \a ztk, respectively, and
+ * store them in an array pointed by \a val. The current value moves forward by the number of
+ * retrieved values.
+ * If the current key field has a block of numeric values (see ZTKEnableNumBlock()), the values
+ * are copied from it without converting strings. Otherwise, they are retrieved one-by-one in the
+ * same way with ZTKInt() and ZTKDouble(). The results are the same in both cases.
+ * \return
+ * ZTKIntN() and ZTKDoubleN() return the number of retrieved values.
+ */
+__ZEDA_EXPORT int ZTKIntN(ZTK *ztk, int *val, int n);
+__ZEDA_EXPORT int ZTKDoubleN(ZTK *ztk, double *val, int n);
+
+/* ********************************************************** */
+/*! \struct ZTKWriter
+ * \brief buffered writer of ZTK format.
+ *
+ * A buffered writer of ZTK format formats contents on memory, and flushes them to a file
+ * stream or a file descriptor by large blocks. The contents written after the last mark
+ * can be discarded without touching the destination, so that it works with pipes and
+ * terminals as well as regular files.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKWriter ){
+  FILE *fp;    /*!< stream to format contents */
+  char *buf;   /*!< buffer of formatted contents */
+  size_t size; /*!< size of formatted contents */
+  long mark;   /*!< point to roll back */
+  FILE *out;   /*!< destination file stream */
+  int fd;      /*!< destination file descriptor */
+};
+
+/*! \brief open and close a buffered writer of ZTK format.
+ *
+ * ZTKWriterOpen() and ZTKWriterOpenFD() open a buffered writer \a writer of ZTK format to a
+ * file stream \a fp and a file descriptor \a fd, respectively.
+ * Contents are formatted through a file stream ZTKWriterFP(), which is a memory stream by
+ * open_memstream() if available (POSIX.1-2008). Otherwise, e.g. on Windows, it is a temporary
+ * file on disk created by tmpfile() instead of a buffer on memory.
+ *
+ * ZTKWriterMark() sets a point to roll back at the end of the formatted contents.
+ * If the formatted contents exceed a block size (64KB), they are flushed at the same time.
+ * ZTKWriterRollback() discards the contents formatted after the last mark.
+ *
+ * ZTKWriterFlush() flushes the formatted contents of \a writer to the destination.
+ * ZTKWriterClose() flushes the formatted contents and closes \a writer. The destination is
+ * not closed.
+ * \return
+ * ZTKWriterOpen() and ZTKWriterOpenFD() return a pointer \a writer if they succeed. If they
+ * fail to open the memory stream or the temporary file, the null pointer is returned.
+ *
+ * ZTKWriterMark(), ZTKWriterFlush() and ZTKWriterClose() return the false value if they fail
+ * to write contents to the destination. Otherwise, the true value is returned.
+ */
+__ZEDA_EXPORT ZTKWriter *ZTKWriterOpen(ZTKWriter *writer, FILE *fp);
+__ZEDA_EXPORT ZTKWriter *ZTKWriterOpenFD(ZTKWriter *writer, int fd);
+#define ZTKWriterFP(writer) (writer)->fp
+__ZEDA_EXPORT bool ZTKWriterMark(ZTKWriter *writer);
+__ZEDA_EXPORT void ZTKWriterRollback(ZTKWriter *writer);
+__ZEDA_EXPORT bool ZTKWriterFlush(ZTKWriter *writer);
+__ZEDA_EXPORT bool ZTKWriterClose(ZTKWriter *writer);
+
+/*! \brief write ZTK to a buffered writer. */
+__ZEDA_EXPORT bool ZTKWrite(ZTKWriter *writer, ZTK *ztk);
+
+/*! \brief print out ZTK to a file.
+ *
+ * ZTKFPrint() prints out ZTK \a ztk to a file \a fp through a buffered writer. If the writer
+ * cannot be opened, it prints out directly to \a fp.
+ */
 __ZEDA_EXPORT void ZTKFPrint(FILE *fp, ZTK *ztk);
 #define ZTKPrint(ztk) ZTKFPrint( stdout, ztk )
 
+/*! \brief statistics of a ZTK format processor.
+ *
+ * ZTKGetStats() stores statistics of a ZTK format processor \a ztk to \a stats, namely, the
+ * numbers of tagged fields, key fields and values, the bytes of strings and of the overhead of
+ * lists, and the number and the maximum depth of source files.
+ *
+ * If the library is built with __ZEDA_USE_ZTK_STATS, the time spent in parsers (ZTKParse(),
+ * ZTKParseFP(), ZTKParseMem(), ZTKReadCache() and ZTKReload()) is accumulated, which is split
+ * into tokenizing and allocation, together with the number of calls and the time of evaluation
+ * functions of each property called by ZTKEvalTag() and ZTKEvalKey() and their variants.
+ * \a prp member of \a stats points to an internal array of \a ztk, which is valid until
+ * the accumulated timings are reset by ZTKResetStats() or \a ztk is destroyed by ZTKDestroy().
+ * Without __ZEDA_USE_ZTK_STATS, nothing is measured so that no overhead is imposed on parsers
+ * and evaluators, and the timings are zero.
+ *
+ * ZTKResetStats() resets the accumulated timings of \a ztk.
+ *
+ * ZTKStatsFPrint() prints out \a stats to the current position of a file \a fp.
+ * \return
+ * ZTKGetStats() returns \a stats.
+ */
+__ZEDA_EXPORT ZTKStats *ZTKGetStats(ZTK *ztk, ZTKStats *stats);
+__ZEDA_EXPORT void ZTKResetStats(ZTK *ztk);
+__ZEDA_EXPORT void ZTKStatsFPrint(FILE *fp, const ZTKStats *stats);
+#define ZTKStatsPrint(stats) ZTKStatsFPrint( stdout, stats )
+
 #ifdef __cplusplus
 inline ZTK::ZTK(){ ZTKInit( this ); }
 inline ZTK::~ZTK(){ ZTKDestroy( this ); }
+inline bool ZTK::enableArena(size_t blocksize){ return ZTKEnableArena( this, blocksize ); }
+inline void ZTK::enableNumBlock(){ ZTKEnableNumBlock( this ); }
+inline void ZTK::enableConcurrentInclude(int threadnum){ ZTKEnableConcurrentInclude( this, threadnum ); }
+inline void ZTK::enableIncludeCache(){ ZTKEnableIncludeCache( this ); }
+inline void ZTK::setTokenizer(const zTokenizerConfig *config){ ZTKSetTokenizer( this, config ); }
+inline const char *ZTK::intern(const char *str){ return ZTKIntern( this, str ); }
 inline bool ZTK::addTag(const char *tag){ return ZTKAddTag( this, tag ); }
 inline bool ZTK::addKey(const char *key){ return ZTKAddKey( this, key ); }
 inline void ZTK::delKey(){ ZTKDelKey( this ); }
@@ -237,13 +822,22 @@ inline bool ZTK::addVal(const char *val){ return ZTKAddVal( this, val ); }
 inline bool ZTK::addInt(const int val){ return ZTKAddInt( this, val ); }
 inline bool ZTK::addDouble(const double val){ return ZTKAddDouble( this, val ); }
 inline bool ZTK::parseFP(FILE *fp){ return ZTKParseFP( this, fp ); }
+inline bool ZTK::parseMem(const char *buf, size_t len){ return ZTKParseMem( this, buf, len ); }
 inline bool ZTK::parse(const char *path){ return ZTKParse( this, path ); }
+inline bool ZTK::reload(){ return ZTKReload( this ); }
+inline bool ZTK::readCache(const char *path){ return ZTKReadCache( this, path ); }
+inline bool ZTK::readCacheRaw(const char *path, bool *stale){ return ZTKReadCacheRaw( this, path, stale ); }
+inline bool ZTK::writeCache(const char *path){ return ZTKWriteCache( this, path ); }
 inline int  ZTK::countTag(const char *tag){ return ZTKCountTag( this, tag ); }
 inline int  ZTK::countKey(const char *key){ return ZTKCountKey( this, key ); }
-inline zStrListCell *ZTK::valptr(){ return ZTKValPtr( this ); }
+inline ZTKTagFieldListCell *ZTK::findTag(const char *tag){ return ZTKFindTag( this, tag ); }
+inline ZTKTagFieldListCell *ZTK::findNextTag(){ return ZTKFindNextTag( this ); }
+inline ZTKKeyFieldListCell *ZTK::findKey(const char *key){ return ZTKFindKey( this, key ); }
+inline ZTKKeyFieldListCell *ZTK::findNextKey(){ return ZTKFindNextKey( this ); }
+inline const char *ZTK::valptr(){ return ZTKValPtr( this ); }
 inline const char *ZTK::val(){ return ZTKVal( this ); }
-inline zStrListCell *ZTK::nextVal(){ return ZTKValNext( this ); }
-inline zStrListCell *ZTK::rewindVal(){ return ZTKValRewind( this ); }
+inline const char *ZTK::nextVal(){ return ZTKValNext( this ); }
+inline const char *ZTK::rewindVal(){ return ZTKValRewind( this ); }
 inline bool ZTK::cmpVal(const char *str){ return ZTKValCmp( this, str ); }
 inline const char *ZTK::key(){ return ZTKKey( this ); }
 inline int ZTK::keyFieldSize(){ return ZTKKeyFieldSize( this ); }
@@ -257,8 +851,13 @@ inline bool ZTK::cmpTag(const char *str){ return ZTKTagCmp( this, str ); }
 inline void ZTK::rewind(){ rewindTag(); }
 inline int ZTK::getInt(){ return ZTKInt( this ); }
 inline double ZTK::getDouble(){ return ZTKDouble( this ); }
+inline int ZTK::getIntN(int *val, int n){ return ZTKIntN( this, val, n ); }
+inline int ZTK::getDoubleN(double *val, int n){ return ZTKDoubleN( this, val, n ); }
+inline ZTKNumBlock *ZTK::numBlock(){ return ZTKKeyNumBlock( this ); }
 inline void ZTK::fprintf(FILE *fp){ ZTKFPrint( fp, this ); }
 inline void ZTK::printf(){ ZTKPrint( this ); }
+inline ZTKStats *ZTK::getStats(ZTKStats *stats){ return ZTKGetStats( this, stats ); }
+inline void ZTK::resetStats(){ ZTKResetStats( this ); }
 #endif
 
 /* ********************************************************** */
@@ -270,6 +869,7 @@ ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKPrp ){
   int num; /*!< the number of tags/keys */
   void *(* _eval)(void *, int, void *, ZTK *); /*!< ZTK evaluation function */
   bool (* _fprint)(FILE *, int, void *); /*!< print out function */
+  bool parallel; /*!< evaluation is thread-safe and independent of order (see ZTKEvalTagParallel()) */
 };
 
 #define _ZTKPrpNum(prp) ( sizeof(prp) / sizeof(ZTKPrp) )
@@ -283,11 +883,41 @@ __ZEDA_EXPORT ZTKPrp *ZTKPrpDup(const ZTKPrp *src, size_t prpnum);
 /*! \brief set number of a ZTK property with the specified string. */
 __ZEDA_EXPORT bool ZTKPrpSetNum(ZTKPrp *prp, size_t prpnum, const char *str, int num);
 
+/*! \brief intern strings of an array of ZTKPrp in a ZTK format processor.
+ *
+ * ZTKPrpIntern() replaces the strings of an array of ZTK properties \a prp with those
+ * interned in a ZTK format processor \a ztk by ZTKIntern(). \a prpnum is the size of
+ * \a prp. Then, ZTKEvalKey() with \a prp and \a ztk matches keys with the properties by
+ * comparisons of pointers instead of strcmp().
+ *
+ * Since \a prp is modified, it has to be a mutable array, e.g. a copy made by ZTKPrpDup().
+ * The interned strings are valid until \a ztk is destroyed, so that \a prp cannot be used
+ * after that.
+ * \return
+ * ZTKPrpIntern() returns the true value if it succeeds. If it fails to allocate memory,
+ * the false value is returned.
+ */
+__ZEDA_EXPORT bool ZTKPrpIntern(ZTK *ztk, ZTKPrp prp[], size_t prpnum);
+#define _ZTKPrpIntern(ztk,prp) ZTKPrpIntern( ztk, prp, _ZTKPrpNum(prp) )
+
 /* evaluate a key field of a ZTK format processor based on a ZTK property. */
 __ZEDA_EXPORT void *ZTKEvalKey(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum);
 #define _ZTKEvalKey(obj,arg,ztk,prp) ZTKEvalKey( obj, arg, ztk, prp, _ZTKPrpNum(prp) )
 
-/* print out a key field of a ZTK format processor based on a ZTK property. */
+/*! \brief print out a key field of a ZTK format processor based on a ZTK property.
+ *
+ * ZTKPrpKeyWrite() writes key fields of an object \a obj to a buffered writer \a writer by
+ * the print out functions of an array of ZTK properties \a prp. \a prpnum is the size of
+ * \a prp. If a print out function returns the false value, the key field is rolled back by
+ * ZTKWriterRollback().
+ * ZTKPrpKeyFPrint() does the same through a buffered writer to a file stream \a fp. If the
+ * writer cannot be opened, it prints out directly to \a fp, where key fields are not rolled back.
+ * \return
+ * ZTKPrpKeyWrite() returns the false value if it fails to write contents to the destination.
+ * Otherwise, the true value is returned.
+ */
+__ZEDA_EXPORT bool ZTKPrpKeyWrite(ZTKWriter *writer, void *obj, const ZTKPrp prp[], size_t prpnum);
+#define _ZTKPrpKeyWrite(writer,obj,prp) ZTKPrpKeyWrite( writer, obj, prp, _ZTKPrpNum(prp) )
 __ZEDA_EXPORT void ZTKPrpKeyFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum);
 #define _ZTKPrpKeyFPrint(fp,obj,prp) ZTKPrpKeyFPrint( fp, obj, prp, _ZTKPrpNum(prp) )
 
@@ -295,12 +925,252 @@ __ZEDA_EXPORT void ZTKPrpKeyFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size
 __ZEDA_EXPORT void *ZTKEvalTag(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum);
 #define _ZTKEvalTag(obj,arg,ztk,prp) ZTKEvalTag( obj,arg, ztk, prp, _ZTKPrpNum(prp) )
 
-/* print out a tag field of a ZTK format processor based on a ZTK property. */
+/*! \brief evaluate a tag field of a ZTK format processor based on a ZTK property in parallel.
+ *
+ * ZTKEvalTagParallel() works in the same way with ZTKEvalTag(), except that the tagged fields
+ * associated with a property whose member \a parallel is the true value are evaluated on
+ * \a threadnum threads (including the calling thread) concurrently. The evaluation function
+ * of the property is given a copy of \a ztk at the tagged field, and the same index that
+ * ZTKEvalTag() gives, namely, the order of appearance of the tagged field. All evaluations
+ * for a property finish before the next property is evaluated. The other properties are
+ * evaluated serially in the same way with ZTKEvalTag().
+ *
+ * The evaluation function of a property with \a parallel has to be thread-safe. It can look
+ * up keys and values of the given tagged field, while it should not move to another tagged
+ * field nor modify the tag-and-key list.
+ * \return
+ * ZTKEvalTagParallel() returns \a obj if it succeeds. If any evaluation function fails,
+ * the null pointer is returned.
+ * \notes
+ * The tagged fields are evaluated concurrently only if ZEDA is built with CONFIG_USE_PTHREAD=y.
+ * Otherwise, ZTKEvalTagParallel() is the same with ZTKEvalTag().
+ */
+__ZEDA_EXPORT void *ZTKEvalTagParallel(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum, int threadnum);
+#define _ZTKEvalTagParallel(obj,arg,ztk,prp,threadnum) ZTKEvalTagParallel( obj, arg, ztk, prp, _ZTKPrpNum(prp), threadnum )
+
+/*! \brief print out a tag field of a ZTK format processor based on a ZTK property.
+ *
+ * ZTKPrpTagWrite() writes tagged fields of an object \a obj to a buffered writer \a writer
+ * by the print out functions of an array of ZTK properties \a prp. \a prpnum is the size of
+ * \a prp. The print out functions are given ZTKWriterFP() of \a writer.
+ * ZTKPrpTagFPrint() does the same through a buffered writer to a file stream \a fp. If the
+ * writer cannot be opened, it prints out directly to \a fp.
+ * \return
+ * ZTKPrpTagWrite() returns the false value if it fails to write contents to the destination.
+ * Otherwise, the true value is returned.
+ */
+__ZEDA_EXPORT bool ZTKPrpTagWrite(ZTKWriter *writer, void *obj, const ZTKPrp prp[], size_t prpnum);
+#define _ZTKPrpTagWrite(writer,obj,prp) ZTKPrpTagWrite( writer, obj, prp, _ZTKPrpNum(prp) )
 __ZEDA_EXPORT void ZTKPrpTagFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum);
 #define _ZTKPrpTagFPrint(fp,obj,prp) ZTKPrpTagFPrint( fp, obj, prp, _ZTKPrpNum(prp) )
 
+/* ********************************************************** */
+/*! \struct ZTKPrpTable
+ * \brief compiled table of ZTK properties.
+ *
+ * A compiled table of ZTK properties is a hash table built from an array of ZTKPrp once,
+ * through which the property associated with a tag/key is directly looked up instead of
+ * comparing the tag/key with all strings of the properties.
+ *//* ******************************************************* */
+ZDEF_STRUCT( __ZEDA_CLASS_EXPORT, ZTKPrpTable ){
+  const ZTKPrp *prp; /*!< array of properties */
+  size_t prpnum;     /*!< number of properties */
+  ulong *hash;       /*!< hash values of strings of properties */
+  uint capacity;     /*!< number of slots */
+  int *slot;         /*!< hash table of indices of properties */
+};
+
+/*! \brief compile a table of ZTK properties.
+ *
+ * ZTKPrpTableCompile() compiles a table \a table of ZTK properties from an array \a prp,
+ * where \a prpnum is the number of properties. The size of the hash table is chosen so that
+ * different strings of the properties are not hashed to the same slot if possible.
+ * Only the properties with evaluation functions are registered, and the first one precedes
+ * if the same string appears more than once, as well as ZTKEvalKey().
+ * \a table refers \a prp, so that \a prp has to be kept alive while \a table is used.
+ *
+ * ZTKPrpTableDestroy() destroys \a table.
+ *
+ * ZTKPrpTableFind() finds a property associated with a string \a str in \a table.
+ * \return
+ * ZTKPrpTableCompile() returns a pointer \a table if it succeeds. If it fails to allocate
+ * memory, the null pointer is returned.
+ *
+ * ZTKPrpTableFind() returns the index of the found property in the original array, or -1
+ * if not found.
+ */
+__ZEDA_EXPORT ZTKPrpTable *ZTKPrpTableCompile(ZTKPrpTable *table, const ZTKPrp prp[], size_t prpnum);
+#define _ZTKPrpTableCompile(table,prp) ZTKPrpTableCompile( table, prp, _ZTKPrpNum(prp) )
+__ZEDA_EXPORT void ZTKPrpTableDestroy(ZTKPrpTable *table);
+__ZEDA_EXPORT int ZTKPrpTableFind(const ZTKPrpTable *table, const char *str);
+
+/*! \brief evaluate a key/tag field of a ZTK format processor based on a compiled table of ZTK properties.
+ *
+ * ZTKEvalKeyTable() and ZTKEvalTagTable() work in the same way with ZTKEvalKey() and ZTKEvalTag(),
+ * respectively, except that they look up a compiled table \a table of ZTK properties.
+ */
+__ZEDA_EXPORT void *ZTKEvalKeyTable(void *obj, void *arg, ZTK *ztk, const ZTKPrpTable *table);
+__ZEDA_EXPORT void *ZTKEvalTagTable(void *obj, void *arg, ZTK *ztk, const ZTKPrpTable *table);
+
 __END_DECLS
 
+#if defined(__cplusplus) && __cplusplus >= 201703L
+#include <string_view>
+#include <charconv>
+#include <iterator>
+
+/* ********************************************************** */
+/* read-only ranges over a tag-and-key list of ZTK format
+ *
+ * The following classes traverse tagged fields, key fields and values of a ZTK format processor
+ * in range-based for loops, e.g.
+ *
+ *   for( auto tf : ztk.tags( "link" ) )
+ *     for( auto kf : tf.keys( "mass" ) )
+ *       for( auto val : kf.vals() ) ...
+ *
+ * Values are yielded as std::string_view pointing to the strings stored in the list without
+ * copying them. Since the current fields of the processor (tf_cp, kf_cp and val_cp) are never
+ * touched, multiple threads can read the same list at once. Fields without any values are not
+ * skipped, as opposed to ZTKTagNext() and ZTKKeyNext().
+ * The ranges are valid until the list is modified or destroyed.
+ *//* ******************************************************* */
+
+/*! \brief convert a value string of ZTK format to a number.
+ *
+ * ZTKValTo() converts a string \a str to a number \a val by std::from_chars() without copying it.
+ * A leading plus sign is allowed.
+ * \return
+ * ZTKValTo() returns the true value if the whole string is converted. Otherwise, the false value
+ * is returned, and \a val is not guaranteed to be unchanged.
+ */
+template<typename T> inline bool ZTKValTo(std::string_view str, T &val){
+  if( str.size() > 1 && str.front() == '+' ) str.remove_prefix( 1 );
+  auto [ptr, ec] = std::from_chars( str.data(), str.data() + str.size(), val );
+  return ec == std::errc() && ptr == str.data() + str.size();
+}
+#ifndef __cpp_lib_to_chars /* std::from_chars() for floating-point numbers is not available */
+template<> inline bool ZTKValTo(std::string_view str, double &val){
+  return !str.empty() && zNumParseDouble( str.data(), str.size(), &val ) == str.size();
+}
+#endif /* __cpp_lib_to_chars */
+
+/*! \brief a range of value strings of a key field of ZTK format. */
+class ZTKValRange{
+  const ZTKValList *_list;
+ public:
+  class iterator{
+    const ZTKValList *_list;
+    int _i;
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::string_view;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = std::string_view;
+    iterator(const ZTKValList *list, int i) : _list{list}, _i{i} {}
+    std::string_view operator*() const { return std::string_view( ZTKValListStr( _list, _i ), ZTKValListLen( _list, _i ) ); }
+    iterator &operator++(){ _i++; return *this; }
+    iterator operator++(int){ iterator it = *this; _i++; return it; }
+    bool operator==(const iterator &it) const { return _i == it._i; }
+    bool operator!=(const iterator &it) const { return _i != it._i; }
+  };
+  explicit ZTKValRange(const ZTKValList *list) : _list{list} {}
+  iterator begin() const { return iterator( _list, 0 ); }
+  iterator end() const { return iterator( _list, ZTKValListSize( _list ) ); }
+  int size() const { return ZTKValListSize( _list ); }
+  bool empty() const { return ZTKValListSize( _list ) == 0; }
+  std::string_view operator[](int i) const { return std::string_view( ZTKValListStr( _list, i ), ZTKValListLen( _list, i ) ); }
+};
+
+/*! \brief a range of fields of ZTK format.
+ *
+ * The fields are traversed either along a list in order of parsing, or along a chain of fields
+ * with the same tag or key linked by \a sibling member.
+ */
+template<typename Field, typename Cell, typename List, typename View> class ZTKFieldRange{
+ public:
+  class iterator{
+    const Field *_fp;
+    const Cell *_cp;   /* current cell in a list */
+    const Cell *_root; /* root of a list, or the null pointer for a chain */
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = View;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = View;
+    iterator(const Field *fp) : _fp{fp}, _cp{nullptr}, _root{nullptr} {}
+    iterator(const Cell *cp, const Cell *root) : _fp{&cp->data}, _cp{cp}, _root{root} {}
+    View operator*() const { return View( _fp ); }
+    iterator &operator++(){
+      if( _root ){
+        _cp = _cp->next;
+        _fp = &_cp->data;
+      } else
+        _fp = _fp->sibling;
+      return *this;
+    }
+    iterator operator++(int){ iterator it = *this; ++*this; return it; }
+    bool operator==(const iterator &it) const { return _fp == it._fp; }
+    bool operator!=(const iterator &it) const { return _fp != it._fp; }
+  };
+ private:
+  iterator _begin, _end;
+ public:
+  explicit ZTKFieldRange(const List *list) : _begin{ list->root.next, &list->root }, _end{ &list->root, &list->root } {}
+  explicit ZTKFieldRange(const Field *fp) : _begin{ fp }, _end{ static_cast<const Field *>( nullptr ) } {}
+  iterator begin() const { return _begin; }
+  iterator end() const { return _end; }
+  bool empty() const { return _begin == _end; }
+};
+
+/*! \brief a read-only view of a key field of ZTK format. */
+class ZTKKeyView{
+  const ZTKKeyField *_kf;
+ public:
+  explicit ZTKKeyView(const ZTKKeyField *kf) : _kf{kf} {}
+  const ZTKKeyField *field() const { return _kf; }
+  std::string_view key() const { return _kf->key; }
+  ZTKValRange vals() const { return ZTKValRange( &_kf->vallist ); }
+  /*! \brief convert at most \a n values from the head to numbers, which returns the number of converted values. */
+  template<typename T> int getN(T *val, int n) const {
+    ZTKValRange range = vals();
+    int i;
+
+    for( i=0; i<n && i<range.size(); i++ )
+      if( !ZTKValTo( range[i], val[i] ) ) break;
+    return i;
+  }
+};
+
+/*! \brief a range of key fields of ZTK format. */
+class ZTKKeyRange : public ZTKFieldRange<ZTKKeyField,ZTKKeyFieldListCell,ZTKKeyFieldList,ZTKKeyView>{
+ public:
+  using ZTKFieldRange::ZTKFieldRange;
+};
+
+/*! \brief a read-only view of a tagged field of ZTK format. */
+class ZTKTagView{
+  const ZTKTagField *_tf;
+ public:
+  explicit ZTKTagView(const ZTKTagField *tf) : _tf{tf} {}
+  const ZTKTagField *field() const { return _tf; }
+  std::string_view tag() const { return _tf->tag; }
+  ZTKKeyRange keys() const { return ZTKKeyRange( &_tf->kflist ); }
+  ZTKKeyRange keys(const char *key) const { return ZTKKeyRange( ZTKFindKeyField( _tf, key ) ); }
+};
+
+/*! \brief a range of tagged fields of ZTK format. */
+class ZTKTagRange : public ZTKFieldRange<ZTKTagField,ZTKTagFieldListCell,ZTKTagFieldList,ZTKTagView>{
+ public:
+  using ZTKFieldRange::ZTKFieldRange;
+};
+
+inline ZTKTagRange ZTK::tags() const { return ZTKTagRange( &tflist ); }
+inline ZTKTagRange ZTK::tags(const char *tag) const { return ZTKTagRange( ZTKFindTagField( this, tag ) ); }
+#endif /* __cplusplus >= 201703L */
+
 #endif /* __KERNEL__ */
 
 #endif /* __ZEDA_ZTK_H__ */
@@ -64,7 +64,7 @@ bool zCSVGetInt(zCSV *csv, int *val)
     ZRUNWARN( ZEDA_WARN_CSV_FIELD_EMPTY );
     return false;
   }
-  *val = atoi( field );
+  zNumParseInt( field, strlen(field), val );
   return true;
 }
 
@@ -87,7 +87,7 @@ bool zCSVGetDouble(zCSV *csv, double *val)
     ZRUNWARN( ZEDA_WARN_CSV_FIELD_EMPTY );
     return false;
   }
-  *val = atof( field );
+  zNumParseDouble( field, strlen(field), val );
   return true;
 }
 
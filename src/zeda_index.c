@@ -273,7 +273,7 @@ zIndex zIndexFScan(FILE *fp)
   }
   if( !( idx = zIndexCreate( size ) ) ) return NULL;
   for( i=0; i<size; i++ ){
-    if( zFInt( fp, zArrayElemNC(idx,i) ) ){
+    if( !zFInt( fp, zArrayElemNC(idx,i) ) ){
       ZRUNERROR( ZEDA_WARN_INDEX_OVERSIZE, i, size );
       break;
     }
@@ -284,26 +284,43 @@ zIndex zIndexFScan(FILE *fp)
 /* print out components of an integer vector to a file. */
 void zIndexDataFPrint(FILE *fp, zIndex idx)
 {
+  char buf[BUFSIZ], *cp = buf;
   int i;
 
   if( !idx ) return;
-  for( i=0; i<zIndexSizeNC(idx); i++ )
-    fprintf( fp, "%d ", zIndexElemNC(idx,i) );
-  fprintf( fp, "\n" );
+  for( i=0; i<zIndexSizeNC(idx); i++ ){
+    if( cp - buf > BUFSIZ - ZEDA_NUM_INT_BUFSIZ - 2 ){ /* flush the formatted values */
+      fwrite( buf, 1, cp - buf, fp );
+      cp = buf;
+    }
+    cp += zNumFormatInt( zIndexElemNC(idx,i), cp );
+    *cp++ = ' ';
+  }
+  *cp++ = '\n';
+  fwrite( buf, 1, cp - buf, fp );
 }
 
 /* print out an integer vector to a file. */
 void zIndexFPrint(FILE *fp, zIndex idx)
 {
+  char buf[BUFSIZ], *cp;
   int i;
 
   if( !idx )
     fprintf( fp, "(null integer vector)\n" );
   else{
-    fprintf( fp, "%d (", zIndexSizeNC(idx) );
-    for( i=0; i<zIndexSizeNC(idx); i++ )
-      fprintf( fp, " %d", zIndexElemNC(idx,i) );
-    fprintf( fp, " )\n" );
+    cp = buf + zNumFormatInt( zIndexSizeNC(idx), buf );
+    *cp++ = ' '; *cp++ = '(';
+    for( i=0; i<zIndexSizeNC(idx); i++ ){
+      if( cp - buf > BUFSIZ - ZEDA_NUM_INT_BUFSIZ - 4 ){ /* flush the formatted values */
+        fwrite( buf, 1, cp - buf, fp );
+        cp = buf;
+      }
+      *cp++ = ' ';
+      cp += zNumFormatInt( zIndexElemNC(idx,i), cp );
+    }
+    strcpy( cp, " )\n" );
+    fwrite( buf, 1, cp - buf + 3, fp );
   }
 }
 #else
@@ -4,7 +4,12 @@
  * zeda_misc - miscellanies.
  */
 
+#if !defined( _WIN32 ) && !defined( _POSIX_C_SOURCE )
+#define _POSIX_C_SOURCE 200809L /* for st_mtim of struct stat */
+#endif
+
 #include <zeda/zeda_misc.h>
+#include <zeda/zeda_number.h>
 
 /* entry point for MS-Windows .dll */
 #ifdef __WINDOWS__
@@ -53,6 +58,93 @@ void *zCloneMem(const void *src, size_t size)
   return memcpy( dest, src, size );
 }
 
+#ifndef __KERNEL__
+/* alignment of memory spaces allocated from a memory arena. */
+typedef union{
+  long l;
+  double d;
+  void *p;
+  void (* f)(void);
+} _zArenaAlign;
+#define _zArenaAlignSize(size) ( ( (size) + sizeof(_zArenaAlign) - 1 ) / sizeof(_zArenaAlign) * sizeof(_zArenaAlign) )
+
+/* the head of the data area of a block of a memory arena. */
+#define _zArenaBlockData(block) ( (char *)(block) + _zArenaAlignSize( sizeof(zArenaBlock) ) )
+
+/* initialize a memory arena. */
+zArena *zArenaInit(zArena *arena, size_t blocksize)
+{
+  arena->block = NULL;
+  arena->blocksize = blocksize > 0 ? blocksize : ZARENA_DEFAULT_BLOCKSIZE;
+  return arena;
+}
+
+/* add a new block to a memory arena. */
+static zArenaBlock *_zArenaAddBlock(zArena *arena, size_t size)
+{
+  zArenaBlock *block;
+  bool dedicated;
+
+  if( !( dedicated = size > arena->blocksize ) ) size = arena->blocksize;
+  if( !( block = (zArenaBlock *)malloc( _zArenaAlignSize( sizeof(zArenaBlock) ) + size ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  block->size = size;
+  block->used = 0;
+  if( dedicated && arena->block ){
+    /* a large memory space occupies a dedicated block, and the latest block is kept active. */
+    block->used = size;
+    block->prev = arena->block->prev;
+    arena->block->prev = block;
+    return block;
+  }
+  block->prev = arena->block;
+  return arena->block = block;
+}
+
+/* allocate memory from a memory arena. */
+void *zArenaAlloc(zArena *arena, size_t size)
+{
+  zArenaBlock *block;
+  void *mem;
+
+  size = _zArenaAlignSize( size > 0 ? size : 1 );
+  if( !( block = arena->block ) || block->size - block->used < size ){
+    if( !( block = _zArenaAddBlock( arena, size ) ) ) return NULL;
+    if( block != arena->block ){ /* a dedicated block for a large memory space */
+      return memset( _zArenaBlockData(block), 0, size );
+    }
+  }
+  mem = _zArenaBlockData(block) + block->used;
+  block->used += size;
+  return memset( mem, 0, size );
+}
+
+/* clone a string into a memory arena. */
+char *zArenaStrCloneN(zArena *arena, const char *str, size_t len)
+{
+  char *dest;
+
+  if( !str ) return NULL;
+  if( !( dest = (char *)zArenaAlloc( arena, len+1 ) ) ) return NULL;
+  memcpy( dest, str, len );
+  dest[len] = '\0';
+  return dest;
+}
+
+/* destroy a memory arena. */
+void zArenaDestroy(zArena *arena)
+{
+  zArenaBlock *block;
+
+  while( ( block = arena->block ) ){
+    arena->block = block->prev;
+    free( block );
+  }
+}
+#endif /* __KERNEL__ */
+
 /* ********************************************************** */
 /* file stream operations.
  * ********************************************************** */
@@ -118,6 +210,47 @@ bool zFileIsIdent(FILE *fp1, FILE *fp2)
 }
 #endif /* __KERNEL__ */
 
+#ifndef __KERNEL__
+/* copy a stamp of a file from its status. */
+static void _zFileStampFromStat(zFileStamp *stamp, struct stat *st)
+{
+  stamp->dev = (ulong)st->st_dev;
+  stamp->ino = (ulong)st->st_ino;
+  stamp->mtime = (ulong)st->st_mtime;
+#if defined( __APPLE__ )
+  stamp->mtime_nsec = (ulong)st->st_mtimespec.tv_nsec;
+#elif !defined( __WINDOWS__ ) && defined( _POSIX_C_SOURCE ) && _POSIX_C_SOURCE >= 200809L
+  stamp->mtime_nsec = (ulong)st->st_mtim.tv_nsec;
+#else
+  stamp->mtime_nsec = 0; /* not available */
+#endif /* __APPLE__ */
+  stamp->size = (ulong)st->st_size;
+}
+
+/* get a stamp of a file. */
+bool zFileStampGet(FILE *fp, zFileStamp *stamp)
+{
+  struct stat st;
+
+  if( fstat( fileno( fp ), &st ) != 0 ){
+    ZRUNERROR( ZEDA_ERR_CANNOTGETFILESTAT );
+    return false;
+  }
+  _zFileStampFromStat( stamp, &st );
+  return true;
+}
+
+/* get a stamp of a file specified by its path. */
+bool zFileStampGetPath(const char *path, zFileStamp *stamp)
+{
+  struct stat st;
+
+  if( stat( path, &st ) != 0 ) return false;
+  _zFileStampFromStat( stamp, &st );
+  return true;
+}
+#endif /* __KERNEL__ */
+
 #ifndef __KERNEL__
 /* compare two files. */
 long zFileCompare(const char *filename1, const char *filename2)
@@ -204,7 +337,7 @@ char *zI2A(int val, char *buf)
     *cp = '\0';
   }
 #else
-  sprintf( buf, "%d", val );
+  zNumFormatInt( val, buf );
 #endif /* __KERNEL__ */
   return buf;
 }
@@ -289,7 +422,7 @@ char *zF2A(double val, char *buf)
     }
   }
 #else
-  sprintf( buf, "%.10g", val );
+  zNumFormatDouble( val, buf );
 #endif /* __KERNEL__ */
   return buf;
 }
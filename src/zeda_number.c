@@ -0,0 +1,1861 @@
+/* ZEDA - Elementary Data and Algorithms
+ * Copyright (C) 1998 Tomomichi Sugihara (Zhidao)
+ *
+ * zeda_number - conversion between numbers and strings.
+ */
+
+#include <zeda/zeda_number.h>
+#include <ctype.h>
+#include <float.h>
+#include <limits.h>
+#include <locale.h>
+#include <math.h>
+
+/* ********************************************************** */
+/* parse numbers in strings.
+ *//* ******************************************************* */
+
+/* 64-bit unsigned integer composed of upper and lower 32 bits */
+#define _zNumU64(hi,lo) ( (uint64_t)(hi) << 32 | (uint64_t)(lo) )
+
+/* 128-bit unsigned integer */
+typedef struct{
+  uint64_t hi, lo;
+} _zNumU128;
+
+/* 128-bit approximations of powers of five 5^q (-342<=q<=308), normalized so that the most
+ * significant bit is set. Negative powers are rounded up, and positive ones are truncated. */
+#define ZEDA_NUM_POW5_MIN (-342)
+#define ZEDA_NUM_POW5_MAX   308
+static const _zNumU128 _znum_pow5[] = {
+  { _zNumU64(0xeef453d6,0x923bd65a), _zNumU64(0x113faa29,0x06a13b3f) },
+  { _zNumU64(0x9558b466,0x1b6565f8), _zNumU64(0x4ac7ca59,0xa424c507) },
+  { _zNumU64(0xbaaee17f,0xa23ebf76), _zNumU64(0x5d79bcf0,0x0d2df649) },
+  { _zNumU64(0xe95a99df,0x8ace6f53), _zNumU64(0xf4d82c2c,0x107973dc) },
+  { _zNumU64(0x91d8a02b,0xb6c10594), _zNumU64(0x79071b9b,0x8a4be869) },
+  { _zNumU64(0xb64ec836,0xa47146f9), _zNumU64(0x9748e282,0x6cdee284) },
+  { _zNumU64(0xe3e27a44,0x4d8d98b7), _zNumU64(0xfd1b1b23,0x08169b25) },
+  { _zNumU64(0x8e6d8c6a,0xb0787f72), _zNumU64(0xfe30f0f5,0xe50e20f7) },
+  { _zNumU64(0xb208ef85,0x5c969f4f), _zNumU64(0xbdbd2d33,0x5e51a935) },
+  { _zNumU64(0xde8b2b66,0xb3bc4723), _zNumU64(0xad2c7880,0x35e61382) },
+  { _zNumU64(0x8b16fb20,0x3055ac76), _zNumU64(0x4c3bcb50,0x21afcc31) },
+  { _zNumU64(0xaddcb9e8,0x3c6b1793), _zNumU64(0xdf4abe24,0x2a1bbf3d) },
+  { _zNumU64(0xd953e862,0x4b85dd78), _zNumU64(0xd71d6dad,0x34a2af0d) },
+  { _zNumU64(0x87d4713d,0x6f33aa6b), _zNumU64(0x8672648c,0x40e5ad68) },
+  { _zNumU64(0xa9c98d8c,0xcb009506), _zNumU64(0x680efdaf,0x511f18c2) },
+  { _zNumU64(0xd43bf0ef,0xfdc0ba48), _zNumU64(0x0212bd1b,0x2566def2) },
+  { _zNumU64(0x84a57695,0xfe98746d), _zNumU64(0x014bb630,0xf7604b57) },
+  { _zNumU64(0xa5ced43b,0x7e3e9188), _zNumU64(0x419ea3bd,0x35385e2d) },
+  { _zNumU64(0xcf42894a,0x5dce35ea), _zNumU64(0x52064cac,0x828675b9) },
+  { _zNumU64(0x818995ce,0x7aa0e1b2), _zNumU64(0x7343efeb,0xd1940993) },
+  { _zNumU64(0xa1ebfb42,0x19491a1f), _zNumU64(0x1014ebe6,0xc5f90bf8) },
+  { _zNumU64(0xca66fa12,0x9f9b60a6), _zNumU64(0xd41a26e0,0x77774ef6) },
+  { _zNumU64(0xfd00b897,0x478238d0), _zNumU64(0x8920b098,0x955522b4) },
+  { _zNumU64(0x9e20735e,0x8cb16382), _zNumU64(0x55b46e5f,0x5d5535b0) },
+  { _zNumU64(0xc5a89036,0x2fddbc62), _zNumU64(0xeb2189f7,0x34aa831d) },
+  { _zNumU64(0xf712b443,0xbbd52b7b), _zNumU64(0xa5e9ec75,0x01d523e4) },
+  { _zNumU64(0x9a6bb0aa,0x55653b2d), _zNumU64(0x47b233c9,0x2125366e) },
+  { _zNumU64(0xc1069cd4,0xeabe89f8), _zNumU64(0x999ec0bb,0x696e840a) },
+  { _zNumU64(0xf148440a,0x256e2c76), _zNumU64(0xc00670ea,0x43ca250d) },
+  { _zNumU64(0x96cd2a86,0x5764dbca), _zNumU64(0x38040692,0x6a5e5728) },
+  { _zNumU64(0xbc807527,0xed3e12bc), _zNumU64(0xc6050837,0x04f5ecf2) },
+  { _zNumU64(0xeba09271,0xe88d976b), _zNumU64(0xf7864a44,0xc633682e) },
+  { _zNumU64(0x93445b87,0x31587ea3), _zNumU64(0x7ab3ee6a,0xfbe0211d) },
+  { _zNumU64(0xb8157268,0xfdae9e4c), _zNumU64(0x5960ea05,0xbad82964) },
+  { _zNumU64(0xe61acf03,0x3d1a45df), _zNumU64(0x6fb92487,0x298e33bd) },
+  { _zNumU64(0x8fd0c162,0x06306bab), _zNumU64(0xa5d3b6d4,0x79f8e056) },
+  { _zNumU64(0xb3c4f1ba,0x87bc8696), _zNumU64(0x8f48a489,0x9877186c) },
+  { _zNumU64(0xe0b62e29,0x29aba83c), _zNumU64(0x331acdab,0xfe94de87) },
+  { _zNumU64(0x8c71dcd9,0xba0b4925), _zNumU64(0x9ff0c08b,0x7f1d0b14) },
+  { _zNumU64(0xaf8e5410,0x288e1b6f), _zNumU64(0x07ecf0ae,0x5ee44dd9) },
+  { _zNumU64(0xdb71e914,0x32b1a24a), _zNumU64(0xc9e82cd9,0xf69d6150) },
+  { _zNumU64(0x892731ac,0x9faf056e), _zNumU64(0xbe311c08,0x3a225cd2) },
+  { _zNumU64(0xab70fe17,0xc79ac6ca), _zNumU64(0x6dbd630a,0x48aaf406) },
+  { _zNumU64(0xd64d3d9d,0xb981787d), _zNumU64(0x092cbbcc,0xdad5b108) },
+  { _zNumU64(0x85f04682,0x93f0eb4e), _zNumU64(0x25bbf560,0x08c58ea5) },
+  { _zNumU64(0xa76c5823,0x38ed2621), _zNumU64(0xaf2af2b8,0x0af6f24e) },
+  { _zNumU64(0xd1476e2c,0x07286faa), _zNumU64(0x1af5af66,0x0db4aee1) },
+  { _zNumU64(0x82cca4db,0x847945ca), _zNumU64(0x50d98d9f,0xc890ed4d) },
+  { _zNumU64(0xa37fce12,0x6597973c), _zNumU64(0xe50ff107,0xbab528a0) },
+  { _zNumU64(0xcc5fc196,0xfefd7d0c), _zNumU64(0x1e53ed49,0xa96272c8) },
+  { _zNumU64(0xff77b1fc,0xbebcdc4f), _zNumU64(0x25e8e89c,0x13bb0f7a) },
+  { _zNumU64(0x9faacf3d,0xf73609b1), _zNumU64(0x77b19161,0x8c54e9ac) },
+  { _zNumU64(0xc795830d,0x75038c1d), _zNumU64(0xd59df5b9,0xef6a2417) },
+  { _zNumU64(0xf97ae3d0,0xd2446f25), _zNumU64(0x4b057328,0x6b44ad1d) },
+  { _zNumU64(0x9becce62,0x836ac577), _zNumU64(0x4ee367f9,0x430aec32) },
+  { _zNumU64(0xc2e801fb,0x244576d5), _zNumU64(0x229c41f7,0x93cda73f) },
+  { _zNumU64(0xf3a20279,0xed56d48a), _zNumU64(0x6b435275,0x78c1110f) },
+  { _zNumU64(0x9845418c,0x345644d6), _zNumU64(0x830a1389,0x6b78aaa9) },
+  { _zNumU64(0xbe5691ef,0x416bd60c), _zNumU64(0x23cc986b,0xc656d553) },
+  { _zNumU64(0xedec366b,0x11c6cb8f), _zNumU64(0x2cbfbe86,0xb7ec8aa8) },
+  { _zNumU64(0x94b3a202,0xeb1c3f39), _zNumU64(0x7bf7d714,0x32f3d6a9) },
+  { _zNumU64(0xb9e08a83,0xa5e34f07), _zNumU64(0xdaf5ccd9,0x3fb0cc53) },
+  { _zNumU64(0xe858ad24,0x8f5c22c9), _zNumU64(0xd1b3400f,0x8f9cff68) },
+  { _zNumU64(0x91376c36,0xd99995be), _zNumU64(0x23100809,0xb9c21fa1) },
+  { _zNumU64(0xb5854744,0x8ffffb2d), _zNumU64(0xabd40a0c,0x2832a78a) },
+  { _zNumU64(0xe2e69915,0xb3fff9f9), _zNumU64(0x16c90c8f,0x323f516c) },
+  { _zNumU64(0x8dd01fad,0x907ffc3b), _zNumU64(0xae3da7d9,0x7f6792e3) },
+  { _zNumU64(0xb1442798,0xf49ffb4a), _zNumU64(0x99cd11cf,0xdf41779c) },
+  { _zNumU64(0xdd95317f,0x31c7fa1d), _zNumU64(0x40405643,0xd711d583) },
+  { _zNumU64(0x8a7d3eef,0x7f1cfc52), _zNumU64(0x482835ea,0x666b2572) },
+  { _zNumU64(0xad1c8eab,0x5ee43b66), _zNumU64(0xda324365,0x0005eecf) },
+  { _zNumU64(0xd863b256,0x369d4a40), _zNumU64(0x90bed43e,0x40076a82) },
+  { _zNumU64(0x873e4f75,0xe2224e68), _zNumU64(0x5a7744a6,0xe804a291) },
+  { _zNumU64(0xa90de353,0x5aaae202), _zNumU64(0x711515d0,0xa205cb36) },
+  { _zNumU64(0xd3515c28,0x31559a83), _zNumU64(0x0d5a5b44,0xca873e03) },
+  { _zNumU64(0x8412d999,0x1ed58091), _zNumU64(0xe858790a,0xfe9486c2) },
+  { _zNumU64(0xa5178fff,0x668ae0b6), _zNumU64(0x626e974d,0xbe39a872) },
+  { _zNumU64(0xce5d73ff,0x402d98e3), _zNumU64(0xfb0a3d21,0x2dc8128f) },
+  { _zNumU64(0x80fa687f,0x881c7f8e), _zNumU64(0x7ce66634,0xbc9d0b99) },
+  { _zNumU64(0xa139029f,0x6a239f72), _zNumU64(0x1c1fffc1,0xebc44e80) },
+  { _zNumU64(0xc9874347,0x44ac874e), _zNumU64(0xa327ffb2,0x66b56220) },
+  { _zNumU64(0xfbe91419,0x15d7a922), _zNumU64(0x4bf1ff9f,0x0062baa8) },
+  { _zNumU64(0x9d71ac8f,0xada6c9b5), _zNumU64(0x6f773fc3,0x603db4a9) },
+  { _zNumU64(0xc4ce17b3,0x99107c22), _zNumU64(0xcb550fb4,0x384d21d3) },
+  { _zNumU64(0xf6019da0,0x7f549b2b), _zNumU64(0x7e2a53a1,0x46606a48) },
+  { _zNumU64(0x99c10284,0x4f94e0fb), _zNumU64(0x2eda7444,0xcbfc426d) },
+  { _zNumU64(0xc0314325,0x637a1939), _zNumU64(0xfa911155,0xfefb5308) },
+  { _zNumU64(0xf03d93ee,0xbc589f88), _zNumU64(0x793555ab,0x7eba27ca) },
+  { _zNumU64(0x96267c75,0x35b763b5), _zNumU64(0x4bc1558b,0x2f3458de) },
+  { _zNumU64(0xbbb01b92,0x83253ca2), _zNumU64(0x9eb1aaed,0xfb016f16) },
+  { _zNumU64(0xea9c2277,0x23ee8bcb), _zNumU64(0x465e15a9,0x79c1cadc) },
+  { _zNumU64(0x92a1958a,0x7675175f), _zNumU64(0x0bfacd89,0xec191ec9) },
+  { _zNumU64(0xb749faed,0x14125d36), _zNumU64(0xcef980ec,0x671f667b) },
+  { _zNumU64(0xe51c79a8,0x5916f484), _zNumU64(0x82b7e127,0x80e7401a) },
+  { _zNumU64(0x8f31cc09,0x37ae58d2), _zNumU64(0xd1b2ecb8,0xb0908810) },
+  { _zNumU64(0xb2fe3f0b,0x8599ef07), _zNumU64(0x861fa7e6,0xdcb4aa15) },
+  { _zNumU64(0xdfbdcece,0x67006ac9), _zNumU64(0x67a791e0,0x93e1d49a) },
+  { _zNumU64(0x8bd6a141,0x006042bd), _zNumU64(0xe0c8bb2c,0x5c6d24e0) },
+  { _zNumU64(0xaecc4991,0x4078536d), _zNumU64(0x58fae9f7,0x73886e18) },
+  { _zNumU64(0xda7f5bf5,0x90966848), _zNumU64(0xaf39a475,0x506a899e) },
+  { _zNumU64(0x888f9979,0x7a5e012d), _zNumU64(0x6d8406c9,0x52429603) },
+  { _zNumU64(0xaab37fd7,0xd8f58178), _zNumU64(0xc8e5087b,0xa6d33b83) },
+  { _zNumU64(0xd5605fcd,0xcf32e1d6), _zNumU64(0xfb1e4a9a,0x90880a64) },
+  { _zNumU64(0x855c3be0,0xa17fcd26), _zNumU64(0x5cf2eea0,0x9a55067f) },
+  { _zNumU64(0xa6b34ad8,0xc9dfc06f), _zNumU64(0xf42faa48,0xc0ea481e) },
+  { _zNumU64(0xd0601d8e,0xfc57b08b), _zNumU64(0xf13b94da,0xf124da26) },
+  { _zNumU64(0x823c1279,0x5db6ce57), _zNumU64(0x76c53d08,0xd6b70858) },
+  { _zNumU64(0xa2cb1717,0xb52481ed), _zNumU64(0x54768c4b,0x0c64ca6e) },
+  { _zNumU64(0xcb7ddcdd,0xa26da268), _zNumU64(0xa9942f5d,0xcf7dfd09) },
+  { _zNumU64(0xfe5d5415,0x0b090b02), _zNumU64(0xd3f93b35,0x435d7c4c) },
+  { _zNumU64(0x9efa548d,0x26e5a6e1), _zNumU64(0xc47bc501,0x4a1a6daf) },
+  { _zNumU64(0xc6b8e9b0,0x709f109a), _zNumU64(0x359ab641,0x9ca1091b) },
+  { _zNumU64(0xf867241c,0x8cc6d4c0), _zNumU64(0xc30163d2,0x03c94b62) },
+  { _zNumU64(0x9b407691,0xd7fc44f8), _zNumU64(0x79e0de63,0x425dcf1d) },
+  { _zNumU64(0xc2109436,0x4dfb5636), _zNumU64(0x985915fc,0x12f542e4) },
+  { _zNumU64(0xf294b943,0xe17a2bc4), _zNumU64(0x3e6f5b7b,0x17b2939d) },
+  { _zNumU64(0x979cf3ca,0x6cec5b5a), _zNumU64(0xa705992c,0xeecf9c42) },
+  { _zNumU64(0xbd8430bd,0x08277231), _zNumU64(0x50c6ff78,0x2a838353) },
+  { _zNumU64(0xece53cec,0x4a314ebd), _zNumU64(0xa4f8bf56,0x35246428) },
+  { _zNumU64(0x940f4613,0xae5ed136), _zNumU64(0x871b7795,0xe136be99) },
+  { _zNumU64(0xb9131798,0x99f68584), _zNumU64(0x28e2557b,0x59846e3f) },
+  { _zNumU64(0xe757dd7e,0xc07426e5), _zNumU64(0x331aeada,0x2fe589cf) },
+  { _zNumU64(0x9096ea6f,0x3848984f), _zNumU64(0x3ff0d2c8,0x5def7621) },
+  { _zNumU64(0xb4bca50b,0x065abe63), _zNumU64(0x0fed077a,0x756b53a9) },
+  { _zNumU64(0xe1ebce4d,0xc7f16dfb), _zNumU64(0xd3e84959,0x12c62894) },
+  { _zNumU64(0x8d3360f0,0x9cf6e4bd), _zNumU64(0x64712dd7,0xabbbd95c) },
+  { _zNumU64(0xb080392c,0xc4349dec), _zNumU64(0xbd8d794d,0x96aacfb3) },
+  { _zNumU64(0xdca04777,0xf541c567), _zNumU64(0xecf0d7a0,0xfc5583a0) },
+  { _zNumU64(0x89e42caa,0xf9491b60), _zNumU64(0xf41686c4,0x9db57244) },
+  { _zNumU64(0xac5d37d5,0xb79b6239), _zNumU64(0x311c2875,0xc522ced5) },
+  { _zNumU64(0xd77485cb,0x25823ac7), _zNumU64(0x7d633293,0x366b828b) },
+  { _zNumU64(0x86a8d39e,0xf77164bc), _zNumU64(0xae5dff9c,0x02033197) },
+  { _zNumU64(0xa8530886,0xb54dbdeb), _zNumU64(0xd9f57f83,0x0283fdfc) },
+  { _zNumU64(0xd267caa8,0x62a12d66), _zNumU64(0xd072df63,0xc324fd7b) },
+  { _zNumU64(0x8380dea9,0x3da4bc60), _zNumU64(0x4247cb9e,0x59f71e6d) },
+  { _zNumU64(0xa4611653,0x8d0deb78), _zNumU64(0x52d9be85,0xf074e608) },
+  { _zNumU64(0xcd795be8,0x70516656), _zNumU64(0x67902e27,0x6c921f8b) },
+  { _zNumU64(0x806bd971,0x4632dff6), _zNumU64(0x00ba1cd8,0xa3db53b6) },
+  { _zNumU64(0xa086cfcd,0x97bf97f3), _zNumU64(0x80e8a40e,0xccd228a4) },
+  { _zNumU64(0xc8a883c0,0xfdaf7df0), _zNumU64(0x6122cd12,0x8006b2cd) },
+  { _zNumU64(0xfad2a4b1,0x3d1b5d6c), _zNumU64(0x796b8057,0x20085f81) },
+  { _zNumU64(0x9cc3a6ee,0xc6311a63), _zNumU64(0xcbe33036,0x74053bb0) },
+  { _zNumU64(0xc3f490aa,0x77bd60fc), _zNumU64(0xbedbfc44,0x11068a9c) },
+  { _zNumU64(0xf4f1b4d5,0x15acb93b), _zNumU64(0xee92fb55,0x15482d44) },
+  { _zNumU64(0x99171105,0x2d8bf3c5), _zNumU64(0x751bdd15,0x2d4d1c4a) },
+  { _zNumU64(0xbf5cd546,0x78eef0b6), _zNumU64(0xd262d45a,0x78a0635d) },
+  { _zNumU64(0xef340a98,0x172aace4), _zNumU64(0x86fb8971,0x16c87c34) },
+  { _zNumU64(0x9580869f,0x0e7aac0e), _zNumU64(0xd45d35e6,0xae3d4da0) },
+  { _zNumU64(0xbae0a846,0xd2195712), _zNumU64(0x89748360,0x59cca109) },
+  { _zNumU64(0xe998d258,0x869facd7), _zNumU64(0x2bd1a438,0x703fc94b) },
+  { _zNumU64(0x91ff8377,0x5423cc06), _zNumU64(0x7b6306a3,0x4627ddcf) },
+  { _zNumU64(0xb67f6455,0x292cbf08), _zNumU64(0x1a3bc84c,0x17b1d542) },
+  { _zNumU64(0xe41f3d6a,0x7377eeca), _zNumU64(0x20caba5f,0x1d9e4a93) },
+  { _zNumU64(0x8e938662,0x882af53e), _zNumU64(0x547eb47b,0x7282ee9c) },
+  { _zNumU64(0xb23867fb,0x2a35b28d), _zNumU64(0xe99e619a,0x4f23aa43) },
+  { _zNumU64(0xdec681f9,0xf4c31f31), _zNumU64(0x6405fa00,0xe2ec94d4) },
+  { _zNumU64(0x8b3c113c,0x38f9f37e), _zNumU64(0xde83bc40,0x8dd3dd04) },
+  { _zNumU64(0xae0b158b,0x4738705e), _zNumU64(0x9624ab50,0xb148d445) },
+  { _zNumU64(0xd98ddaee,0x19068c76), _zNumU64(0x3badd624,0xdd9b0957) },
+  { _zNumU64(0x87f8a8d4,0xcfa417c9), _zNumU64(0xe54ca5d7,0x0a80e5d6) },
+  { _zNumU64(0xa9f6d30a,0x038d1dbc), _zNumU64(0x5e9fcf4c,0xcd211f4c) },
+  { _zNumU64(0xd47487cc,0x8470652b), _zNumU64(0x7647c320,0x0069671f) },
+  { _zNumU64(0x84c8d4df,0xd2c63f3b), _zNumU64(0x29ecd9f4,0x0041e073) },
+  { _zNumU64(0xa5fb0a17,0xc777cf09), _zNumU64(0xf4681071,0x00525890) },
+  { _zNumU64(0xcf79cc9d,0xb955c2cc), _zNumU64(0x7182148d,0x4066eeb4) },
+  { _zNumU64(0x81ac1fe2,0x93d599bf), _zNumU64(0xc6f14cd8,0x48405530) },
+  { _zNumU64(0xa21727db,0x38cb002f), _zNumU64(0xb8ada00e,0x5a506a7c) },
+  { _zNumU64(0xca9cf1d2,0x06fdc03b), _zNumU64(0xa6d90811,0xf0e4851c) },
+  { _zNumU64(0xfd442e46,0x88bd304a), _zNumU64(0x908f4a16,0x6d1da663) },
+  { _zNumU64(0x9e4a9cec,0x15763e2e), _zNumU64(0x9a598e4e,0x043287fe) },
+  { _zNumU64(0xc5dd4427,0x1ad3cdba), _zNumU64(0x40eff1e1,0x853f29fd) },
+  { _zNumU64(0xf7549530,0xe188c128), _zNumU64(0xd12bee59,0xe68ef47c) },
+  { _zNumU64(0x9a94dd3e,0x8cf578b9), _zNumU64(0x82bb74f8,0x301958ce) },
+  { _zNumU64(0xc13a148e,0x3032d6e7), _zNumU64(0xe36a5236,0x3c1faf01) },
+  { _zNumU64(0xf18899b1,0xbc3f8ca1), _zNumU64(0xdc44e6c3,0xcb279ac1) },
+  { _zNumU64(0x96f5600f,0x15a7b7e5), _zNumU64(0x29ab103a,0x5ef8c0b9) },
+  { _zNumU64(0xbcb2b812,0xdb11a5de), _zNumU64(0x7415d448,0xf6b6f0e7) },
+  { _zNumU64(0xebdf6617,0x91d60f56), _zNumU64(0x111b495b,0x3464ad21) },
+  { _zNumU64(0x936b9fce,0xbb25c995), _zNumU64(0xcab10dd9,0x00beec34) },
+  { _zNumU64(0xb84687c2,0x69ef3bfb), _zNumU64(0x3d5d514f,0x40eea742) },
+  { _zNumU64(0xe65829b3,0x046b0afa), _zNumU64(0x0cb4a5a3,0x112a5112) },
+  { _zNumU64(0x8ff71a0f,0xe2c2e6dc), _zNumU64(0x47f0e785,0xeaba72ab) },
+  { _zNumU64(0xb3f4e093,0xdb73a093), _zNumU64(0x59ed2167,0x65690f56) },
+  { _zNumU64(0xe0f218b8,0xd25088b8), _zNumU64(0x306869c1,0x3ec3532c) },
+  { _zNumU64(0x8c974f73,0x83725573), _zNumU64(0x1e414218,0xc73a13fb) },
+  { _zNumU64(0xafbd2350,0x644eeacf), _zNumU64(0xe5d1929e,0xf90898fa) },
+  { _zNumU64(0xdbac6c24,0x7d62a583), _zNumU64(0xdf45f746,0xb74abf39) },
+  { _zNumU64(0x894bc396,0xce5da772), _zNumU64(0x6b8bba8c,0x328eb783) },
+  { _zNumU64(0xab9eb47c,0x81f5114f), _zNumU64(0x066ea92f,0x3f326564) },
+  { _zNumU64(0xd686619b,0xa27255a2), _zNumU64(0xc80a537b,0x0efefebd) },
+  { _zNumU64(0x8613fd01,0x45877585), _zNumU64(0xbd06742c,0xe95f5f36) },
+  { _zNumU64(0xa798fc41,0x96e952e7), _zNumU64(0x2c481138,0x23b73704) },
+  { _zNumU64(0xd17f3b51,0xfca3a7a0), _zNumU64(0xf75a1586,0x2ca504c5) },
+  { _zNumU64(0x82ef8513,0x3de648c4), _zNumU64(0x9a984d73,0xdbe722fb) },
+  { _zNumU64(0xa3ab6658,0x0d5fdaf5), _zNumU64(0xc13e60d0,0xd2e0ebba) },
+  { _zNumU64(0xcc963fee,0x10b7d1b3), _zNumU64(0x318df905,0x079926a8) },
+  { _zNumU64(0xffbbcfe9,0x94e5c61f), _zNumU64(0xfdf17746,0x497f7052) },
+  { _zNumU64(0x9fd561f1,0xfd0f9bd3), _zNumU64(0xfeb6ea8b,0xedefa633) },
+  { _zNumU64(0xc7caba6e,0x7c5382c8), _zNumU64(0xfe64a52e,0xe96b8fc0) },
+  { _zNumU64(0xf9bd690a,0x1b68637b), _zNumU64(0x3dfdce7a,0xa3c673b0) },
+  { _zNumU64(0x9c1661a6,0x51213e2d), _zNumU64(0x06bea10c,0xa65c084e) },
+  { _zNumU64(0xc31bfa0f,0xe5698db8), _zNumU64(0x486e494f,0xcff30a62) },
+  { _zNumU64(0xf3e2f893,0xdec3f126), _zNumU64(0x5a89dba3,0xc3efccfa) },
+  { _zNumU64(0x986ddb5c,0x6b3a76b7), _zNumU64(0xf8962946,0x5a75e01c) },
+  { _zNumU64(0xbe895233,0x86091465), _zNumU64(0xf6bbb397,0xf1135823) },
+  { _zNumU64(0xee2ba6c0,0x678b597f), _zNumU64(0x746aa07d,0xed582e2c) },
+  { _zNumU64(0x94db4838,0x40b717ef), _zNumU64(0xa8c2a44e,0xb4571cdc) },
+  { _zNumU64(0xba121a46,0x50e4ddeb), _zNumU64(0x92f34d62,0x616ce413) },
+  { _zNumU64(0xe896a0d7,0xe51e1566), _zNumU64(0x77b020ba,0xf9c81d17) },
+  { _zNumU64(0x915e2486,0xef32cd60), _zNumU64(0x0ace1474,0xdc1d122e) },
+  { _zNumU64(0xb5b5ada8,0xaaff80b8), _zNumU64(0x0d819992,0x132456ba) },
+  { _zNumU64(0xe3231912,0xd5bf60e6), _zNumU64(0x10e1fff6,0x97ed6c69) },
+  { _zNumU64(0x8df5efab,0xc5979c8f), _zNumU64(0xca8d3ffa,0x1ef463c1) },
+  { _zNumU64(0xb1736b96,0xb6fd83b3), _zNumU64(0xbd308ff8,0xa6b17cb2) },
+  { _zNumU64(0xddd0467c,0x64bce4a0), _zNumU64(0xac7cb3f6,0xd05ddbde) },
+  { _zNumU64(0x8aa22c0d,0xbef60ee4), _zNumU64(0x6bcdf07a,0x423aa96b) },
+  { _zNumU64(0xad4ab711,0x2eb3929d), _zNumU64(0x86c16c98,0xd2c953c6) },
+  { _zNumU64(0xd89d64d5,0x7a607744), _zNumU64(0xe871c7bf,0x077ba8b7) },
+  { _zNumU64(0x87625f05,0x6c7c4a8b), _zNumU64(0x11471cd7,0x64ad4972) },
+  { _zNumU64(0xa93af6c6,0xc79b5d2d), _zNumU64(0xd598e40d,0x3dd89bcf) },
+  { _zNumU64(0xd389b478,0x79823479), _zNumU64(0x4aff1d10,0x8d4ec2c3) },
+  { _zNumU64(0x843610cb,0x4bf160cb), _zNumU64(0xcedf722a,0x585139ba) },
+  { _zNumU64(0xa54394fe,0x1eedb8fe), _zNumU64(0xc2974eb4,0xee658828) },
+  { _zNumU64(0xce947a3d,0xa6a9273e), _zNumU64(0x733d2262,0x29feea32) },
+  { _zNumU64(0x811ccc66,0x8829b887), _zNumU64(0x0806357d,0x5a3f525f) },
+  { _zNumU64(0xa163ff80,0x2a3426a8), _zNumU64(0xca07c2dc,0xb0cf26f7) },
+  { _zNumU64(0xc9bcff60,0x34c13052), _zNumU64(0xfc89b393,0xdd02f0b5) },
+  { _zNumU64(0xfc2c3f38,0x41f17c67), _zNumU64(0xbbac2078,0xd443ace2) },
+  { _zNumU64(0x9d9ba783,0x2936edc0), _zNumU64(0xd54b944b,0x84aa4c0d) },
+  { _zNumU64(0xc5029163,0xf384a931), _zNumU64(0x0a9e795e,0x65d4df11) },
+  { _zNumU64(0xf64335bc,0xf065d37d), _zNumU64(0x4d4617b5,0xff4a16d5) },
+  { _zNumU64(0x99ea0196,0x163fa42e), _zNumU64(0x504bced1,0xbf8e4e45) },
+  { _zNumU64(0xc06481fb,0x9bcf8d39), _zNumU64(0xe45ec286,0x2f71e1d6) },
+  { _zNumU64(0xf07da27a,0x82c37088), _zNumU64(0x5d767327,0xbb4e5a4c) },
+  { _zNumU64(0x964e858c,0x91ba2655), _zNumU64(0x3a6a07f8,0xd510f86f) },
+  { _zNumU64(0xbbe226ef,0xb628afea), _zNumU64(0x890489f7,0x0a55368b) },
+  { _zNumU64(0xeadab0ab,0xa3b2dbe5), _zNumU64(0x2b45ac74,0xccea842e) },
+  { _zNumU64(0x92c8ae6b,0x464fc96f), _zNumU64(0x3b0b8bc9,0x0012929d) },
+  { _zNumU64(0xb77ada06,0x17e3bbcb), _zNumU64(0x09ce6ebb,0x40173744) },
+  { _zNumU64(0xe5599087,0x9ddcaabd), _zNumU64(0xcc420a6a,0x101d0515) },
+  { _zNumU64(0x8f57fa54,0xc2a9eab6), _zNumU64(0x9fa94682,0x4a12232d) },
+  { _zNumU64(0xb32df8e9,0xf3546564), _zNumU64(0x47939822,0xdc96abf9) },
+  { _zNumU64(0xdff97724,0x70297ebd), _zNumU64(0x59787e2b,0x93bc56f7) },
+  { _zNumU64(0x8bfbea76,0xc619ef36), _zNumU64(0x57eb4edb,0x3c55b65a) },
+  { _zNumU64(0xaefae514,0x77a06b03), _zNumU64(0xede62292,0x0b6b23f1) },
+  { _zNumU64(0xdab99e59,0x958885c4), _zNumU64(0xe95fab36,0x8e45eced) },
+  { _zNumU64(0x88b402f7,0xfd75539b), _zNumU64(0x11dbcb02,0x18ebb414) },
+  { _zNumU64(0xaae103b5,0xfcd2a881), _zNumU64(0xd652bdc2,0x9f26a119) },
+  { _zNumU64(0xd59944a3,0x7c0752a2), _zNumU64(0x4be76d33,0x46f0495f) },
+  { _zNumU64(0x857fcae6,0x2d8493a5), _zNumU64(0x6f70a440,0x0c562ddb) },
+  { _zNumU64(0xa6dfbd9f,0xb8e5b88e), _zNumU64(0xcb4ccd50,0x0f6bb952) },
+  { _zNumU64(0xd097ad07,0xa71f26b2), _zNumU64(0x7e2000a4,0x1346a7a7) },
+  { _zNumU64(0x825ecc24,0xc873782f), _zNumU64(0x8ed40066,0x8c0c28c8) },
+  { _zNumU64(0xa2f67f2d,0xfa90563b), _zNumU64(0x72890080,0x2f0f32fa) },
+  { _zNumU64(0xcbb41ef9,0x79346bca), _zNumU64(0x4f2b40a0,0x3ad2ffb9) },
+  { _zNumU64(0xfea126b7,0xd78186bc), _zNumU64(0xe2f610c8,0x4987bfa8) },
+  { _zNumU64(0x9f24b832,0xe6b0f436), _zNumU64(0x0dd9ca7d,0x2df4d7c9) },
+  { _zNumU64(0xc6ede63f,0xa05d3143), _zNumU64(0x91503d1c,0x79720dbb) },
+  { _zNumU64(0xf8a95fcf,0x88747d94), _zNumU64(0x75a44c63,0x97ce912a) },
+  { _zNumU64(0x9b69dbe1,0xb548ce7c), _zNumU64(0xc986afbe,0x3ee11aba) },
+  { _zNumU64(0xc24452da,0x229b021b), _zNumU64(0xfbe85bad,0xce996168) },
+  { _zNumU64(0xf2d56790,0xab41c2a2), _zNumU64(0xfae27299,0x423fb9c3) },
+  { _zNumU64(0x97c560ba,0x6b0919a5), _zNumU64(0xdccd879f,0xc967d41a) },
+  { _zNumU64(0xbdb6b8e9,0x05cb600f), _zNumU64(0x5400e987,0xbbc1c920) },
+  { _zNumU64(0xed246723,0x473e3813), _zNumU64(0x290123e9,0xaab23b68) },
+  { _zNumU64(0x9436c076,0x0c86e30b), _zNumU64(0xf9a0b672,0x0aaf6521) },
+  { _zNumU64(0xb9447093,0x8fa89bce), _zNumU64(0xf808e40e,0x8d5b3e69) },
+  { _zNumU64(0xe7958cb8,0x7392c2c2), _zNumU64(0xb60b1d12,0x30b20e04) },
+  { _zNumU64(0x90bd77f3,0x483bb9b9), _zNumU64(0xb1c6f22b,0x5e6f48c2) },
+  { _zNumU64(0xb4ecd5f0,0x1a4aa828), _zNumU64(0x1e38aeb6,0x360b1af3) },
+  { _zNumU64(0xe2280b6c,0x20dd5232), _zNumU64(0x25c6da63,0xc38de1b0) },
+  { _zNumU64(0x8d590723,0x948a535f), _zNumU64(0x579c487e,0x5a38ad0e) },
+  { _zNumU64(0xb0af48ec,0x79ace837), _zNumU64(0x2d835a9d,0xf0c6d851) },
+  { _zNumU64(0xdcdb1b27,0x98182244), _zNumU64(0xf8e43145,0x6cf88e65) },
+  { _zNumU64(0x8a08f0f8,0xbf0f156b), _zNumU64(0x1b8e9ecb,0x641b58ff) },
+  { _zNumU64(0xac8b2d36,0xeed2dac5), _zNumU64(0xe272467e,0x3d222f3f) },
+  { _zNumU64(0xd7adf884,0xaa879177), _zNumU64(0x5b0ed81d,0xcc6abb0f) },
+  { _zNumU64(0x86ccbb52,0xea94baea), _zNumU64(0x98e94712,0x9fc2b4e9) },
+  { _zNumU64(0xa87fea27,0xa539e9a5), _zNumU64(0x3f2398d7,0x47b36224) },
+  { _zNumU64(0xd29fe4b1,0x8e88640e), _zNumU64(0x8eec7f0d,0x19a03aad) },
+  { _zNumU64(0x83a3eeee,0xf9153e89), _zNumU64(0x1953cf68,0x300424ac) },
+  { _zNumU64(0xa48ceaaa,0xb75a8e2b), _zNumU64(0x5fa8c342,0x3c052dd7) },
+  { _zNumU64(0xcdb02555,0x653131b6), _zNumU64(0x3792f412,0xcb06794d) },
+  { _zNumU64(0x808e1755,0x5f3ebf11), _zNumU64(0xe2bbd88b,0xbee40bd0) },
+  { _zNumU64(0xa0b19d2a,0xb70e6ed6), _zNumU64(0x5b6aceae,0xae9d0ec4) },
+  { _zNumU64(0xc8de0475,0x64d20a8b), _zNumU64(0xf245825a,0x5a445275) },
+  { _zNumU64(0xfb158592,0xbe068d2e), _zNumU64(0xeed6e2f0,0xf0d56712) },
+  { _zNumU64(0x9ced737b,0xb6c4183d), _zNumU64(0x55464dd6,0x9685606b) },
+  { _zNumU64(0xc428d05a,0xa4751e4c), _zNumU64(0xaa97e14c,0x3c26b886) },
+  { _zNumU64(0xf5330471,0x4d9265df), _zNumU64(0xd53dd99f,0x4b3066a8) },
+  { _zNumU64(0x993fe2c6,0xd07b7fab), _zNumU64(0xe546a803,0x8efe4029) },
+  { _zNumU64(0xbf8fdb78,0x849a5f96), _zNumU64(0xde985204,0x72bdd033) },
+  { _zNumU64(0xef73d256,0xa5c0f77c), _zNumU64(0x963e6685,0x8f6d4440) },
+  { _zNumU64(0x95a86376,0x27989aad), _zNumU64(0xdde70013,0x79a44aa8) },
+  { _zNumU64(0xbb127c53,0xb17ec159), _zNumU64(0x5560c018,0x580d5d52) },
+  { _zNumU64(0xe9d71b68,0x9dde71af), _zNumU64(0xaab8f01e,0x6e10b4a6) },
+  { _zNumU64(0x92267121,0x62ab070d), _zNumU64(0xcab39613,0x04ca70e8) },
+  { _zNumU64(0xb6b00d69,0xbb55c8d1), _zNumU64(0x3d607b97,0xc5fd0d22) },
+  { _zNumU64(0xe45c10c4,0x2a2b3b05), _zNumU64(0x8cb89a7d,0xb77c506a) },
+  { _zNumU64(0x8eb98a7a,0x9a5b04e3), _zNumU64(0x77f3608e,0x92adb242) },
+  { _zNumU64(0xb267ed19,0x40f1c61c), _zNumU64(0x55f038b2,0x37591ed3) },
+  { _zNumU64(0xdf01e85f,0x912e37a3), _zNumU64(0x6b6c46de,0xc52f6688) },
+  { _zNumU64(0x8b61313b,0xbabce2c6), _zNumU64(0x2323ac4b,0x3b3da015) },
+  { _zNumU64(0xae397d8a,0xa96c1b77), _zNumU64(0xabec975e,0x0a0d081a) },
+  { _zNumU64(0xd9c7dced,0x53c72255), _zNumU64(0x96e7bd35,0x8c904a21) },
+  { _zNumU64(0x881cea14,0x545c7575), _zNumU64(0x7e50d641,0x77da2e54) },
+  { _zNumU64(0xaa242499,0x697392d2), _zNumU64(0xdde50bd1,0xd5d0b9e9) },
+  { _zNumU64(0xd4ad2dbf,0xc3d07787), _zNumU64(0x955e4ec6,0x4b44e864) },
+  { _zNumU64(0x84ec3c97,0xda624ab4), _zNumU64(0xbd5af13b,0xef0b113e) },
+  { _zNumU64(0xa6274bbd,0xd0fadd61), _zNumU64(0xecb1ad8a,0xeacdd58e) },
+  { _zNumU64(0xcfb11ead,0x453994ba), _zNumU64(0x67de18ed,0xa5814af2) },
+  { _zNumU64(0x81ceb32c,0x4b43fcf4), _zNumU64(0x80eacf94,0x8770ced7) },
+  { _zNumU64(0xa2425ff7,0x5e14fc31), _zNumU64(0xa1258379,0xa94d028d) },
+  { _zNumU64(0xcad2f7f5,0x359a3b3e), _zNumU64(0x096ee458,0x13a04330) },
+  { _zNumU64(0xfd87b5f2,0x8300ca0d), _zNumU64(0x8bca9d6e,0x188853fc) },
+  { _zNumU64(0x9e74d1b7,0x91e07e48), _zNumU64(0x775ea264,0xcf55347e) },
+  { _zNumU64(0xc6120625,0x76589dda), _zNumU64(0x95364afe,0x032a819e) },
+  { _zNumU64(0xf79687ae,0xd3eec551), _zNumU64(0x3a83ddbd,0x83f52205) },
+  { _zNumU64(0x9abe14cd,0x44753b52), _zNumU64(0xc4926a96,0x72793543) },
+  { _zNumU64(0xc16d9a00,0x95928a27), _zNumU64(0x75b7053c,0x0f178294) },
+  { _zNumU64(0xf1c90080,0xbaf72cb1), _zNumU64(0x5324c68b,0x12dd6339) },
+  { _zNumU64(0x971da050,0x74da7bee), _zNumU64(0xd3f6fc16,0xebca5e04) },
+  { _zNumU64(0xbce50864,0x92111aea), _zNumU64(0x88f4bb1c,0xa6bcf585) },
+  { _zNumU64(0xec1e4a7d,0xb69561a5), _zNumU64(0x2b31e9e3,0xd06c32e6) },
+  { _zNumU64(0x9392ee8e,0x921d5d07), _zNumU64(0x3aff322e,0x62439fd0) },
+  { _zNumU64(0xb877aa32,0x36a4b449), _zNumU64(0x09befeb9,0xfad487c3) },
+  { _zNumU64(0xe69594be,0xc44de15b), _zNumU64(0x4c2ebe68,0x7989a9b4) },
+  { _zNumU64(0x901d7cf7,0x3ab0acd9), _zNumU64(0x0f9d3701,0x4bf60a11) },
+  { _zNumU64(0xb424dc35,0x095cd80f), _zNumU64(0x538484c1,0x9ef38c95) },
+  { _zNumU64(0xe12e1342,0x4bb40e13), _zNumU64(0x2865a5f2,0x06b06fba) },
+  { _zNumU64(0x8cbccc09,0x6f5088cb), _zNumU64(0xf93f87b7,0x442e45d4) },
+  { _zNumU64(0xafebff0b,0xcb24aafe), _zNumU64(0xf78f69a5,0x1539d749) },
+  { _zNumU64(0xdbe6fece,0xbdedd5be), _zNumU64(0xb573440e,0x5a884d1c) },
+  { _zNumU64(0x89705f41,0x36b4a597), _zNumU64(0x31680a88,0xf8953031) },
+  { _zNumU64(0xabcc7711,0x8461cefc), _zNumU64(0xfdc20d2b,0x36ba7c3e) },
+  { _zNumU64(0xd6bf94d5,0xe57a42bc), _zNumU64(0x3d329076,0x04691b4d) },
+  { _zNumU64(0x8637bd05,0xaf6c69b5), _zNumU64(0xa63f9a49,0xc2c1b110) },
+  { _zNumU64(0xa7c5ac47,0x1b478423), _zNumU64(0x0fcf80dc,0x33721d54) },
+  { _zNumU64(0xd1b71758,0xe219652b), _zNumU64(0xd3c36113,0x404ea4a9) },
+  { _zNumU64(0x83126e97,0x8d4fdf3b), _zNumU64(0x645a1cac,0x083126ea) },
+  { _zNumU64(0xa3d70a3d,0x70a3d70a), _zNumU64(0x3d70a3d7,0x0a3d70a4) },
+  { _zNumU64(0xcccccccc,0xcccccccc), _zNumU64(0xcccccccc,0xcccccccd) },
+  { _zNumU64(0x80000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xa0000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xc8000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xfa000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x9c400000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xc3500000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xf4240000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x98968000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xbebc2000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xee6b2800,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x9502f900,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xba43b740,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xe8d4a510,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x9184e72a,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xb5e620f4,0x80000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xe35fa931,0xa0000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x8e1bc9bf,0x04000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xb1a2bc2e,0xc5000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xde0b6b3a,0x76400000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x8ac72304,0x89e80000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xad78ebc5,0xac620000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xd8d726b7,0x177a8000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x87867832,0x6eac9000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xa968163f,0x0a57b400), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xd3c21bce,0xcceda100), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x84595161,0x401484a0), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xa56fa5b9,0x9019a5c8), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0xcecb8f27,0xf4200f3a), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x813f3978,0xf8940984), _zNumU64(0x40000000,0x00000000) },
+  { _zNumU64(0xa18f07d7,0x36b90be5), _zNumU64(0x50000000,0x00000000) },
+  { _zNumU64(0xc9f2c9cd,0x04674ede), _zNumU64(0xa4000000,0x00000000) },
+  { _zNumU64(0xfc6f7c40,0x45812296), _zNumU64(0x4d000000,0x00000000) },
+  { _zNumU64(0x9dc5ada8,0x2b70b59d), _zNumU64(0xf0200000,0x00000000) },
+  { _zNumU64(0xc5371912,0x364ce305), _zNumU64(0x6c280000,0x00000000) },
+  { _zNumU64(0xf684df56,0xc3e01bc6), _zNumU64(0xc7320000,0x00000000) },
+  { _zNumU64(0x9a130b96,0x3a6c115c), _zNumU64(0x3c7f4000,0x00000000) },
+  { _zNumU64(0xc097ce7b,0xc90715b3), _zNumU64(0x4b9f1000,0x00000000) },
+  { _zNumU64(0xf0bdc21a,0xbb48db20), _zNumU64(0x1e86d400,0x00000000) },
+  { _zNumU64(0x96769950,0xb50d88f4), _zNumU64(0x13144480,0x00000000) },
+  { _zNumU64(0xbc143fa4,0xe250eb31), _zNumU64(0x17d955a0,0x00000000) },
+  { _zNumU64(0xeb194f8e,0x1ae525fd), _zNumU64(0x5dcfab08,0x00000000) },
+  { _zNumU64(0x92efd1b8,0xd0cf37be), _zNumU64(0x5aa1cae5,0x00000000) },
+  { _zNumU64(0xb7abc627,0x050305ad), _zNumU64(0xf14a3d9e,0x40000000) },
+  { _zNumU64(0xe596b7b0,0xc643c719), _zNumU64(0x6d9ccd05,0xd0000000) },
+  { _zNumU64(0x8f7e32ce,0x7bea5c6f), _zNumU64(0xe4820023,0xa2000000) },
+  { _zNumU64(0xb35dbf82,0x1ae4f38b), _zNumU64(0xdda2802c,0x8a800000) },
+  { _zNumU64(0xe0352f62,0xa19e306e), _zNumU64(0xd50b2037,0xad200000) },
+  { _zNumU64(0x8c213d9d,0xa502de45), _zNumU64(0x4526f422,0xcc340000) },
+  { _zNumU64(0xaf298d05,0x0e4395d6), _zNumU64(0x9670b12b,0x7f410000) },
+  { _zNumU64(0xdaf3f046,0x51d47b4c), _zNumU64(0x3c0cdd76,0x5f114000) },
+  { _zNumU64(0x88d8762b,0xf324cd0f), _zNumU64(0xa5880a69,0xfb6ac800) },
+  { _zNumU64(0xab0e93b6,0xefee0053), _zNumU64(0x8eea0d04,0x7a457a00) },
+  { _zNumU64(0xd5d238a4,0xabe98068), _zNumU64(0x72a49045,0x98d6d880) },
+  { _zNumU64(0x85a36366,0xeb71f041), _zNumU64(0x47a6da2b,0x7f864750) },
+  { _zNumU64(0xa70c3c40,0xa64e6c51), _zNumU64(0x999090b6,0x5f67d924) },
+  { _zNumU64(0xd0cf4b50,0xcfe20765), _zNumU64(0xfff4b4e3,0xf741cf6d) },
+  { _zNumU64(0x82818f12,0x81ed449f), _zNumU64(0xbff8f10e,0x7a8921a4) },
+  { _zNumU64(0xa321f2d7,0x226895c7), _zNumU64(0xaff72d52,0x192b6a0d) },
+  { _zNumU64(0xcbea6f8c,0xeb02bb39), _zNumU64(0x9bf4f8a6,0x9f764490) },
+  { _zNumU64(0xfee50b70,0x25c36a08), _zNumU64(0x02f236d0,0x4753d5b4) },
+  { _zNumU64(0x9f4f2726,0x179a2245), _zNumU64(0x01d76242,0x2c946590) },
+  { _zNumU64(0xc722f0ef,0x9d80aad6), _zNumU64(0x424d3ad2,0xb7b97ef5) },
+  { _zNumU64(0xf8ebad2b,0x84e0d58b), _zNumU64(0xd2e08987,0x65a7deb2) },
+  { _zNumU64(0x9b934c3b,0x330c8577), _zNumU64(0x63cc55f4,0x9f88eb2f) },
+  { _zNumU64(0xc2781f49,0xffcfa6d5), _zNumU64(0x3cbf6b71,0xc76b25fb) },
+  { _zNumU64(0xf316271c,0x7fc3908a), _zNumU64(0x8bef464e,0x3945ef7a) },
+  { _zNumU64(0x97edd871,0xcfda3a56), _zNumU64(0x97758bf0,0xe3cbb5ac) },
+  { _zNumU64(0xbde94e8e,0x43d0c8ec), _zNumU64(0x3d52eeed,0x1cbea317) },
+  { _zNumU64(0xed63a231,0xd4c4fb27), _zNumU64(0x4ca7aaa8,0x63ee4bdd) },
+  { _zNumU64(0x945e455f,0x24fb1cf8), _zNumU64(0x8fe8caa9,0x3e74ef6a) },
+  { _zNumU64(0xb975d6b6,0xee39e436), _zNumU64(0xb3e2fd53,0x8e122b44) },
+  { _zNumU64(0xe7d34c64,0xa9c85d44), _zNumU64(0x60dbbca8,0x7196b616) },
+  { _zNumU64(0x90e40fbe,0xea1d3a4a), _zNumU64(0xbc8955e9,0x46fe31cd) },
+  { _zNumU64(0xb51d13ae,0xa4a488dd), _zNumU64(0x6babab63,0x98bdbe41) },
+  { _zNumU64(0xe264589a,0x4dcdab14), _zNumU64(0xc696963c,0x7eed2dd1) },
+  { _zNumU64(0x8d7eb760,0x70a08aec), _zNumU64(0xfc1e1de5,0xcf543ca2) },
+  { _zNumU64(0xb0de6538,0x8cc8ada8), _zNumU64(0x3b25a55f,0x43294bcb) },
+  { _zNumU64(0xdd15fe86,0xaffad912), _zNumU64(0x49ef0eb7,0x13f39ebe) },
+  { _zNumU64(0x8a2dbf14,0x2dfcc7ab), _zNumU64(0x6e356932,0x6c784337) },
+  { _zNumU64(0xacb92ed9,0x397bf996), _zNumU64(0x49c2c37f,0x07965404) },
+  { _zNumU64(0xd7e77a8f,0x87daf7fb), _zNumU64(0xdc33745e,0xc97be906) },
+  { _zNumU64(0x86f0ac99,0xb4e8dafd), _zNumU64(0x69a028bb,0x3ded71a3) },
+  { _zNumU64(0xa8acd7c0,0x222311bc), _zNumU64(0xc40832ea,0x0d68ce0c) },
+  { _zNumU64(0xd2d80db0,0x2aabd62b), _zNumU64(0xf50a3fa4,0x90c30190) },
+  { _zNumU64(0x83c7088e,0x1aab65db), _zNumU64(0x792667c6,0xda79e0fa) },
+  { _zNumU64(0xa4b8cab1,0xa1563f52), _zNumU64(0x577001b8,0x91185938) },
+  { _zNumU64(0xcde6fd5e,0x09abcf26), _zNumU64(0xed4c0226,0xb55e6f86) },
+  { _zNumU64(0x80b05e5a,0xc60b6178), _zNumU64(0x544f8158,0x315b05b4) },
+  { _zNumU64(0xa0dc75f1,0x778e39d6), _zNumU64(0x696361ae,0x3db1c721) },
+  { _zNumU64(0xc913936d,0xd571c84c), _zNumU64(0x03bc3a19,0xcd1e38e9) },
+  { _zNumU64(0xfb587849,0x4ace3a5f), _zNumU64(0x04ab48a0,0x4065c723) },
+  { _zNumU64(0x9d174b2d,0xcec0e47b), _zNumU64(0x62eb0d64,0x283f9c76) },
+  { _zNumU64(0xc45d1df9,0x42711d9a), _zNumU64(0x3ba5d0bd,0x324f8394) },
+  { _zNumU64(0xf5746577,0x930d6500), _zNumU64(0xca8f44ec,0x7ee36479) },
+  { _zNumU64(0x9968bf6a,0xbbe85f20), _zNumU64(0x7e998b13,0xcf4e1ecb) },
+  { _zNumU64(0xbfc2ef45,0x6ae276e8), _zNumU64(0x9e3fedd8,0xc321a67e) },
+  { _zNumU64(0xefb3ab16,0xc59b14a2), _zNumU64(0xc5cfe94e,0xf3ea101e) },
+  { _zNumU64(0x95d04aee,0x3b80ece5), _zNumU64(0xbba1f1d1,0x58724a12) },
+  { _zNumU64(0xbb445da9,0xca61281f), _zNumU64(0x2a8a6e45,0xae8edc97) },
+  { _zNumU64(0xea157514,0x3cf97226), _zNumU64(0xf52d09d7,0x1a3293bd) },
+  { _zNumU64(0x924d692c,0xa61be758), _zNumU64(0x593c2626,0x705f9c56) },
+  { _zNumU64(0xb6e0c377,0xcfa2e12e), _zNumU64(0x6f8b2fb0,0x0c77836c) },
+  { _zNumU64(0xe498f455,0xc38b997a), _zNumU64(0x0b6dfb9c,0x0f956447) },
+  { _zNumU64(0x8edf98b5,0x9a373fec), _zNumU64(0x4724bd41,0x89bd5eac) },
+  { _zNumU64(0xb2977ee3,0x00c50fe7), _zNumU64(0x58edec91,0xec2cb657) },
+  { _zNumU64(0xdf3d5e9b,0xc0f653e1), _zNumU64(0x2f2967b6,0x6737e3ed) },
+  { _zNumU64(0x8b865b21,0x5899f46c), _zNumU64(0xbd79e0d2,0x0082ee74) },
+  { _zNumU64(0xae67f1e9,0xaec07187), _zNumU64(0xecd85906,0x80a3aa11) },
+  { _zNumU64(0xda01ee64,0x1a708de9), _zNumU64(0xe80e6f48,0x20cc9495) },
+  { _zNumU64(0x884134fe,0x908658b2), _zNumU64(0x3109058d,0x147fdcdd) },
+  { _zNumU64(0xaa51823e,0x34a7eede), _zNumU64(0xbd4b46f0,0x599fd415) },
+  { _zNumU64(0xd4e5e2cd,0xc1d1ea96), _zNumU64(0x6c9e18ac,0x7007c91a) },
+  { _zNumU64(0x850fadc0,0x9923329e), _zNumU64(0x03e2cf6b,0xc604ddb0) },
+  { _zNumU64(0xa6539930,0xbf6bff45), _zNumU64(0x84db8346,0xb786151c) },
+  { _zNumU64(0xcfe87f7c,0xef46ff16), _zNumU64(0xe6126418,0x65679a63) },
+  { _zNumU64(0x81f14fae,0x158c5f6e), _zNumU64(0x4fcb7e8f,0x3f60c07e) },
+  { _zNumU64(0xa26da399,0x9aef7749), _zNumU64(0xe3be5e33,0x0f38f09d) },
+  { _zNumU64(0xcb090c80,0x01ab551c), _zNumU64(0x5cadf5bf,0xd3072cc5) },
+  { _zNumU64(0xfdcb4fa0,0x02162a63), _zNumU64(0x73d9732f,0xc7c8f7f6) },
+  { _zNumU64(0x9e9f11c4,0x014dda7e), _zNumU64(0x2867e7fd,0xdcdd9afa) },
+  { _zNumU64(0xc646d635,0x01a1511d), _zNumU64(0xb281e1fd,0x541501b8) },
+  { _zNumU64(0xf7d88bc2,0x4209a565), _zNumU64(0x1f225a7c,0xa91a4226) },
+  { _zNumU64(0x9ae75759,0x6946075f), _zNumU64(0x3375788d,0xe9b06958) },
+  { _zNumU64(0xc1a12d2f,0xc3978937), _zNumU64(0x0052d6b1,0x641c83ae) },
+  { _zNumU64(0xf209787b,0xb47d6b84), _zNumU64(0xc0678c5d,0xbd23a49a) },
+  { _zNumU64(0x9745eb4d,0x50ce6332), _zNumU64(0xf840b7ba,0x963646e0) },
+  { _zNumU64(0xbd176620,0xa501fbff), _zNumU64(0xb650e5a9,0x3bc3d898) },
+  { _zNumU64(0xec5d3fa8,0xce427aff), _zNumU64(0xa3e51f13,0x8ab4cebe) },
+  { _zNumU64(0x93ba47c9,0x80e98cdf), _zNumU64(0xc66f336c,0x36b10137) },
+  { _zNumU64(0xb8a8d9bb,0xe123f017), _zNumU64(0xb80b0047,0x445d4184) },
+  { _zNumU64(0xe6d3102a,0xd96cec1d), _zNumU64(0xa60dc059,0x157491e5) },
+  { _zNumU64(0x9043ea1a,0xc7e41392), _zNumU64(0x87c89837,0xad68db2f) },
+  { _zNumU64(0xb454e4a1,0x79dd1877), _zNumU64(0x29babe45,0x98c311fb) },
+  { _zNumU64(0xe16a1dc9,0xd8545e94), _zNumU64(0xf4296dd6,0xfef3d67a) },
+  { _zNumU64(0x8ce2529e,0x2734bb1d), _zNumU64(0x1899e4a6,0x5f58660c) },
+  { _zNumU64(0xb01ae745,0xb101e9e4), _zNumU64(0x5ec05dcf,0xf72e7f8f) },
+  { _zNumU64(0xdc21a117,0x1d42645d), _zNumU64(0x76707543,0xf4fa1f73) },
+  { _zNumU64(0x899504ae,0x72497eba), _zNumU64(0x6a06494a,0x791c53a8) },
+  { _zNumU64(0xabfa45da,0x0edbde69), _zNumU64(0x0487db9d,0x17636892) },
+  { _zNumU64(0xd6f8d750,0x9292d603), _zNumU64(0x45a9d284,0x5d3c42b6) },
+  { _zNumU64(0x865b8692,0x5b9bc5c2), _zNumU64(0x0b8a2392,0xba45a9b2) },
+  { _zNumU64(0xa7f26836,0xf282b732), _zNumU64(0x8e6cac77,0x68d7141e) },
+  { _zNumU64(0xd1ef0244,0xaf2364ff), _zNumU64(0x3207d795,0x430cd926) },
+  { _zNumU64(0x8335616a,0xed761f1f), _zNumU64(0x7f44e6bd,0x49e807b8) },
+  { _zNumU64(0xa402b9c5,0xa8d3a6e7), _zNumU64(0x5f16206c,0x9c6209a6) },
+  { _zNumU64(0xcd036837,0x130890a1), _zNumU64(0x36dba887,0xc37a8c0f) },
+  { _zNumU64(0x80222122,0x6be55a64), _zNumU64(0xc2494954,0xda2c9789) },
+  { _zNumU64(0xa02aa96b,0x06deb0fd), _zNumU64(0xf2db9baa,0x10b7bd6c) },
+  { _zNumU64(0xc83553c5,0xc8965d3d), _zNumU64(0x6f928294,0x94e5acc7) },
+  { _zNumU64(0xfa42a8b7,0x3abbf48c), _zNumU64(0xcb772339,0xba1f17f9) },
+  { _zNumU64(0x9c69a972,0x84b578d7), _zNumU64(0xff2a7604,0x14536efb) },
+  { _zNumU64(0xc38413cf,0x25e2d70d), _zNumU64(0xfef51385,0x19684aba) },
+  { _zNumU64(0xf46518c2,0xef5b8cd1), _zNumU64(0x7eb25866,0x5fc25d69) },
+  { _zNumU64(0x98bf2f79,0xd5993802), _zNumU64(0xef2f773f,0xfbd97a61) },
+  { _zNumU64(0xbeeefb58,0x4aff8603), _zNumU64(0xaafb550f,0xfacfd8fa) },
+  { _zNumU64(0xeeaaba2e,0x5dbf6784), _zNumU64(0x95ba2a53,0xf983cf38) },
+  { _zNumU64(0x952ab45c,0xfa97a0b2), _zNumU64(0xdd945a74,0x7bf26183) },
+  { _zNumU64(0xba756174,0x393d88df), _zNumU64(0x94f97111,0x9aeef9e4) },
+  { _zNumU64(0xe912b9d1,0x478ceb17), _zNumU64(0x7a37cd56,0x01aab85d) },
+  { _zNumU64(0x91abb422,0xccb812ee), _zNumU64(0xac62e055,0xc10ab33a) },
+  { _zNumU64(0xb616a12b,0x7fe617aa), _zNumU64(0x577b986b,0x314d6009) },
+  { _zNumU64(0xe39c4976,0x5fdf9d94), _zNumU64(0xed5a7e85,0xfda0b80b) },
+  { _zNumU64(0x8e41ade9,0xfbebc27d), _zNumU64(0x14588f13,0xbe847307) },
+  { _zNumU64(0xb1d21964,0x7ae6b31c), _zNumU64(0x596eb2d8,0xae258fc8) },
+  { _zNumU64(0xde469fbd,0x99a05fe3), _zNumU64(0x6fca5f8e,0xd9aef3bb) },
+  { _zNumU64(0x8aec23d6,0x80043bee), _zNumU64(0x25de7bb9,0x480d5854) },
+  { _zNumU64(0xada72ccc,0x20054ae9), _zNumU64(0xaf561aa7,0x9a10ae6a) },
+  { _zNumU64(0xd910f7ff,0x28069da4), _zNumU64(0x1b2ba151,0x8094da04) },
+  { _zNumU64(0x87aa9aff,0x79042286), _zNumU64(0x90fb44d2,0xf05d0842) },
+  { _zNumU64(0xa99541bf,0x57452b28), _zNumU64(0x353a1607,0xac744a53) },
+  { _zNumU64(0xd3fa922f,0x2d1675f2), _zNumU64(0x42889b89,0x97915ce8) },
+  { _zNumU64(0x847c9b5d,0x7c2e09b7), _zNumU64(0x69956135,0xfebada11) },
+  { _zNumU64(0xa59bc234,0xdb398c25), _zNumU64(0x43fab983,0x7e699095) },
+  { _zNumU64(0xcf02b2c2,0x1207ef2e), _zNumU64(0x94f967e4,0x5e03f4bb) },
+  { _zNumU64(0x8161afb9,0x4b44f57d), _zNumU64(0x1d1be0ee,0xbac278f5) },
+  { _zNumU64(0xa1ba1ba7,0x9e1632dc), _zNumU64(0x6462d92a,0x69731732) },
+  { _zNumU64(0xca28a291,0x859bbf93), _zNumU64(0x7d7b8f75,0x03cfdcfe) },
+  { _zNumU64(0xfcb2cb35,0xe702af78), _zNumU64(0x5cda7352,0x44c3d43e) },
+  { _zNumU64(0x9defbf01,0xb061adab), _zNumU64(0x3a088813,0x6afa64a7) },
+  { _zNumU64(0xc56baec2,0x1c7a1916), _zNumU64(0x088aaa18,0x45b8fdd0) },
+  { _zNumU64(0xf6c69a72,0xa3989f5b), _zNumU64(0x8aad549e,0x57273d45) },
+  { _zNumU64(0x9a3c2087,0xa63f6399), _zNumU64(0x36ac54e2,0xf678864b) },
+  { _zNumU64(0xc0cb28a9,0x8fcf3c7f), _zNumU64(0x84576a1b,0xb416a7dd) },
+  { _zNumU64(0xf0fdf2d3,0xf3c30b9f), _zNumU64(0x656d44a2,0xa11c51d5) },
+  { _zNumU64(0x969eb7c4,0x7859e743), _zNumU64(0x9f644ae5,0xa4b1b325) },
+  { _zNumU64(0xbc4665b5,0x96706114), _zNumU64(0x873d5d9f,0x0dde1fee) },
+  { _zNumU64(0xeb57ff22,0xfc0c7959), _zNumU64(0xa90cb506,0xd155a7ea) },
+  { _zNumU64(0x9316ff75,0xdd87cbd8), _zNumU64(0x09a7f124,0x42d588f2) },
+  { _zNumU64(0xb7dcbf53,0x54e9bece), _zNumU64(0x0c11ed6d,0x538aeb2f) },
+  { _zNumU64(0xe5d3ef28,0x2a242e81), _zNumU64(0x8f1668c8,0xa86da5fa) },
+  { _zNumU64(0x8fa47579,0x1a569d10), _zNumU64(0xf96e017d,0x694487bc) },
+  { _zNumU64(0xb38d92d7,0x60ec4455), _zNumU64(0x37c981dc,0xc395a9ac) },
+  { _zNumU64(0xe070f78d,0x3927556a), _zNumU64(0x85bbe253,0xf47b1417) },
+  { _zNumU64(0x8c469ab8,0x43b89562), _zNumU64(0x93956d74,0x78ccec8e) },
+  { _zNumU64(0xaf584166,0x54a6babb), _zNumU64(0x387ac8d1,0x970027b2) },
+  { _zNumU64(0xdb2e51bf,0xe9d0696a), _zNumU64(0x06997b05,0xfcc0319e) },
+  { _zNumU64(0x88fcf317,0xf22241e2), _zNumU64(0x441fece3,0xbdf81f03) },
+  { _zNumU64(0xab3c2fdd,0xeeaad25a), _zNumU64(0xd527e81c,0xad7626c3) },
+  { _zNumU64(0xd60b3bd5,0x6a5586f1), _zNumU64(0x8a71e223,0xd8d3b074) },
+  { _zNumU64(0x85c70565,0x62757456), _zNumU64(0xf6872d56,0x67844e49) },
+  { _zNumU64(0xa738c6be,0xbb12d16c), _zNumU64(0xb428f8ac,0x016561db) },
+  { _zNumU64(0xd106f86e,0x69d785c7), _zNumU64(0xe13336d7,0x01beba52) },
+  { _zNumU64(0x82a45b45,0x0226b39c), _zNumU64(0xecc00246,0x61173473) },
+  { _zNumU64(0xa34d7216,0x42b06084), _zNumU64(0x27f002d7,0xf95d0190) },
+  { _zNumU64(0xcc20ce9b,0xd35c78a5), _zNumU64(0x31ec038d,0xf7b441f4) },
+  { _zNumU64(0xff290242,0xc83396ce), _zNumU64(0x7e670471,0x75a15271) },
+  { _zNumU64(0x9f79a169,0xbd203e41), _zNumU64(0x0f0062c6,0xe984d386) },
+  { _zNumU64(0xc75809c4,0x2c684dd1), _zNumU64(0x52c07b78,0xa3e60868) },
+  { _zNumU64(0xf92e0c35,0x37826145), _zNumU64(0xa7709a56,0xccdf8a82) },
+  { _zNumU64(0x9bbcc7a1,0x42b17ccb), _zNumU64(0x88a66076,0x400bb691) },
+  { _zNumU64(0xc2abf989,0x935ddbfe), _zNumU64(0x6acff893,0xd00ea435) },
+  { _zNumU64(0xf356f7eb,0xf83552fe), _zNumU64(0x0583f6b8,0xc4124d43) },
+  { _zNumU64(0x98165af3,0x7b2153de), _zNumU64(0xc3727a33,0x7a8b704a) },
+  { _zNumU64(0xbe1bf1b0,0x59e9a8d6), _zNumU64(0x744f18c0,0x592e4c5c) },
+  { _zNumU64(0xeda2ee1c,0x7064130c), _zNumU64(0x1162def0,0x6f79df73) },
+  { _zNumU64(0x9485d4d1,0xc63e8be7), _zNumU64(0x8addcb56,0x45ac2ba8) },
+  { _zNumU64(0xb9a74a06,0x37ce2ee1), _zNumU64(0x6d953e2b,0xd7173692) },
+  { _zNumU64(0xe8111c87,0xc5c1ba99), _zNumU64(0xc8fa8db6,0xccdd0437) },
+  { _zNumU64(0x910ab1d4,0xdb9914a0), _zNumU64(0x1d9c9892,0x400a22a2) },
+  { _zNumU64(0xb54d5e4a,0x127f59c8), _zNumU64(0x2503beb6,0xd00cab4b) },
+  { _zNumU64(0xe2a0b5dc,0x971f303a), _zNumU64(0x2e44ae64,0x840fd61d) },
+  { _zNumU64(0x8da471a9,0xde737e24), _zNumU64(0x5ceaecfe,0xd289e5d2) },
+  { _zNumU64(0xb10d8e14,0x56105dad), _zNumU64(0x7425a83e,0x872c5f47) },
+  { _zNumU64(0xdd50f199,0x6b947518), _zNumU64(0xd12f124e,0x28f77719) },
+  { _zNumU64(0x8a5296ff,0xe33cc92f), _zNumU64(0x82bd6b70,0xd99aaa6f) },
+  { _zNumU64(0xace73cbf,0xdc0bfb7b), _zNumU64(0x636cc64d,0x1001550b) },
+  { _zNumU64(0xd8210bef,0xd30efa5a), _zNumU64(0x3c47f7e0,0x5401aa4e) },
+  { _zNumU64(0x8714a775,0xe3e95c78), _zNumU64(0x65acfaec,0x34810a71) },
+  { _zNumU64(0xa8d9d153,0x5ce3b396), _zNumU64(0x7f1839a7,0x41a14d0d) },
+  { _zNumU64(0xd31045a8,0x341ca07c), _zNumU64(0x1ede4811,0x1209a050) },
+  { _zNumU64(0x83ea2b89,0x2091e44d), _zNumU64(0x934aed0a,0xab460432) },
+  { _zNumU64(0xa4e4b66b,0x68b65d60), _zNumU64(0xf81da84d,0x5617853f) },
+  { _zNumU64(0xce1de406,0x42e3f4b9), _zNumU64(0x36251260,0xab9d668e) },
+  { _zNumU64(0x80d2ae83,0xe9ce78f3), _zNumU64(0xc1d72b7c,0x6b426019) },
+  { _zNumU64(0xa1075a24,0xe4421730), _zNumU64(0xb24cf65b,0x8612f81f) },
+  { _zNumU64(0xc94930ae,0x1d529cfc), _zNumU64(0xdee033f2,0x6797b627) },
+  { _zNumU64(0xfb9b7cd9,0xa4a7443c), _zNumU64(0x169840ef,0x017da3b1) },
+  { _zNumU64(0x9d412e08,0x06e88aa5), _zNumU64(0x8e1f2895,0x60ee864e) },
+  { _zNumU64(0xc491798a,0x08a2ad4e), _zNumU64(0xf1a6f2ba,0xb92a27e2) },
+  { _zNumU64(0xf5b5d7ec,0x8acb58a2), _zNumU64(0xae10af69,0x6774b1db) },
+  { _zNumU64(0x9991a6f3,0xd6bf1765), _zNumU64(0xacca6da1,0xe0a8ef29) },
+  { _zNumU64(0xbff610b0,0xcc6edd3f), _zNumU64(0x17fd090a,0x58d32af3) },
+  { _zNumU64(0xeff394dc,0xff8a948e), _zNumU64(0xddfc4b4c,0xef07f5b0) },
+  { _zNumU64(0x95f83d0a,0x1fb69cd9), _zNumU64(0x4abdaf10,0x1564f98e) },
+  { _zNumU64(0xbb764c4c,0xa7a4440f), _zNumU64(0x9d6d1ad4,0x1abe37f1) },
+  { _zNumU64(0xea53df5f,0xd18d5513), _zNumU64(0x84c86189,0x216dc5ed) },
+  { _zNumU64(0x92746b9b,0xe2f8552c), _zNumU64(0x32fd3cf5,0xb4e49bb4) },
+  { _zNumU64(0xb7118682,0xdbb66a77), _zNumU64(0x3fbc8c33,0x221dc2a1) },
+  { _zNumU64(0xe4d5e823,0x92a40515), _zNumU64(0x0fabaf3f,0xeaa5334a) },
+  { _zNumU64(0x8f05b116,0x3ba6832d), _zNumU64(0x29cb4d87,0xf2a7400e) },
+  { _zNumU64(0xb2c71d5b,0xca9023f8), _zNumU64(0x743e20e9,0xef511012) },
+  { _zNumU64(0xdf78e4b2,0xbd342cf6), _zNumU64(0x914da924,0x6b255416) },
+  { _zNumU64(0x8bab8eef,0xb6409c1a), _zNumU64(0x1ad089b6,0xc2f7548e) },
+  { _zNumU64(0xae9672ab,0xa3d0c320), _zNumU64(0xa184ac24,0x73b529b1) },
+  { _zNumU64(0xda3c0f56,0x8cc4f3e8), _zNumU64(0xc9e5d72d,0x90a2741e) },
+  { _zNumU64(0x88658996,0x17fb1871), _zNumU64(0x7e2fa67c,0x7a658892) },
+  { _zNumU64(0xaa7eebfb,0x9df9de8d), _zNumU64(0xddbb901b,0x98feeab7) },
+  { _zNumU64(0xd51ea6fa,0x85785631), _zNumU64(0x552a7422,0x7f3ea565) },
+  { _zNumU64(0x8533285c,0x936b35de), _zNumU64(0xd53a8895,0x8f87275f) },
+  { _zNumU64(0xa67ff273,0xb8460356), _zNumU64(0x8a892aba,0xf368f137) },
+  { _zNumU64(0xd01fef10,0xa657842c), _zNumU64(0x2d2b7569,0xb0432d85) },
+  { _zNumU64(0x8213f56a,0x67f6b29b), _zNumU64(0x9c3b2962,0x0e29fc73) },
+  { _zNumU64(0xa298f2c5,0x01f45f42), _zNumU64(0x8349f3ba,0x91b47b8f) },
+  { _zNumU64(0xcb3f2f76,0x42717713), _zNumU64(0x241c70a9,0x36219a73) },
+  { _zNumU64(0xfe0efb53,0xd30dd4d7), _zNumU64(0xed238cd3,0x83aa0110) },
+  { _zNumU64(0x9ec95d14,0x63e8a506), _zNumU64(0xf4363804,0x324a40aa) },
+  { _zNumU64(0xc67bb459,0x7ce2ce48), _zNumU64(0xb143c605,0x3edcd0d5) },
+  { _zNumU64(0xf81aa16f,0xdc1b81da), _zNumU64(0xdd94b786,0x8e94050a) },
+  { _zNumU64(0x9b10a4e5,0xe9913128), _zNumU64(0xca7cf2b4,0x191c8326) },
+  { _zNumU64(0xc1d4ce1f,0x63f57d72), _zNumU64(0xfd1c2f61,0x1f63a3f0) },
+  { _zNumU64(0xf24a01a7,0x3cf2dccf), _zNumU64(0xbc633b39,0x673c8cec) },
+  { _zNumU64(0x976e4108,0x8617ca01), _zNumU64(0xd5be0503,0xe085d813) },
+  { _zNumU64(0xbd49d14a,0xa79dbc82), _zNumU64(0x4b2d8644,0xd8a74e18) },
+  { _zNumU64(0xec9c459d,0x51852ba2), _zNumU64(0xddf8e7d6,0x0ed1219e) },
+  { _zNumU64(0x93e1ab82,0x52f33b45), _zNumU64(0xcabb90e5,0xc942b503) },
+  { _zNumU64(0xb8da1662,0xe7b00a17), _zNumU64(0x3d6a751f,0x3b936243) },
+  { _zNumU64(0xe7109bfb,0xa19c0c9d), _zNumU64(0x0cc51267,0x0a783ad4) },
+  { _zNumU64(0x906a617d,0x450187e2), _zNumU64(0x27fb2b80,0x668b24c5) },
+  { _zNumU64(0xb484f9dc,0x9641e9da), _zNumU64(0xb1f9f660,0x802dedf6) },
+  { _zNumU64(0xe1a63853,0xbbd26451), _zNumU64(0x5e7873f8,0xa0396973) },
+  { _zNumU64(0x8d07e334,0x55637eb2), _zNumU64(0xdb0b487b,0x6423e1e8) },
+  { _zNumU64(0xb049dc01,0x6abc5e5f), _zNumU64(0x91ce1a9a,0x3d2cda62) },
+  { _zNumU64(0xdc5c5301,0xc56b75f7), _zNumU64(0x7641a140,0xcc7810fb) },
+  { _zNumU64(0x89b9b3e1,0x1b6329ba), _zNumU64(0xa9e904c8,0x7fcb0a9d) },
+  { _zNumU64(0xac2820d9,0x623bf429), _zNumU64(0x546345fa,0x9fbdcd44) },
+  { _zNumU64(0xd732290f,0xbacaf133), _zNumU64(0xa97c1779,0x47ad4095) },
+  { _zNumU64(0x867f59a9,0xd4bed6c0), _zNumU64(0x49ed8eab,0xcccc485d) },
+  { _zNumU64(0xa81f3014,0x49ee8c70), _zNumU64(0x5c68f256,0xbfff5a74) },
+  { _zNumU64(0xd226fc19,0x5c6a2f8c), _zNumU64(0x73832eec,0x6fff3111) },
+  { _zNumU64(0x83585d8f,0xd9c25db7), _zNumU64(0xc831fd53,0xc5ff7eab) },
+  { _zNumU64(0xa42e74f3,0xd032f525), _zNumU64(0xba3e7ca8,0xb77f5e55) },
+  { _zNumU64(0xcd3a1230,0xc43fb26f), _zNumU64(0x28ce1bd2,0xe55f35eb) },
+  { _zNumU64(0x80444b5e,0x7aa7cf85), _zNumU64(0x7980d163,0xcf5b81b3) },
+  { _zNumU64(0xa0555e36,0x1951c366), _zNumU64(0xd7e105bc,0xc332621f) },
+  { _zNumU64(0xc86ab5c3,0x9fa63440), _zNumU64(0x8dd9472b,0xf3fefaa7) },
+  { _zNumU64(0xfa856334,0x878fc150), _zNumU64(0xb14f98f6,0xf0feb951) },
+  { _zNumU64(0x9c935e00,0xd4b9d8d2), _zNumU64(0x6ed1bf9a,0x569f33d3) },
+  { _zNumU64(0xc3b83581,0x09e84f07), _zNumU64(0x0a862f80,0xec4700c8) },
+  { _zNumU64(0xf4a642e1,0x4c6262c8), _zNumU64(0xcd27bb61,0x2758c0fa) },
+  { _zNumU64(0x98e7e9cc,0xcfbd7dbd), _zNumU64(0x8038d51c,0xb897789c) },
+  { _zNumU64(0xbf21e440,0x03acdd2c), _zNumU64(0xe0470a63,0xe6bd56c3) },
+  { _zNumU64(0xeeea5d50,0x04981478), _zNumU64(0x1858ccfc,0xe06cac74) },
+  { _zNumU64(0x95527a52,0x02df0ccb), _zNumU64(0x0f37801e,0x0c43ebc8) },
+  { _zNumU64(0xbaa718e6,0x8396cffd), _zNumU64(0xd3056025,0x8f54e6ba) },
+  { _zNumU64(0xe950df20,0x247c83fd), _zNumU64(0x47c6b82e,0xf32a2069) },
+  { _zNumU64(0x91d28b74,0x16cdd27e), _zNumU64(0x4cdc331d,0x57fa5441) },
+  { _zNumU64(0xb6472e51,0x1c81471d), _zNumU64(0xe0133fe4,0xadf8e952) },
+  { _zNumU64(0xe3d8f9e5,0x63a198e5), _zNumU64(0x58180fdd,0xd97723a6) },
+  { _zNumU64(0x8e679c2f,0x5e44ff8f), _zNumU64(0x570f09ea,0xa7ea7648) }
+};
+
+/* the exact fast path requires arithmetic operations not in extended precision */
+#if defined( FLT_EVAL_METHOD )
+#define ZEDA_NUM_EVAL_METHOD FLT_EVAL_METHOD
+#elif defined( __FLT_EVAL_METHOD__ )
+#define ZEDA_NUM_EVAL_METHOD __FLT_EVAL_METHOD__
+#endif
+
+#if defined( ZEDA_NUM_EVAL_METHOD ) && ZEDA_NUM_EVAL_METHOD == 0
+/* exact powers of ten */
+#define ZEDA_NUM_POW10_MAX 22
+static const double _znum_pow10[] = {
+  1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+  1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+#endif
+
+/* maximum number of significant digits stored in a 64-bit integer */
+#define ZEDA_NUM_DIGIT_MAX 19
+/* exponents are saturated at this value */
+#define ZEDA_NUM_EXP_MAX 100000000L
+
+/* white spaces in the C locale */
+#define _zNumIsSpace(c) ( (c) == ' ' || ( (c) >= '\t' && (c) <= '\r' ) )
+#define _zNumIsDigit(c) ( (c) >= '0' && (c) <= '9' )
+
+/* full product of 64-bit unsigned integers. */
+static _zNumU128 _zNumMul(uint64_t a, uint64_t b)
+{
+  _zNumU128 p;
+#if defined( __GNUC__ ) && defined( __SIZEOF_INT128__ )
+  __extension__ unsigned __int128 r;
+
+  r = (unsigned __int128)a * b;
+  p.hi = (uint64_t)( r >> 64 );
+  p.lo = (uint64_t)r;
+#else
+  uint64_t a0, a1, b0, b1, p00, p01, p10, mid;
+
+  a0 = a & 0xffffffff; a1 = a >> 32;
+  b0 = b & 0xffffffff; b1 = b >> 32;
+  p00 = a0 * b0; p01 = a0 * b1; p10 = a1 * b0;
+  mid = ( p00 >> 32 ) + ( p01 & 0xffffffff ) + ( p10 & 0xffffffff );
+  p.lo = ( mid << 32 ) | ( p00 & 0xffffffff );
+  p.hi = a1 * b1 + ( p01 >> 32 ) + ( p10 >> 32 ) + ( mid >> 32 );
+#endif
+  return p;
+}
+
+/* number of leading zeros of a non-zero 64-bit unsigned integer. */
+static int _zNumCLZ(uint64_t w)
+{
+#ifdef __GNUC__
+  return __builtin_clzll( w );
+#else
+  int n;
+
+  for( n=0; !( w & _zNumU64(0x80000000,0) ); n++ ) w <<= 1;
+  return n;
+#endif
+}
+
+/* convert w*10^q to a double-precision floating-point value by Eisel-Lemire algorithm. */
+static bool _zNumEiselLemire(uint64_t w, long q, bool neg, double *val)
+{
+  _zNumU128 p, p_low;
+  uint64_t m;
+  long e;
+  int lz, upperbit;
+
+  lz = _zNumCLZ( w );
+  w <<= lz;
+  p = _zNumMul( w, _znum_pow5[q-ZEDA_NUM_POW5_MIN].hi );
+  if( ( p.hi & 0x1ff ) == 0x1ff && p.lo + w < p.lo ){ /* the lower bits might carry */
+    p_low = _zNumMul( w, _znum_pow5[q-ZEDA_NUM_POW5_MIN].lo );
+    p.lo += p_low.hi;
+    if( p_low.hi > p.lo ) p.hi++;
+    if( p.lo == ~(uint64_t)0 ) return false; /* still ambiguous */
+  }
+  upperbit = (int)( p.hi >> 63 );
+  m = p.hi >> ( upperbit + 9 );
+  lz += 1 ^ upperbit;
+  /* might be just halfway between two values */
+  if( p.lo == 0 && ( p.hi & 0x1ff ) == 0 && ( m & 3 ) == 1 ) return false;
+  m += m & 1; /* round */
+  m >>= 1;
+  if( m >= (uint64_t)1 << 53 ){
+    m = (uint64_t)1 << 52;
+    lz--;
+  }
+  m &= ~( (uint64_t)1 << 52 );
+  e = ( ( ( 152170L + 65536L ) * q ) >> 16 ) + 1024 + 63 - lz;
+  if( e < 1 || e > 2046 ) return false; /* subnormal or overflow */
+  m |= (uint64_t)e << 52;
+  if( neg ) m |= (uint64_t)1 << 63;
+  memcpy( val, &m, sizeof(double) );
+  return true;
+}
+
+/* convert significant digits and an exponent to a double-precision floating-point value by strtod(). */
+static double _zNumFallback(const char *head, const char *tail, long e, bool neg)
+{
+  char buf[BUFSIZ], *str, *sp;
+  size_t size;
+  long fracnum = 0;
+  bool frac = false;
+  double val;
+
+  /* the radix charactor, which depends on locale, is eliminated */
+  if( ( size = tail - head + 32 ) <= BUFSIZ )
+    str = buf;
+  else
+  if( !( str = zAlloc( char, size ) ) ){
+    ZALLOCERROR();
+    return 0;
+  }
+  sp = str;
+  if( neg ) *sp++ = '-';
+  for( ; head<tail; head++ ){
+    if( *head == '.' ){
+      frac = true;
+      continue;
+    }
+    if( frac ) fracnum++;
+    *sp++ = *head;
+  }
+  sprintf( sp, "e%ld", e - fracnum );
+  val = strtod( str, NULL );
+  if( str != buf ) free( str );
+  return val;
+}
+
+/* parse a hexadecimal real number by strtod(). */
+static size_t _zNumParseHex(const char *str, size_t len, double *val)
+{
+  char buf[BUFSIZ], *ep;
+  size_t i;
+
+  if( len >= BUFSIZ ) len = BUFSIZ - 1;
+  for( i=0; i<len; i++ )
+    buf[i] = str[i] == '.' ? localeconv()->decimal_point[0] : str[i];
+  buf[len] = '\0';
+  *val = strtod( buf, &ep );
+  return ep - buf;
+}
+
+/* compare a string with a lowercase word regardless of cases. */
+static size_t _zNumMatchWord(const char *str, const char *end, const char *word)
+{
+  const char *sp;
+
+  for( sp=str; *word; sp++, word++ )
+    if( sp >= end || ( *sp | 0x20 ) != *word ) return 0;
+  return sp - str;
+}
+
+/* parse infinity or NaN. */
+static size_t _zNumParseSpecial(const char *str, const char *end, bool neg, double *val)
+{
+  const char *sp;
+  size_t n;
+
+  if( ( n = _zNumMatchWord( str, end, "inf" ) ) > 0 ){
+    if( ( sp = str + _zNumMatchWord( str, end, "infinity" ) ) == str ) sp = str + n;
+    *val = neg ? -HUGE_VAL : HUGE_VAL;
+    return sp - str;
+  }
+  if( ( n = _zNumMatchWord( str, end, "nan" ) ) > 0 ){
+    sp = str + n;
+    if( sp < end && *sp == '(' ){ /* n-char-sequence */
+      for( sp++; sp<end && ( isalnum( (ubyte)*sp ) || *sp == '_' ); sp++ );
+      sp = sp < end && *sp == ')' ? sp + 1 : str + n;
+    }
+    *val = strtod( "nan", NULL );
+    if( neg ) *val = -*val;
+    return sp - str;
+  }
+  return 0;
+}
+
+/* parse an integer number in a string. */
+size_t zNumParseInt(const char *str, size_t len, int *val)
+{
+  const char *sp, *end, *head;
+  unsigned long v = 0, limit;
+  int d;
+  bool neg = false, saturated = false;
+
+  *val = 0;
+  for( sp=str, end=str+len; sp<end && _zNumIsSpace(*sp); sp++ );
+  if( sp < end && ( *sp == '+' || *sp == '-' ) ) neg = *sp++ == '-';
+  limit = neg ? (unsigned long)INT_MAX + 1 : (unsigned long)INT_MAX;
+  for( head=sp; sp<end && _zNumIsDigit(*sp); sp++ ){
+    if( saturated ) continue;
+    /* check before multiplying so that v does not wrap around even if long is 32-bit */
+    if( v > ( limit - ( d = *sp - '0' ) ) / 10 ){
+      v = limit;
+      saturated = true;
+    } else
+      v = v * 10 + d;
+  }
+  if( sp == head ) return 0;
+  *val = !neg ? (int)v : v > (unsigned long)INT_MAX ? INT_MIN : -(int)v;
+  return sp - str;
+}
+
+/* parse a real number in a string. */
+size_t zNumParseDouble(const char *str, size_t len, double *val)
+{
+  const char *np, *sp, *end, *head, *tail, *ep;
+  uint64_t w = 0;
+  long q = 0, e = 0;
+  int digitnum = 0;
+  bool neg = false, eneg = false, truncated = false, digit = false;
+  double v1, v2;
+  size_t n;
+
+  *val = 0;
+  for( np=str, end=str+len; np<end && _zNumIsSpace(*np); np++ );
+  if( ( sp = np ) < end && ( *sp == '+' || *sp == '-' ) ) neg = *sp++ == '-';
+  if( sp < end && !_zNumIsDigit(*sp) && *sp != '.' )
+    return ( n = _zNumParseSpecial( sp, end, neg, val ) ) > 0 ? sp - str + n : 0;
+  if( end - sp > 2 && sp[0] == '0' && ( sp[1] | 0x20 ) == 'x' && ( isxdigit( (ubyte)sp[2] ) || sp[2] == '.' ) )
+    return ( np - str ) + _zNumParseHex( np, end - np, val );
+  /* significant digits */
+  for( head=sp; sp<end && _zNumIsDigit(*sp); sp++, digit=true ){
+    if( digitnum < ZEDA_NUM_DIGIT_MAX ){
+      if( ( w = w * 10 + ( *sp - '0' ) ) > 0 ) digitnum++;
+    } else{
+      q++;
+      if( *sp != '0' ) truncated = true;
+    }
+  }
+  if( sp < end && *sp == '.' )
+    for( sp++; sp<end && _zNumIsDigit(*sp); sp++, digit=true ){
+      if( digitnum < ZEDA_NUM_DIGIT_MAX ){
+        if( ( w = w * 10 + ( *sp - '0' ) ) > 0 ) digitnum++;
+        q--;
+      } else
+      if( *sp != '0' ) truncated = true;
+    }
+  if( !digit ) return 0;
+  tail = sp;
+  /* exponent */
+  if( sp < end && ( *sp | 0x20 ) == 'e' ){
+    ep = sp + 1;
+    if( ep < end && ( *ep == '+' || *ep == '-' ) ) eneg = *ep++ == '-';
+    if( ep < end && _zNumIsDigit(*ep) ){
+      for( ; ep<end && _zNumIsDigit(*ep); ep++ )
+        if( e < ZEDA_NUM_EXP_MAX ) e = e * 10 + ( *ep - '0' );
+      if( eneg ) e = -e;
+      sp = ep;
+    }
+  }
+  n = sp - str;
+  if( w == 0 ){
+    *val = neg ? -0.0 : 0.0;
+    return n;
+  }
+  q += e;
+  if( q < ZEDA_NUM_POW5_MIN ){
+    *val = neg ? -0.0 : 0.0;
+    return n;
+  }
+  if( q > ZEDA_NUM_POW5_MAX ){
+    *val = neg ? -HUGE_VAL : HUGE_VAL;
+    return n;
+  }
+#if defined( ZEDA_NUM_EVAL_METHOD ) && ZEDA_NUM_EVAL_METHOD == 0
+  /* exact case (Clinger's fast path) */
+  if( !truncated && w <= (uint64_t)1 << 53 && q >= -ZEDA_NUM_POW10_MAX && q <= ZEDA_NUM_POW10_MAX ){
+    *val = q < 0 ? (double)w / _znum_pow10[-q] : (double)w * _znum_pow10[q];
+    if( neg ) *val = -*val;
+    return n;
+  }
+#endif
+  if( _zNumEiselLemire( w, q, neg, &v1 ) ){
+    /* truncated digits do not matter if both bounds are rounded to the same value */
+    if( !truncated || ( _zNumEiselLemire( w+1, q, neg, &v2 ) && v1 == v2 ) ){
+      *val = v1;
+      return n;
+    }
+  }
+  *val = _zNumFallback( head, tail, e, neg );
+  return n;
+}
+
+/* ********************************************************** */
+/* format numbers to strings.
+ *//* ******************************************************* */
+
+/* numbers with more digits in the integer part are formatted in the exponential notation */
+#define ZEDA_NUM_DIGIT_SHORTEST_MAX 17
+
+/* pairs of decimal digits from 00 to 99 */
+static const char _znum_digit2[] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/* format a 64-bit unsigned integer in decimal digits without the null charactor. */
+static size_t _zNumFormatU64(uint64_t val, char *buf)
+{
+  char tmp[20], *cp;
+  int r;
+  size_t n;
+
+  for( cp=tmp+20; val>=100; val/=100 ){
+    r = (int)( val % 100 ) * 2;
+    *--cp = _znum_digit2[r+1];
+    *--cp = _znum_digit2[r];
+  }
+  if( val >= 10 ){
+    r = (int)val * 2;
+    *--cp = _znum_digit2[r+1];
+    *--cp = _znum_digit2[r];
+  } else
+    *--cp = '0' + (int)val;
+  memcpy( buf, cp, ( n = tmp + 20 - cp ) );
+  return n;
+}
+
+/* format an integer number to a string. */
+size_t zNumFormatInt(int val, char *buf)
+{
+  size_t n = 0;
+
+  if( val < 0 ){
+    buf[n++] = '-';
+    n += _zNumFormatU64( (uint64_t)0 - (uint64_t)val, buf+n );
+  } else
+    n += _zNumFormatU64( (uint64_t)val, buf+n );
+  buf[n] = '\0';
+  return n;
+}
+
+/* multipliers of Ryu algorithm to compute m*2^e2 / 10^q (floor(2^k/5^q)+1 in 125 bits) */
+#define ZEDA_NUM_POW5_INV_BITCOUNT 125
+static const _zNumU128 _znum_pow5_inv[] = {
+  { _zNumU64(0x20000000,0x00000000), _zNumU64(0x00000000,0x00000001) },
+  { _zNumU64(0x19999999,0x99999999), _zNumU64(0x99999999,0x9999999a) },
+  { _zNumU64(0x147ae147,0xae147ae1), _zNumU64(0x47ae147a,0xe147ae15) },
+  { _zNumU64(0x10624dd2,0xf1a9fbe7), _zNumU64(0x6c8b4395,0x810624de) },
+  { _zNumU64(0x1a36e2eb,0x1c432ca5), _zNumU64(0x7a786c22,0x6809d496) },
+  { _zNumU64(0x14f8b588,0xe368f084), _zNumU64(0x61f9f01b,0x866e43ab) },
+  { _zNumU64(0x10c6f7a0,0xb5ed8d36), _zNumU64(0xb4c7f349,0x38583622) },
+  { _zNumU64(0x1ad7f29a,0xbcaf4857), _zNumU64(0x87a6520e,0xc08d236a) },
+  { _zNumU64(0x15798ee2,0x308c39df), _zNumU64(0x9fb841a5,0x66d74f88) },
+  { _zNumU64(0x112e0be8,0x26d694b2), _zNumU64(0xe62d0151,0x1f12a607) },
+  { _zNumU64(0x1b7cdfd9,0xd7bdbab7), _zNumU64(0xd6ae6881,0xcb5109a4) },
+  { _zNumU64(0x15fd7fe1,0x7964955f), _zNumU64(0xdef1ed34,0xa2a73aea) },
+  { _zNumU64(0x11979981,0x2dea1119), _zNumU64(0x7f27f0f6,0xe885c8bb) },
+  { _zNumU64(0x1c25c268,0x497681c2), _zNumU64(0x650cb4be,0x40d60df8) },
+  { _zNumU64(0x16849b86,0xa12b9b01), _zNumU64(0xea709098,0x33de7193) },
+  { _zNumU64(0x1203af9e,0xe756159b), _zNumU64(0x21f3a6e0,0x297ec143) },
+  { _zNumU64(0x1cd2b297,0xd889bc2b), _zNumU64(0x6985d7cd,0x0f313537) },
+  { _zNumU64(0x170ef546,0x46d49689), _zNumU64(0x2137dfd7,0x3f5a90f9) },
+  { _zNumU64(0x12725dd1,0xd243aba0), _zNumU64(0xe75fe645,0xcc4873fa) },
+  { _zNumU64(0x1d83c94f,0xb6d2ac34), _zNumU64(0xa5663d3c,0x7a0d865d) },
+  { _zNumU64(0x179ca10c,0x9242235d), _zNumU64(0x511e9763,0x94d79eb1) },
+  { _zNumU64(0x12e3b40a,0x0e9b4f7d), _zNumU64(0xda7edf82,0xdd794bc1) },
+  { _zNumU64(0x1e392010,0x175ee596), _zNumU64(0x2a6498d1,0x625bac68) },
+  { _zNumU64(0x182db340,0x12b25144), _zNumU64(0xeeb6e0a7,0x81e2f053) },
+  { _zNumU64(0x1357c299,0xa88ea76a), _zNumU64(0x58924d52,0xce4f26a9) },
+  { _zNumU64(0x1ef2d0f5,0xda7dd8aa), _zNumU64(0x27507bb7,0xb07ea441) },
+  { _zNumU64(0x18c240c4,0xaecb13bb), _zNumU64(0x52a6c95f,0xc0655034) },
+  { _zNumU64(0x13ce9a36,0xf23c0fc9), _zNumU64(0x0eebd44c,0x99eaa690) },
+  { _zNumU64(0x1fb0f6be,0x50601941), _zNumU64(0xb17953ad,0xc3110a80) },
+  { _zNumU64(0x195a5efe,0xa6b34767), _zNumU64(0xc12ddc8b,0x02740867) },
+  { _zNumU64(0x14484bfe,0xebc29f86), _zNumU64(0x3424b06f,0x3529a052) },
+  { _zNumU64(0x1039d665,0x89687f9e), _zNumU64(0x901d59f2,0x90ee19db) },
+  { _zNumU64(0x19f623d5,0xa8a73297), _zNumU64(0x4cfbc31d,0xb4b0295f) },
+  { _zNumU64(0x14c4e977,0xba1f5bac), _zNumU64(0x3d9635b1,0x5d59bab2) },
+  { _zNumU64(0x109d8792,0xfb4c4956), _zNumU64(0x97ab5e27,0x7de16228) },
+  { _zNumU64(0x1a95a5b7,0xf87a0ef0), _zNumU64(0xf2abc9d8,0xc9689d0d) },
+  { _zNumU64(0x15448493,0x2d2e725a), _zNumU64(0x5bbca17a,0x3aba173e) },
+  { _zNumU64(0x11039d42,0x8a8b8eae), _zNumU64(0xafca1ac8,0x2efb45cb) },
+  { _zNumU64(0x1b38fb9d,0xaa78e44a), _zNumU64(0xb2dcf7a6,0xb1920945) },
+  { _zNumU64(0x15c72fb1,0x552d836e), _zNumU64(0xf57d92eb,0xc141a104) },
+  { _zNumU64(0x116c2627,0x77579c58), _zNumU64(0xc4647589,0x6767b403) },
+  { _zNumU64(0x1be03d0b,0xf225c6f4), _zNumU64(0x6d6d88db,0xd8a5ecd2) },
+  { _zNumU64(0x164cfda3,0x281e38c3), _zNumU64(0x8abe0716,0x46eb23db) },
+  { _zNumU64(0x11d7314f,0x534b609c), _zNumU64(0x6efe6c11,0xd255b649) },
+  { _zNumU64(0x1c8b8218,0x85456760), _zNumU64(0xb197134f,0xb6ef8a0e) },
+  { _zNumU64(0x16d601ad,0x376ab91a), _zNumU64(0x27ac0f72,0xf8bfa1a5) },
+  { _zNumU64(0x1244ce24,0x2c5560e1), _zNumU64(0xb95672c2,0x60994e1e) },
+  { _zNumU64(0x1d3ae36d,0x13bbce35), _zNumU64(0xf5571e03,0xcdc21695) },
+  { _zNumU64(0x17624f8a,0x762fd82b), _zNumU64(0x2aac1803,0x0b01abab) },
+  { _zNumU64(0x12b50c6e,0xc4f31355), _zNumU64(0xbbbce002,0x6f348956) },
+  { _zNumU64(0x1dee7a4a,0xd4b81eef), _zNumU64(0x92c7ccd0,0xb1eda889) },
+  { _zNumU64(0x17f1fb6f,0x10934bf2), _zNumU64(0xdbd30a40,0x8e57ba07) },
+  { _zNumU64(0x1327fc58,0xda0f6ff5), _zNumU64(0x7ca8d500,0x71dfc806) },
+  { _zNumU64(0x1ea6608e,0x29b24cbb), _zNumU64(0xfaa7bb33,0xe9660cd6) },
+  { _zNumU64(0x18851a0b,0x548ea3c9), _zNumU64(0x9552fc29,0x8784d711) },
+  { _zNumU64(0x139dae6f,0x76d88307), _zNumU64(0xaaa8c9ba,0xd2d0ac0e) },
+  { _zNumU64(0x1f62b0b2,0x57c0d1a5), _zNumU64(0xdddadc5e,0x1e1aace3) },
+  { _zNumU64(0x191bc08e,0xac9a4151), _zNumU64(0x7e48b04b,0x4b488a4f) },
+  { _zNumU64(0x141633a5,0x56e1cdda), _zNumU64(0xcb6d59d5,0xd5d3a1d9) },
+  { _zNumU64(0x1011c2ea,0xabe7d7e2), _zNumU64(0x3c577b11,0x77dc817b) },
+  { _zNumU64(0x19b604aa,0xaca62636), _zNumU64(0xc6f25e82,0x5960cf2a) },
+  { _zNumU64(0x14919d55,0x56eb51c5), _zNumU64(0x6bf51868,0x4780a5bb) },
+  { _zNumU64(0x10747ddd,0xdf22a7d1), _zNumU64(0x232a79ed,0x06008496) },
+  { _zNumU64(0x1a53fc96,0x31d10c81), _zNumU64(0xd1dd8fe1,0xa3340756) },
+  { _zNumU64(0x150ffd44,0xf4a73d34), _zNumU64(0xa7e4731a,0xe8f66c45) },
+  { _zNumU64(0x10d9976a,0x5d52975d), _zNumU64(0x531d28e2,0x53f8569e) },
+  { _zNumU64(0x1af5bf10,0x9550f22e), _zNumU64(0xeb61db03,0xb98d5762) },
+  { _zNumU64(0x159165a6,0xddda5b58), _zNumU64(0xbc4e48cf,0xc7a445e8) },
+  { _zNumU64(0x11411e1f,0x17e1e2ad), _zNumU64(0x6371d3d9,0x6c836b20) },
+  { _zNumU64(0x1b9b6364,0xf3030448), _zNumU64(0x9f1c8628,0xad9f11cd) },
+  { _zNumU64(0x1615e91d,0x8f359d06), _zNumU64(0xe5b06b53,0xbe18db0b) },
+  { _zNumU64(0x11ab20e4,0x72914a6b), _zNumU64(0xeaf3890f,0xcb4715a2) },
+  { _zNumU64(0x1c45016d,0x841baa46), _zNumU64(0x44b8db4c,0x7871bc37) },
+  { _zNumU64(0x169d9abe,0x03495505), _zNumU64(0x03c715d6,0xc6c1635f) },
+  { _zNumU64(0x1217aefe,0x69077737), _zNumU64(0x3638de45,0x6bcde919) },
+  { _zNumU64(0x1cf2b197,0x0e725858), _zNumU64(0x56c163a2,0x461641c1) },
+  { _zNumU64(0x17288e12,0x71f51379), _zNumU64(0xdf011c81,0xd1ab67ce) },
+  { _zNumU64(0x1286d80e,0xc190dc61), _zNumU64(0x7f3416ce,0x4155eca5) },
+  { _zNumU64(0x1da48ce4,0x68e7c702), _zNumU64(0x6520247d,0x3556476e) },
+  { _zNumU64(0x17b6d71d,0x20b96c01), _zNumU64(0xea801d30,0xf7783925) },
+  { _zNumU64(0x12f8ac17,0x4d612334), _zNumU64(0xbb99b0f3,0xf92cfa84) },
+  { _zNumU64(0x1e5aacf2,0x15683854), _zNumU64(0x5f5c4e53,0x2847f739) },
+  { _zNumU64(0x18488a5b,0x44536043), _zNumU64(0x7f7d0b75,0xb9d32c2e) },
+  { _zNumU64(0x136d3b7c,0x36a919cf), _zNumU64(0x9930d5f7,0xc7dc2358) },
+  { _zNumU64(0x1f152bf9,0xf10e8fb2), _zNumU64(0x8eb4898c,0x72f9d226) },
+  { _zNumU64(0x18ddbcc7,0xf40ba628), _zNumU64(0x722a07a3,0x8f2e41b8) },
+  { _zNumU64(0x13e49706,0x5cd61e86), _zNumU64(0xc1bb394f,0xa5be9afa) },
+  { _zNumU64(0x1fd424d6,0xfaf030d7), _zNumU64(0x9c5ec219,0x0930f7f6) },
+  { _zNumU64(0x197683df,0x2f268d79), _zNumU64(0x49e56814,0x075a5ff8) },
+  { _zNumU64(0x145ecfe5,0xbf520ac7), _zNumU64(0x6e512010,0x05e1e660) },
+  { _zNumU64(0x104bd984,0x990e6f05), _zNumU64(0xf1da800c,0xd181851a) },
+  { _zNumU64(0x1a12f5a0,0xf4e3e4d6), _zNumU64(0x4fc40014,0x8268d4f5) },
+  { _zNumU64(0x14dbf7b3,0xf71cb711), _zNumU64(0xd96999aa,0x01ed772b) },
+  { _zNumU64(0x10aff95c,0xc5b09274), _zNumU64(0xadee1488,0x018ac5bc) },
+  { _zNumU64(0x1ab32894,0x6f80ea54), _zNumU64(0x497ceda6,0x68de092c) },
+  { _zNumU64(0x155c2076,0xbf9a5510), _zNumU64(0x3aca57b8,0x53e4d424) },
+  { _zNumU64(0x1116805e,0xffaeaa73), _zNumU64(0x623b7960,0x431d7683) },
+  { _zNumU64(0x1b5733cb,0x32b110b8), _zNumU64(0x9d2bf566,0xd1c8bd9e) },
+  { _zNumU64(0x15df5ca2,0x8ef40d60), _zNumU64(0x7dbcc452,0x416d647f) },
+  { _zNumU64(0x117f7d4e,0xd8c33de6), _zNumU64(0xcafd69db,0x678ab6cc) },
+  { _zNumU64(0x1bff2ee4,0x8e052fd7), _zNumU64(0xab2f0fc5,0x72778adf) },
+  { _zNumU64(0x1665bf1d,0x3e6a8cac), _zNumU64(0x88f27304,0x5b92d580) },
+  { _zNumU64(0x11eaff4a,0x98553d56), _zNumU64(0xd3f528d0,0x49424466) },
+  { _zNumU64(0x1cab3210,0xf3bb9557), _zNumU64(0xb988414d,0x4203a0a3) },
+  { _zNumU64(0x16ef5b40,0xc2fc7779), _zNumU64(0x6139cdd7,0x6802e6e9) },
+  { _zNumU64(0x125915cd,0x68c9f92d), _zNumU64(0xe7617179,0x20025254) },
+  { _zNumU64(0x1d5b5615,0x74765b7c), _zNumU64(0xa568b58e,0x999d5086) },
+  { _zNumU64(0x177c44dd,0xf6c515fd), _zNumU64(0x5120913e,0xe14aa6d2) },
+  { _zNumU64(0x12c9d0b1,0x923744ca), _zNumU64(0xa74d40ff,0x1aa21f0e) },
+  { _zNumU64(0x1e0fb44f,0x50586e11), _zNumU64(0x0baece64,0xf769cb4a) },
+  { _zNumU64(0x180c903f,0x7379f1a7), _zNumU64(0x3c8bd850,0xc5ee3c3b) },
+  { _zNumU64(0x133d4032,0xc2c7f485), _zNumU64(0xca0979da,0x37f1c9c9) },
+  { _zNumU64(0x1ec866b7,0x9e0cba6f), _zNumU64(0xa9a8c2f6,0xbfe942db) },
+  { _zNumU64(0x18a0522c,0x7e709526), _zNumU64(0x2153cf2b,0xccba9be3) },
+  { _zNumU64(0x13b374f0,0x6526ddb8), _zNumU64(0x1aa97289,0x70954982) },
+  { _zNumU64(0x1f8587e7,0x083e2f8c), _zNumU64(0xf775840f,0x1a88759d) },
+  { _zNumU64(0x19379fec,0x0698260a), _zNumU64(0x5f913672,0x7ba05e17) },
+  { _zNumU64(0x142c7ff0,0x054684d5), _zNumU64(0x1940f85b,0x9619e4df) },
+  { _zNumU64(0x1023998c,0xd1053710), _zNumU64(0xe100c6af,0xab47ea4c) },
+  { _zNumU64(0x19d28f47,0xb4d524e7), _zNumU64(0xce67a44c,0x453fdd47) },
+  { _zNumU64(0x14a8729f,0xc3ddb71f), _zNumU64(0xd852e9d6,0x9dccb106) },
+  { _zNumU64(0x1086c219,0x697e2c19), _zNumU64(0x79dbee45,0x4b0a2738) },
+  { _zNumU64(0x1a71368f,0x0f30468f), _zNumU64(0x295fe3a2,0x11a9d859) },
+  { _zNumU64(0x15275ed8,0xd8f36ba5), _zNumU64(0xbab31c81,0xa7bb137a) },
+  { _zNumU64(0x10ec4be0,0xad8f8951), _zNumU64(0x6228e39a,0xec95a92f) },
+  { _zNumU64(0x1b13ac9a,0xaf4c0ee8), _zNumU64(0x9d0e38f7,0xe0ef7517) },
+  { _zNumU64(0x15a956e2,0x25d67253), _zNumU64(0xb0d82d93,0x1a592a79) },
+  { _zNumU64(0x11544581,0xb7dec1dc), _zNumU64(0x8d79be0f,0x4847552e) },
+  { _zNumU64(0x1bba08cf,0x8c979c94), _zNumU64(0x158f967e,0xda0bbb7c) },
+  { _zNumU64(0x162e6d72,0xd6dfb076), _zNumU64(0x77a611ff,0x14d62f97) },
+  { _zNumU64(0x11bebdf5,0x78b2f391), _zNumU64(0xf951a7ff,0x43de8c79) },
+  { _zNumU64(0x1c646322,0x5ab7ec1c), _zNumU64(0xc21c3ffe,0xd2fdad8e) },
+  { _zNumU64(0x16b6b5b5,0x155ff017), _zNumU64(0x01b03332,0x42648ad8) },
+  { _zNumU64(0x122bc490,0xdde659ac), _zNumU64(0x0159c28e,0x9b83a246) },
+  { _zNumU64(0x1d12d41a,0xfca3c2ac), _zNumU64(0xcef60417,0x5f3903a3) },
+  { _zNumU64(0x17424348,0xca1c9bbd), _zNumU64(0x725e69ac,0x4c2d9c83) },
+  { _zNumU64(0x129b6907,0x0816e2fd), _zNumU64(0xf5185489,0xd68ae39c) },
+  { _zNumU64(0x1dc574d8,0x0cf16b2f), _zNumU64(0xee8d540f,0xbdab05c6) },
+  { _zNumU64(0x17d12a46,0x70c1228c), _zNumU64(0xbed77672,0xfe226b05) },
+  { _zNumU64(0x130dbb6b,0x8d674ed6), _zNumU64(0xff12c528,0xcb4ebc04) },
+  { _zNumU64(0x1e7c5f12,0x7bd87e24), _zNumU64(0xcb513b74,0x787df9a0) },
+  { _zNumU64(0x18637f41,0xfcad31b7), _zNumU64(0x090dc929,0xf9fe614d) },
+  { _zNumU64(0x1382cc34,0xca2427c5), _zNumU64(0xa0d7d421,0x94cb810a) },
+  { _zNumU64(0x1f37ad21,0x436d0c6f), _zNumU64(0x67bfb9cf,0x5478ce77) },
+  { _zNumU64(0x18f9574d,0xcf8a7059), _zNumU64(0x1fcc94a5,0xdd2d71f9) },
+  { _zNumU64(0x13faac3e,0x3fa1f37a), _zNumU64(0x7fd6dd51,0x7dbdf4c7) },
+  { _zNumU64(0x1ff779fd,0x329cb8c3), _zNumU64(0xffbe2ee8,0xc92fee0b) },
+  { _zNumU64(0x1992c7fd,0xc216fa36), _zNumU64(0x6631bf20,0xa0f324d6) },
+  { _zNumU64(0x14756ccb,0x01abfb5e), _zNumU64(0xb827cc1a,0x1a5c1d78) },
+  { _zNumU64(0x105df0a2,0x67bcc918), _zNumU64(0x935309ae,0x7b7ce460) },
+  { _zNumU64(0x1a2fe76a,0x3f9474f4), _zNumU64(0x1eeb42b0,0xc594a099) },
+  { _zNumU64(0x14f31f88,0x32dd2a5c), _zNumU64(0xe5890227,0x0476e6e1) },
+  { _zNumU64(0x10c27fa0,0x28b0eeb0), _zNumU64(0xb7a0ce85,0x9d2bebe7) },
+  { _zNumU64(0x1ad0cc33,0x744e4ab4), _zNumU64(0x59014a6f,0x61dfdfd8) },
+  { _zNumU64(0x1573d68f,0x903ea229), _zNumU64(0xe0cdd525,0xe7e64cad) },
+  { _zNumU64(0x11297872,0xd9cbb4ee), _zNumU64(0x4d717751,0x8651d6f1) },
+  { _zNumU64(0x1b758d84,0x8fac54b0), _zNumU64(0x7be8bee8,0xd6e957e8) },
+  { _zNumU64(0x15f7a46a,0x0c89dd59), _zNumU64(0xfcba3253,0xdf211320) },
+  { _zNumU64(0x1192e9ee,0x706e4aae), _zNumU64(0x63c82843,0x18e74280) },
+  { _zNumU64(0x1c1e4317,0x1a4a1117), _zNumU64(0x060d0d38,0x27d86a66) },
+  { _zNumU64(0x167e9c12,0x7b6e7412), _zNumU64(0x6b3da42c,0xecad21eb) },
+  { _zNumU64(0x11fee341,0xfc585cdb), _zNumU64(0x88fe1cf0,0xbd574e56) },
+  { _zNumU64(0x1ccb0536,0x608d615f), _zNumU64(0x419694b4,0x62254a23) },
+  { _zNumU64(0x1708d0f8,0x4d3de77f), _zNumU64(0x67abaa29,0xe81dd4e9) },
+  { _zNumU64(0x126d73f9,0xd764b932), _zNumU64(0xb95621bb,0x2017dd87) },
+  { _zNumU64(0x1d7becc2,0xf23ac1ea), _zNumU64(0xc223692b,0x668c95a5) },
+  { _zNumU64(0x17965702,0x5b6234bb), _zNumU64(0xce82ba89,0x1ed6de1d) },
+  { _zNumU64(0x12deac01,0xe2b4f6fc), _zNumU64(0xa5356207,0x4bdf1818) },
+  { _zNumU64(0x1e311336,0x3787f194), _zNumU64(0x3b889cd8,0x7964f359) },
+  { _zNumU64(0x18274291,0xc6065adc), _zNumU64(0xfc6d4a46,0xc783f5e1) },
+  { _zNumU64(0x13529ba7,0xd19eaf17), _zNumU64(0x30576e9f,0x06032b1a) },
+  { _zNumU64(0x1eea92a6,0x1c311825), _zNumU64(0x1a257dcb,0x3cd1de90) },
+  { _zNumU64(0x18bba884,0xe35a79b7), _zNumU64(0x481dfe3c,0x30a7e540) },
+  { _zNumU64(0x13c9539d,0x82aec7c5), _zNumU64(0xd34b31c9,0xc0865100) },
+  { _zNumU64(0x1fa885c8,0xd117a609), _zNumU64(0x5211e942,0xcda3b4cd) },
+  { _zNumU64(0x19539e3a,0x40dfb807), _zNumU64(0x74db2102,0x3e1c90a4) },
+  { _zNumU64(0x1442e4fb,0x67196005), _zNumU64(0xf715b401,0xcb4a0d50) },
+  { _zNumU64(0x103583fc,0x527ab337), _zNumU64(0xf8de299b,0x09080aa7) },
+  { _zNumU64(0x19ef3993,0xb72ab859), _zNumU64(0x8e304291,0xa80cddd7) },
+  { _zNumU64(0x14bf6142,0xf8eef9e1), _zNumU64(0x3e8d020e,0x200a4b13) },
+  { _zNumU64(0x10991a9b,0xfa58c7e7), _zNumU64(0x653d9b3e,0x80083c0f) },
+  { _zNumU64(0x1a8e90f9,0x908e0ca5), _zNumU64(0x6ec8f864,0x000d2ce4) },
+  { _zNumU64(0x153eda61,0x4071a3b7), _zNumU64(0x8bd3f9e9,0x99a423ea) },
+  { _zNumU64(0x10ff151a,0x99f482f9), _zNumU64(0x3ca994ba,0xe1501cbb) },
+  { _zNumU64(0x1b31bb5d,0xc320d18e), _zNumU64(0xc775bac4,0x9bb3612b) },
+  { _zNumU64(0x15c162b1,0x68e70e0b), _zNumU64(0xd2c4956a,0x16291a89) },
+  { _zNumU64(0x11678227,0x871f3e6f), _zNumU64(0xdbd07788,0x11ba7ba1) },
+  { _zNumU64(0x1bd8d03f,0x3e9863e6), _zNumU64(0x2c80bf40,0x1c5d929b) },
+  { _zNumU64(0x16470cff,0x6546b651), _zNumU64(0xbd33cc33,0x49e47549) },
+  { _zNumU64(0x11d270cc,0x51055ea7), _zNumU64(0xca8fd68f,0x6e505dd4) },
+  { _zNumU64(0x1c83e7ad,0x4e6efdd9), _zNumU64(0x4419574b,0xe3b3c953) },
+  { _zNumU64(0x16cfec8a,0xa52597e1), _zNumU64(0x03477909,0x82f63aa9) },
+  { _zNumU64(0x123ff06e,0xea847980), _zNumU64(0xcf6c60d4,0x68c4fbba) },
+  { _zNumU64(0x1d331a4b,0x10d3f59a), _zNumU64(0xe57a3487,0x0e07f92a) },
+  { _zNumU64(0x175c1508,0xda432ae2), _zNumU64(0x512e906c,0x0b399422) },
+  { _zNumU64(0x12b010d3,0xe1cf5581), _zNumU64(0xda8ba6bc,0xd5c7a9b5) },
+  { _zNumU64(0x1de68153,0x02e5559c), _zNumU64(0x90df712e,0x22d90f87) },
+  { _zNumU64(0x17eb9aa8,0xcf1dde16), _zNumU64(0xda4c5a8b,0x4f140c6c) },
+  { _zNumU64(0x1322e220,0xa5b17e78), _zNumU64(0xaea37ba2,0xa5a9a38a) },
+  { _zNumU64(0x1e9e369a,0xa2b59727), _zNumU64(0x7dd25f6a,0xa2a905a9) },
+  { _zNumU64(0x187e9215,0x4ef7ac1f), _zNumU64(0x97db7f88,0x8220d154) },
+  { _zNumU64(0x139874dd,0xd8c6234c), _zNumU64(0x797c6606,0xce80a777) },
+  { _zNumU64(0x1f5a5496,0x27a36bad), _zNumU64(0x8f2d700a,0xe4010bf1) },
+  { _zNumU64(0x19151078,0x1fb5efbe), _zNumU64(0x0c2459a2,0x5000d65a) },
+  { _zNumU64(0x1410d9f9,0xb2f7f2fe), _zNumU64(0x701d1481,0xd99a4515) },
+  { _zNumU64(0x100d7b2e,0x28c65bfe), _zNumU64(0xc017439b,0x147b6a77) },
+  { _zNumU64(0x19af2b7d,0x0e0a2cca), _zNumU64(0xccf205c4,0xed9243f2) },
+  { _zNumU64(0x148c22ca,0x71a1bd6f), _zNumU64(0x0a5b37d0,0xbe0e9cc2) },
+  { _zNumU64(0x10701bd5,0x27b4978c), _zNumU64(0x0848f973,0xcb3ee3ce) },
+  { _zNumU64(0x1a4cf955,0x0c5425ac), _zNumU64(0xda0e5bec,0x78649fb0) },
+  { _zNumU64(0x150a6110,0xd6a9b7bd), _zNumU64(0x7b3eaff0,0x60507fc0) },
+  { _zNumU64(0x10d51a73,0xdeee2c97), _zNumU64(0x95cbbff3,0x80406633) },
+  { _zNumU64(0x1aee90b9,0x64b04758), _zNumU64(0xefac6652,0x66cd7052) },
+  { _zNumU64(0x158ba6fa,0xb6f36c47), _zNumU64(0x2623850e,0xb8a459db) },
+  { _zNumU64(0x113c8595,0x5f29236c), _zNumU64(0x1e82d0d8,0x93b6ae49) },
+  { _zNumU64(0x1b9408ee,0xfea838ac), _zNumU64(0xfd9e1af4,0x1f8ab075) },
+  { _zNumU64(0x16100725,0x988693bd), _zNumU64(0x97b1af29,0xb2d559f7) },
+  { _zNumU64(0x11a66c1e,0x139edc97), _zNumU64(0xac8e25ba,0xf5777b2c) },
+  { _zNumU64(0x1c3d79c9,0xb8fe2dbf), _zNumU64(0x7a7d092b,0x2258c513) },
+  { _zNumU64(0x169794a1,0x60cb57cc), _zNumU64(0x61fda0ef,0x4ead6a76) },
+  { _zNumU64(0x1212dd4d,0xe7091309), _zNumU64(0xe7fe1a59,0x0bbdeec5) },
+  { _zNumU64(0x1ceafbaf,0xd80e84dc), _zNumU64(0xa6635d5b,0x45fcb13a) },
+  { _zNumU64(0x172262f3,0x133ed0b0), _zNumU64(0x851c4aaf,0x6b308dc8) },
+  { _zNumU64(0x1281e8c2,0x75cbda26), _zNumU64(0xd0e36ef2,0xbc26d7d4) },
+  { _zNumU64(0x1d9ca79d,0x894629d7), _zNumU64(0xb49f17ea,0xc6a48c86) },
+  { _zNumU64(0x17b08617,0xa104ee46), _zNumU64(0x2a18dfef,0x0550706b) },
+  { _zNumU64(0x12f39e79,0x4d9d8b6b), _zNumU64(0x54e0b325,0x9dd9f389) },
+  { _zNumU64(0x1e529728,0x7c2f4578), _zNumU64(0x87cdeb6f,0x62f65274) },
+  { _zNumU64(0x18421286,0xc9bf6ac6), _zNumU64(0xd30b22bf,0x825ea85d) },
+  { _zNumU64(0x13680ed2,0x3aff889f), _zNumU64(0x0f3c1bcc,0x684bb9e4) },
+  { _zNumU64(0x1f0ce483,0x9198da98), _zNumU64(0x18602c7a,0x4079296d) },
+  { _zNumU64(0x18d71d36,0x0e13e213), _zNumU64(0x46b356c8,0x33942124) },
+  { _zNumU64(0x13df4a91,0xa4dcb4dc), _zNumU64(0x388f78a0,0x29434db6) },
+  { _zNumU64(0x1fcbaa82,0xa1612160), _zNumU64(0x5a7f2766,0xa86baf8a) },
+  { _zNumU64(0x196fbb9b,0xb44db44d), _zNumU64(0x153285eb,0xb9efbfa2) },
+  { _zNumU64(0x145962e2,0xf6a4903d), _zNumU64(0xaa8ed189,0x618c994e) },
+  { _zNumU64(0x1047824f,0x2bb6d9ca), _zNumU64(0xeed8a7a1,0x1ad6e10c) },
+  { _zNumU64(0x1a0c03b1,0xdf8af611), _zNumU64(0x7e27729b,0x5e249b45) },
+  { _zNumU64(0x14d6695b,0x193bf80d), _zNumU64(0xfe85f549,0x181d4904) },
+  { _zNumU64(0x10ab877c,0x142ff9a4), _zNumU64(0xcb9e5dd4,0x134aa0d0) },
+  { _zNumU64(0x1aac0bf9,0xb9e65c3a), _zNumU64(0xdf63c953,0x5211014d) },
+  { _zNumU64(0x15566ffa,0xfb1eb02f), _zNumU64(0x191ca10f,0x74da6771) },
+  { _zNumU64(0x1111f32f,0x2f4bc025), _zNumU64(0xadb080d9,0x2a4852c1) },
+  { _zNumU64(0x1b4feb7e,0xb212cd09), _zNumU64(0x15e7348e,0xaa0d5134) },
+  { _zNumU64(0x15d98932,0x280f0a6d), _zNumU64(0xab1f5d3e,0xee710dc4) },
+  { _zNumU64(0x117ad428,0x200c0857), _zNumU64(0xbc191765,0x8b8da49d) },
+  { _zNumU64(0x1bf7b9d9,0xcce00d59), _zNumU64(0x2cf4f23c,0x127c3a94) },
+  { _zNumU64(0x165fc7e1,0x70b33de0), _zNumU64(0xf0c3f4fc,0xdb969543) },
+  { _zNumU64(0x11e63981,0x26f5cb1a), _zNumU64(0x5a365d97,0x16121103) },
+  { _zNumU64(0x1ca38f35,0x0b22de90), _zNumU64(0x9056fc24,0xf01ce804) },
+  { _zNumU64(0x16e93f5d,0xa2824ba6), _zNumU64(0xd9df301d,0x8ce3ecd0) },
+  { _zNumU64(0x125432b1,0x4ecea2eb), _zNumU64(0xe17f59b1,0x3d8323da) },
+  { _zNumU64(0x1d53844e,0xe47dd179), _zNumU64(0x68cbc2b5,0x2f38395c) },
+  { _zNumU64(0x17760372,0x5064a794), _zNumU64(0x53d6355d,0xbf602de3) },
+  { _zNumU64(0x12c4cf8e,0xa6b6ec76), _zNumU64(0xa9782ab1,0x65e68b1c) },
+  { _zNumU64(0x1e07b27d,0xd78b13f1), _zNumU64(0x0f26aab5,0x6fd744fa) },
+  { _zNumU64(0x18062864,0xac6f4327), _zNumU64(0x3f52222a,0xbfdf6a62) },
+  { _zNumU64(0x13382050,0x89f29c1f), _zNumU64(0x65db4e88,0x997f884e) },
+  { _zNumU64(0x1ec033b4,0x0fea9365), _zNumU64(0x6fc54a74,0x28cc0d4a) },
+  { _zNumU64(0x1899c2f6,0x73220f84), _zNumU64(0x596aa1f6,0x8709a43b) },
+  { _zNumU64(0x13ae3591,0xf5b4d936), _zNumU64(0xadeee7f8,0x6c07b696) },
+  { _zNumU64(0x1f7d2283,0x22baf524), _zNumU64(0x497e3ff3,0xe00c5756) },
+  { _zNumU64(0x1930e868,0xe89590e9), _zNumU64(0xd464fff6,0x4cd6ac45) },
+  { _zNumU64(0x14272053,0xed4473ee), _zNumU64(0x4383fff8,0x3d7889d1) },
+  { _zNumU64(0x101f4d0f,0xf1038ff1), _zNumU64(0xcf9cccc6,0x9793a174) },
+  { _zNumU64(0x19cbae7f,0xe805b31c), _zNumU64(0x7f6147a4,0x25b90252) },
+  { _zNumU64(0x14a2f1ff,0xecd15c16), _zNumU64(0xcc4dd2e9,0xb7c7350f) },
+  { _zNumU64(0x10825b33,0x23dab012), _zNumU64(0x3d0b0f21,0x5fd290d9) },
+  { _zNumU64(0x1a6a2b85,0x062ab350), _zNumU64(0x61ab4b68,0x9950e7c1) },
+  { _zNumU64(0x1521bc6a,0x6b555c40), _zNumU64(0x4e22a2ba,0x1440b967) },
+  { _zNumU64(0x10e7c9ee,0xbc4449cd), _zNumU64(0x0b4ee894,0xdd009453) },
+  { _zNumU64(0x1b0c764a,0xc6d3a948), _zNumU64(0x1217da87,0xc800ed51) },
+  { _zNumU64(0x15a391d5,0x6bdc876c), _zNumU64(0xdb46486c,0xa000bdda) },
+  { _zNumU64(0x114fa7dd,0xefe39f8a), _zNumU64(0x490506bd,0x4ccd64af) },
+  { _zNumU64(0x1bb2a62f,0xe638ff43), _zNumU64(0xa8080ac8,0x7ae23ab1) },
+  { _zNumU64(0x162884f3,0x1e93ff69), _zNumU64(0x5339a239,0xfbe82ef4) },
+  { _zNumU64(0x11ba03f5,0xb20fff87), _zNumU64(0x75c7b4fb,0x2fecf25d) },
+  { _zNumU64(0x1c5cd322,0xb67fff3f), _zNumU64(0x22d92191,0xe647ea2e) },
+  { _zNumU64(0x16b0a8e8,0x91ffff65), _zNumU64(0xb57a8141,0x850654f2) },
+  { _zNumU64(0x1226ed86,0xdb3332b7), _zNumU64(0xc4620101,0x373843f5) },
+  { _zNumU64(0x1d0b15a4,0x91eb8459), _zNumU64(0x3a366801,0xf1f39fee) },
+  { _zNumU64(0x173c1150,0x74bc69e0), _zNumU64(0xfb5eb99b,0x27f6198b) },
+  { _zNumU64(0x12967440,0x5d6387e7), _zNumU64(0x2f7efae2,0x865e7ad6) },
+  { _zNumU64(0x1dbd86cd,0x6238d971), _zNumU64(0xe597f7d0,0xd6fd9156) },
+  { _zNumU64(0x17cad23d,0xe82d7ac1), _zNumU64(0x8479930d,0x78cadaab) },
+  { _zNumU64(0x1308a831,0x868ac89a), _zNumU64(0xd0614271,0x2d6f1556) },
+  { _zNumU64(0x1e74404f,0x3daada91), _zNumU64(0x4d686a4e,0xaf182222) },
+  { _zNumU64(0x185d003f,0x6488aeda), _zNumU64(0xa453883e,0xf279b4e8) },
+  { _zNumU64(0x137d99cc,0x506d58ae), _zNumU64(0xe9dc6cff,0x28615d87) },
+  { _zNumU64(0x1f2f5c7a,0x1a488de4), _zNumU64(0xa960ae65,0x0d6895a4) },
+  { _zNumU64(0x18f2b061,0xaea07183), _zNumU64(0xbab3beb7,0x3ded4483) },
+  { _zNumU64(0x13f559e7,0xbee6c136), _zNumU64(0x2ef6322c,0x318a9d36) },
+  { _zNumU64(0x1feef63f,0x97d79b89), _zNumU64(0xe4bd1d13,0x827761f0) },
+  { _zNumU64(0x198bf832,0xdfdfafa1), _zNumU64(0x83ca7da9,0x352c4e5a) },
+  { _zNumU64(0x146ff9c2,0x4cb2f2e7), _zNumU64(0x9ca1fe20,0xf756a515) },
+  { _zNumU64(0x1059949b,0x708f28b9), _zNumU64(0x4a1b31b3,0xf9121daa) },
+  { _zNumU64(0x1a28edc5,0x80e50df5), _zNumU64(0x435eb5ec,0xc1b695dd) },
+  { _zNumU64(0x14ed8b04,0x671da4c4), _zNumU64(0x35e55e57,0x015ede4a) },
+  { _zNumU64(0x10be08d0,0x527e1d69), _zNumU64(0xc4b77eac,0x0118b1d5) },
+  { _zNumU64(0x1ac9a7b3,0xb7302f0f), _zNumU64(0xa1259779,0x9b5ab622) },
+  { _zNumU64(0x156e1fc2,0xf8f358d9), _zNumU64(0x4db7ac61,0x49155e81) },
+  { _zNumU64(0x1124e635,0x93f5e0ad), _zNumU64(0xd7c62381,0x07444b9b) },
+  { _zNumU64(0x1b6e3d22,0x86563449), _zNumU64(0x593d059b,0x3ed3ac2b) },
+  { _zNumU64(0x15f1ca82,0x0511c36d), _zNumU64(0xe0fd9e15,0xcbdc89bc) },
+  { _zNumU64(0x118e3b9b,0x37416924), _zNumU64(0xb3fe1811,0x6fe3a163) },
+  { _zNumU64(0x1c16c5c5,0x25357507), _zNumU64(0x866359b5,0x7fd29bd1) },
+  { _zNumU64(0x16789e37,0x50f790d2), _zNumU64(0xd1e91491,0x330ee30e) },
+  { _zNumU64(0x11fa182c,0x40c60d75), _zNumU64(0x74ba76da,0x8f3f1c0b) },
+  { _zNumU64(0x1cc359e0,0x67a348bb), _zNumU64(0xedf72490,0xe531c678) },
+  { _zNumU64(0x1702ae4d,0x1fb5d3c9), _zNumU64(0x8b2c1d40,0xb75b052d) },
+  { _zNumU64(0x12688b70,0xe62b0fd4), _zNumU64(0x6f567dcd,0x5f7c0424) },
+  { _zNumU64(0x1d74124e,0x3d11b2ed), _zNumU64(0x7ef0c948,0x98c66d06) },
+  { _zNumU64(0x17900ea4,0xfda7c257), _zNumU64(0x98c0a106,0xe09ebd9f) },
+  { _zNumU64(0x12d9a550,0xcaec9b79), _zNumU64(0x470080d2,0x4d4bcae6) },
+  { _zNumU64(0x1e290881,0x44adc58e), _zNumU64(0xd800ce1d,0x487944a2) },
+  { _zNumU64(0x1820d39a,0x9d57d13f), _zNumU64(0x1333d817,0x6d2dd082) },
+  { _zNumU64(0x134d7615,0x4aaca765), _zNumU64(0xa8f64679,0x2424a6ce) },
+  { _zNumU64(0x1ee25688,0x777aa56f), _zNumU64(0x74bd3d8e,0xa03aa47d) },
+  { _zNumU64(0x18b51206,0xc5fbb78c), _zNumU64(0x5d64313e,0xe6955064) },
+  { _zNumU64(0x13c40e6b,0xd1962c70), _zNumU64(0x4ab68dcb,0xebaaa6b7) },
+  { _zNumU64(0x1fa01712,0xe8f0471a), _zNumU64(0x11241613,0x12aaa457) },
+  { _zNumU64(0x194cdf42,0x53f36c14), _zNumU64(0xda8344dc,0x0eeee9df) },
+  { _zNumU64(0x143d7f68,0x43292343), _zNumU64(0xe2029d7c,0xd8bf2180) },
+  { _zNumU64(0x103132b9,0xcf541c36), _zNumU64(0x4e687dfd,0x7a328133) },
+  { _zNumU64(0x19e85129,0x4bb9c6bd), _zNumU64(0x4a40c995,0x9050ceb8) },
+  { _zNumU64(0x14b9da87,0x6fc7d231), _zNumU64(0x0833d477,0xa6a70bc6) },
+  { _zNumU64(0x1094aed2,0xbfd30e8d), _zNumU64(0xa02976c6,0x1eec096b) },
+  { _zNumU64(0x1a877e1d,0xffb81749), _zNumU64(0x004257a3,0x64acdbdf) },
+  { _zNumU64(0x153931b1,0x996012a0), _zNumU64(0xcd01dfb5,0xea23e319) },
+  { _zNumU64(0x10fa8e27,0xade6754d), _zNumU64(0x70ce4c91,0x881cb5ae) },
+  { _zNumU64(0x1b2a7d0c,0x4970bbaf), _zNumU64(0x1ae3adb5,0xa69455e2) },
+  { _zNumU64(0x15bb973d,0x078d62f2), _zNumU64(0x7be957c4,0x854377e8) },
+  { _zNumU64(0x1162df64,0x060ab58e), _zNumU64(0xc987796a,0x0435f987) },
+  { _zNumU64(0x1bd1656c,0xd67788e4), _zNumU64(0x75a58f10,0x06bcc271) },
+  { _zNumU64(0x16411df0,0xab92d3e9), _zNumU64(0xf7b7a5a6,0x6bca3527) },
+  { _zNumU64(0x11cdb18d,0x560f0fee), _zNumU64(0x5fc61e1e,0xbca1c41f) },
+  { _zNumU64(0x1c7c4f48,0x89b1b316), _zNumU64(0xffa36364,0x6102d365) },
+  { _zNumU64(0x16c9d906,0xd48e28df), _zNumU64(0x32e91c50,0x4d9bdc51) },
+  { _zNumU64(0x123b1405,0x76d820b2), _zNumU64(0x8f20e373,0x71497d0e) },
+  { _zNumU64(0x1d2b533b,0xf159cdea), _zNumU64(0x7e9b0585,0x820f2e7c) },
+  { _zNumU64(0x1755dc2f,0xf447d7ee), _zNumU64(0xcbaf379e,0x01a5beca) },
+  { _zNumU64(0x12ab168c,0xc36cacbf), _zNumU64(0x0958f94b,0x348498a1) }
+};
+
+/* multipliers of Ryu algorithm to compute m*2^e2 * 5^i (5^i in 125 bits) */
+#define ZEDA_NUM_POW5_BITCOUNT 125
+static const _zNumU128 _znum_pow5_ryu[] = {
+  { _zNumU64(0x10000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x14000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x19000000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1f400000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x13880000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x186a0000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1e848000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1312d000,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x17d78400,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1dcd6500,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x12a05f20,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x174876e8,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1d1a94a2,0x00000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x12309ce5,0x40000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x16bcc41e,0x90000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1c6bf526,0x34000000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x11c37937,0xe0800000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x16345785,0xd8a00000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1bc16d67,0x4ec80000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1158e460,0x913d0000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x15af1d78,0xb58c4000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1b1ae4d6,0xe2ef5000), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x10f0cf06,0x4dd59200), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x152d02c7,0xe14af680), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x1a784379,0xd99db420), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x108b2a2c,0x28029094), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x14adf4b7,0x320334b9), _zNumU64(0x00000000,0x00000000) },
+  { _zNumU64(0x19d971e4,0xfe8401e7), _zNumU64(0x40000000,0x00000000) },
+  { _zNumU64(0x1027e72f,0x1f128130), _zNumU64(0x88000000,0x00000000) },
+  { _zNumU64(0x1431e0fa,0xe6d7217c), _zNumU64(0xaa000000,0x00000000) },
+  { _zNumU64(0x193e5939,0xa08ce9db), _zNumU64(0xd4800000,0x00000000) },
+  { _zNumU64(0x1f8def88,0x08b02452), _zNumU64(0xc9a00000,0x00000000) },
+  { _zNumU64(0x13b8b5b5,0x056e16b3), _zNumU64(0xbe040000,0x00000000) },
+  { _zNumU64(0x18a6e322,0x46c99c60), _zNumU64(0xad850000,0x00000000) },
+  { _zNumU64(0x1ed09bea,0xd87c0378), _zNumU64(0xd8e64000,0x00000000) },
+  { _zNumU64(0x13426172,0xc74d822b), _zNumU64(0x878fe800,0x00000000) },
+  { _zNumU64(0x1812f9cf,0x7920e2b6), _zNumU64(0x6973e200,0x00000000) },
+  { _zNumU64(0x1e17b843,0x57691b64), _zNumU64(0x03d0da80,0x00000000) },
+  { _zNumU64(0x12ced32a,0x16a1b11e), _zNumU64(0x82628890,0x00000000) },
+  { _zNumU64(0x178287f4,0x9c4a1d66), _zNumU64(0x22fb2ab4,0x00000000) },
+  { _zNumU64(0x1d6329f1,0xc35ca4bf), _zNumU64(0xabb9f561,0x00000000) },
+  { _zNumU64(0x125dfa37,0x1a19e6f7), _zNumU64(0xcb54395c,0xa0000000) },
+  { _zNumU64(0x16f578c4,0xe0a060b5), _zNumU64(0xbe2947b3,0xc8000000) },
+  { _zNumU64(0x1cb2d6f6,0x18c878e3), _zNumU64(0x2db399a0,0xba000000) },
+  { _zNumU64(0x11efc659,0xcf7d4b8d), _zNumU64(0xfc904004,0x74400000) },
+  { _zNumU64(0x166bb7f0,0x435c9e71), _zNumU64(0x7bb45005,0x91500000) },
+  { _zNumU64(0x1c06a5ec,0x5433c60d), _zNumU64(0xdaa16406,0xf5a40000) },
+  { _zNumU64(0x118427b3,0xb4a05bc8), _zNumU64(0xa8a4de84,0x59868000) },
+  { _zNumU64(0x15e531a0,0xa1c872ba), _zNumU64(0xd2ce1625,0x6fe82000) },
+  { _zNumU64(0x1b5e7e08,0xca3a8f69), _zNumU64(0x87819bae,0xcbe22800) },
+  { _zNumU64(0x111b0ec5,0x7e6499a1), _zNumU64(0xf4b1014d,0x3f6d5900) },
+  { _zNumU64(0x1561d276,0xddfdc00a), _zNumU64(0x71dd41a0,0x8f48af40) },
+  { _zNumU64(0x1aba4714,0x957d300d), _zNumU64(0x0e549208,0xb31adb10) },
+  { _zNumU64(0x10b46c6c,0xdd6e3e08), _zNumU64(0x28f4db45,0x6ff0c8ea) },
+  { _zNumU64(0x14e18788,0x14c9cd8a), _zNumU64(0x33321216,0xcbecfb24) },
+  { _zNumU64(0x1a19e96a,0x19fc40ec), _zNumU64(0xbffe969c,0x7ee839ed) },
+  { _zNumU64(0x105031e2,0x503da893), _zNumU64(0xf7ff1e21,0xcf512434) },
+  { _zNumU64(0x14643e5a,0xe44d12b8), _zNumU64(0xf5fee5aa,0x43256d41) },
+  { _zNumU64(0x197d4df1,0x9d605767), _zNumU64(0x337e9f14,0xd3eec892) },
+  { _zNumU64(0x1fdca16e,0x04b86d41), _zNumU64(0x005e46da,0x08ea7ab6) },
+  { _zNumU64(0x13e9e4e4,0xc2f34448), _zNumU64(0xa03aec48,0x45928cb2) },
+  { _zNumU64(0x18e45e1d,0xf3b0155a), _zNumU64(0xc849a75a,0x56f72fde) },
+  { _zNumU64(0x1f1d75a5,0x709c1ab1), _zNumU64(0x7a5c1130,0xecb4fbd6) },
+  { _zNumU64(0x13726987,0x666190ae), _zNumU64(0xec798abe,0x93f11d65) },
+  { _zNumU64(0x184f03e9,0x3ff9f4da), _zNumU64(0xa797ed6e,0x38ed64bf) },
+  { _zNumU64(0x1e62c4e3,0x8ff87211), _zNumU64(0x517de8c9,0xc728bdef) },
+  { _zNumU64(0x12fdbb0e,0x39fb474a), _zNumU64(0xd2eeb17e,0x1c7976b5) },
+  { _zNumU64(0x17bd29d1,0xc87a191d), _zNumU64(0x87aa5ddd,0xa397d462) },
+  { _zNumU64(0x1dac7446,0x3a989f64), _zNumU64(0xe994f555,0x0c7dc97b) },
+  { _zNumU64(0x128bc8ab,0xe49f639f), _zNumU64(0x11fd1955,0x27ce9ded) },
+  { _zNumU64(0x172ebad6,0xddc73c86), _zNumU64(0xd67c5faa,0x71c24568) },
+  { _zNumU64(0x1cfa698c,0x95390ba8), _zNumU64(0x8c1b7795,0x0e32d6c2) },
+  { _zNumU64(0x121c81f7,0xdd43a749), _zNumU64(0x57912abd,0x28dfc639) },
+  { _zNumU64(0x16a3a275,0xd494911b), _zNumU64(0xad75756c,0x7317b7c8) },
+  { _zNumU64(0x1c4c8b13,0x49b9b562), _zNumU64(0x98d2d2c7,0x8fdda5ba) },
+  { _zNumU64(0x11afd6ec,0x0e14115d), _zNumU64(0x9f83c3bc,0xb9ea8794) },
+  { _zNumU64(0x161bcca7,0x119915b5), _zNumU64(0x0764b4ab,0xe8652979) },
+  { _zNumU64(0x1ba2bfd0,0xd5ff5b22), _zNumU64(0x493de1d6,0xe27e73d7) },
+  { _zNumU64(0x1145b7e2,0x85bf98f5), _zNumU64(0x6dc6ad26,0x4d8f0866) },
+  { _zNumU64(0x159725db,0x272f7f32), _zNumU64(0xc938586f,0xe0f2ca80) },
+  { _zNumU64(0x1afcef51,0xf0fb5eff), _zNumU64(0x7b866e8b,0xd92f7d20) },
+  { _zNumU64(0x10de1593,0x369d1b5f), _zNumU64(0xad340517,0x67bdae34) },
+  { _zNumU64(0x15159af8,0x04446237), _zNumU64(0x9881065d,0x41ad19c1) },
+  { _zNumU64(0x1a5b01b6,0x05557ac5), _zNumU64(0x7ea147f4,0x92186032) },
+  { _zNumU64(0x1078e111,0xc3556cbb), _zNumU64(0x6f24ccf8,0xdb4f3c1f) },
+  { _zNumU64(0x14971956,0x342ac7ea), _zNumU64(0x4aee0037,0x12230b27) },
+  { _zNumU64(0x19bcdfab,0xc13579e4), _zNumU64(0xdda98044,0xd6abcdf0) },
+  { _zNumU64(0x10160bcb,0x58c16c2f), _zNumU64(0x0a89f02b,0x062b60b6) },
+  { _zNumU64(0x141b8ebe,0x2ef1c73a), _zNumU64(0xcd2c6c35,0xc7b638e4) },
+  { _zNumU64(0x1922726d,0xbaae3909), _zNumU64(0x80778743,0x39a3c71d) },
+  { _zNumU64(0x1f6b0f09,0x2959c74b), _zNumU64(0xe0956914,0x080cb8e4) },
+  { _zNumU64(0x13a2e965,0xb9d81c8f), _zNumU64(0x6c5d61ac,0x8507f38e) },
+  { _zNumU64(0x188ba3bf,0x284e23b3), _zNumU64(0x4774ba17,0xa649f072) },
+  { _zNumU64(0x1eae8cae,0xf261aca0), _zNumU64(0x1951e89d,0x8fdc6c8f) },
+  { _zNumU64(0x132d17ed,0x577d0be4), _zNumU64(0x0fd33162,0x79e9c3d9) },
+  { _zNumU64(0x17f85de8,0xad5c4edd), _zNumU64(0x13c7fdbb,0x186434cf) },
+  { _zNumU64(0x1df67562,0xd8b36294), _zNumU64(0x58b9fd29,0xde7d4203) },
+  { _zNumU64(0x12ba095d,0xc7701d9c), _zNumU64(0xb7743e3a,0x2b0e4942) },
+  { _zNumU64(0x17688bb5,0x394c2503), _zNumU64(0xe5514dc8,0xb5d1db92) },
+  { _zNumU64(0x1d42aea2,0x879f2e44), _zNumU64(0xdea5a13a,0xe3465277) },
+  { _zNumU64(0x1249ad25,0x94c37ceb), _zNumU64(0x0b2784c4,0xce0bf38a) },
+  { _zNumU64(0x16dc186e,0xf9f45c25), _zNumU64(0xcdf165f6,0x018ef06d) },
+  { _zNumU64(0x1c931e8a,0xb871732f), _zNumU64(0x416dbf73,0x81f2ac88) },
+  { _zNumU64(0x11dbf316,0xb346e7fd), _zNumU64(0x88e497a8,0x3137abd5) },
+  { _zNumU64(0x1652efdc,0x6018a1fc), _zNumU64(0xeb1dbd92,0x3d8596ca) },
+  { _zNumU64(0x1be7abd3,0x781eca7c), _zNumU64(0x25e52cf6,0xcce6fc7d) },
+  { _zNumU64(0x1170cb64,0x2b133e8d), _zNumU64(0x97af3c1a,0x40105dce) },
+  { _zNumU64(0x15ccfe3d,0x35d80e30), _zNumU64(0xfd9b0b20,0xd0147542) },
+  { _zNumU64(0x1b403dcc,0x834e11bd), _zNumU64(0x3d01cde9,0x04199292) },
+  { _zNumU64(0x1108269f,0xd210cb16), _zNumU64(0x462120b1,0xa28ffb9b) },
+  { _zNumU64(0x154a3047,0xc694fddb), _zNumU64(0xd7a968de,0x0b33fa82) },
+  { _zNumU64(0x1a9cbc59,0xb83a3d52), _zNumU64(0xcd93c315,0x8e00f923) },
+  { _zNumU64(0x10a1f5b8,0x13246653), _zNumU64(0xc07c59ed,0x78c09bb6) },
+  { _zNumU64(0x14ca7326,0x17ed7fe8), _zNumU64(0xb09b7068,0xd6f0c2a3) },
+  { _zNumU64(0x19fd0fef,0x9de8dfe2), _zNumU64(0xdcc24c83,0x0cacf34c) },
+  { _zNumU64(0x103e29f5,0xc2b18bed), _zNumU64(0xc9f96fd1,0xe7ec180f) },
+  { _zNumU64(0x144db473,0x335deee9), _zNumU64(0x3c77cbc6,0x61e71e13) },
+  { _zNumU64(0x19612190,0x00356aa3), _zNumU64(0x8b95beb7,0xfa60e598) },
+  { _zNumU64(0x1fb969f4,0x0042c54c), _zNumU64(0x6e7b2e65,0xf8f91efe) },
+  { _zNumU64(0x13d3e238,0x8029bb4f), _zNumU64(0xc50cfcff,0xbb9bb35f) },
+  { _zNumU64(0x18c8dac6,0xa0342a23), _zNumU64(0xb6503c3f,0xaa82a037) },
+  { _zNumU64(0x1efb1178,0x484134ac), _zNumU64(0xa3e44b4f,0x95234844) },
+  { _zNumU64(0x135ceaeb,0x2d28c0eb), _zNumU64(0xe66eaf11,0xbd360d2b) },
+  { _zNumU64(0x183425a5,0xf872f126), _zNumU64(0xe00a5ad6,0x2c839075) },
+  { _zNumU64(0x1e412f0f,0x768fad70), _zNumU64(0x980cf18b,0xb7a47493) },
+  { _zNumU64(0x12e8bd69,0xaa19cc66), _zNumU64(0x5f0816f7,0x52c6c8dc) },
+  { _zNumU64(0x17a2ecc4,0x14a03f7f), _zNumU64(0xf6ca1cb5,0x27787b13) },
+  { _zNumU64(0x1d8ba7f5,0x19c84f5f), _zNumU64(0xf47ca3e2,0x715699d7) },
+  { _zNumU64(0x127748f9,0x301d319b), _zNumU64(0xf8cde66d,0x86d62026) },
+  { _zNumU64(0x17151b37,0x7c247e02), _zNumU64(0xf7016008,0xe88ba830) },
+  { _zNumU64(0x1cda6205,0x5b2d9d83), _zNumU64(0xb4c1b80b,0x22ae923c) },
+  { _zNumU64(0x12087d43,0x58fc8272), _zNumU64(0x50f91306,0xf5ad1b65) },
+  { _zNumU64(0x168a9c94,0x2f3ba30e), _zNumU64(0xe53757c8,0xb318623f) },
+  { _zNumU64(0x1c2d43b9,0x3b0a8bd2), _zNumU64(0x9e852dba,0xdfde7acf) },
+  { _zNumU64(0x119c4a53,0xc4e69763), _zNumU64(0xa3133c94,0xcbeb0cc1) },
+  { _zNumU64(0x16035ce8,0xb6203d3c), _zNumU64(0x8bd80bb9,0xfee5cff1) },
+  { _zNumU64(0x1b843422,0xe3a84c8b), _zNumU64(0xaece0ea8,0x7e9f43ee) },
+  { _zNumU64(0x1132a095,0xce492fd7), _zNumU64(0x4d40c929,0x4f238a75) },
+  { _zNumU64(0x157f48bb,0x41db7bcd), _zNumU64(0x2090fb73,0xa2ec6d12) },
+  { _zNumU64(0x1adf1aea,0x12525ac0), _zNumU64(0x68b53a50,0x8ba78856) },
+  { _zNumU64(0x10cb70d2,0x4b7378b8), _zNumU64(0x41714472,0x5748b536) },
+  { _zNumU64(0x14fe4d06,0xde5056e6), _zNumU64(0x51cd958e,0xed1ae283) },
+  { _zNumU64(0x1a3de048,0x95e46c9f), _zNumU64(0xe640faf2,0xa8619b24) },
+  { _zNumU64(0x1066ac2d,0x5daec3e3), _zNumU64(0xefe89cd7,0xa93d00f7) },
+  { _zNumU64(0x14805738,0xb51a74dc), _zNumU64(0xebe2c40d,0x938c4134) },
+  { _zNumU64(0x19a06d06,0xe2611214), _zNumU64(0x26db7510,0xf86f5181) },
+  { _zNumU64(0x10044424,0x4d7cab4c), _zNumU64(0x9849292a,0x9b4592f1) },
+  { _zNumU64(0x1405552d,0x60dbd61f), _zNumU64(0xbe5b7375,0x4216f7ad) },
+  { _zNumU64(0x1906aa78,0xb912cba7), _zNumU64(0xadf25052,0x929cb598) },
+  { _zNumU64(0x1f485516,0xe7577e91), _zNumU64(0x996ee467,0x3743e2ff) },
+  { _zNumU64(0x138d352e,0x5096af1a), _zNumU64(0xffe54ec0,0x828a6ddf) },
+  { _zNumU64(0x18708279,0xe4bc5ae1), _zNumU64(0xbfdea270,0xa32d0957) },
+  { _zNumU64(0x1e8ca318,0x5deb719a), _zNumU64(0x2fd64b0c,0xcbf84bad) },
+  { _zNumU64(0x1317e5ef,0x3ab32700), _zNumU64(0x5de5eee7,0xff7b2f4c) },
+  { _zNumU64(0x17dddf6b,0x095ff0c0), _zNumU64(0x755f6aa1,0xff59fb1f) },
+  { _zNumU64(0x1dd55745,0xcbb7ecf0), _zNumU64(0x92b7454a,0x7f3079e7) },
+  { _zNumU64(0x12a5568b,0x9f52f416), _zNumU64(0x5bb28b4e,0x8f7e4c30) },
+  { _zNumU64(0x174eac2e,0x8727b11b), _zNumU64(0xf29f2e22,0x335ddf3c) },
+  { _zNumU64(0x1d22573a,0x28f19d62), _zNumU64(0xef46f9aa,0xc035570b) },
+  { _zNumU64(0x12357684,0x5997025d), _zNumU64(0xd58c5c0a,0xb8215667) },
+  { _zNumU64(0x16c2d425,0x6ffcc2f5), _zNumU64(0x4aef730d,0x6629ac01) },
+  { _zNumU64(0x1c73892e,0xcbfbf3b2), _zNumU64(0x9dab4fd0,0xbfb41701) },
+  { _zNumU64(0x11c835bd,0x3f7d784f), _zNumU64(0xa28b11e2,0x77d08e60) },
+  { _zNumU64(0x163a432c,0x8f5cd663), _zNumU64(0x8b2dd65b,0x15c4b1f9) },
+  { _zNumU64(0x1bc8d3f7,0xb3340bfc), _zNumU64(0x6df94bf1,0xdb35de77) },
+  { _zNumU64(0x115d847a,0xd000877d), _zNumU64(0xc4bbcf77,0x2901ab0a) },
+  { _zNumU64(0x15b4e599,0x8400a95d), _zNumU64(0x35eac354,0xf34215cd) },
+  { _zNumU64(0x1b221eff,0xe500d3b4), _zNumU64(0x8365742a,0x30129b40) },
+  { _zNumU64(0x10f5535f,0xef208450), _zNumU64(0xd21f689a,0x5e0ba108) },
+  { _zNumU64(0x1532a837,0xeae8a565), _zNumU64(0x06a742c0,0xf58e894a) },
+  { _zNumU64(0x1a7f5245,0xe5a2cebe), _zNumU64(0x48511371,0x32f22b9d) },
+  { _zNumU64(0x108f936b,0xaf85c136), _zNumU64(0xed32ac26,0xbfd75b42) },
+  { _zNumU64(0x14b37846,0x9b673184), _zNumU64(0xa87f5730,0x6fcd3212) },
+  { _zNumU64(0x19e05658,0x4240fde5), _zNumU64(0xd29f2cfc,0x8bc07e97) },
+  { _zNumU64(0x102c35f7,0x29689eaf), _zNumU64(0xa3a37c1d,0xd7584f1e) },
+  { _zNumU64(0x14374374,0xf3c2c65b), _zNumU64(0x8c8c5b25,0x4d2e62e6) },
+  { _zNumU64(0x19451452,0x30b377f2), _zNumU64(0x6faf71ee,0xa079fb9f) },
+  { _zNumU64(0x1f965966,0xbce055ef), _zNumU64(0x0b9b4e6a,0x48987a87) },
+  { _zNumU64(0x13bdf7e0,0x360c35b5), _zNumU64(0x67411102,0x6d5f4c94) },
+  { _zNumU64(0x18ad75d8,0x438f4322), _zNumU64(0xc1115543,0x08b71fba) },
+  { _zNumU64(0x1ed8d34e,0x547313eb), _zNumU64(0x7155aa93,0xcae4e7a8) },
+  { _zNumU64(0x13478410,0xf4c7ec73), _zNumU64(0x26d58a9c,0x5ecf10c9) },
+  { _zNumU64(0x18196515,0x31f9e78f), _zNumU64(0xf08aed43,0x7682d4fb) },
+  { _zNumU64(0x1e1fbe5a,0x7e786173), _zNumU64(0xecada894,0x54238a3a) },
+  { _zNumU64(0x12d3d6f8,0x8f0b3ce8), _zNumU64(0x73ec895c,0xb4963664) },
+  { _zNumU64(0x1788ccb6,0xb2ce0c22), _zNumU64(0x90e7abb3,0xe1bbc3fd) },
+  { _zNumU64(0x1d6affe4,0x5f818f2b), _zNumU64(0x352196a0,0xda2ab4fd) },
+  { _zNumU64(0x1262dfee,0xbbb0f97b), _zNumU64(0x0134fe24,0x885ab11e) },
+  { _zNumU64(0x16fb97ea,0x6a9d37d9), _zNumU64(0xc1823dad,0xaa715d65) },
+  { _zNumU64(0x1cba7de5,0x054485d0), _zNumU64(0x31e2cd19,0x150db4bf) },
+  { _zNumU64(0x11f48eaf,0x234ad3a2), _zNumU64(0x1f2dc02f,0xad2890f7) },
+  { _zNumU64(0x1671b25a,0xec1d888a), _zNumU64(0xa6f9303b,0x9872b535) },
+  { _zNumU64(0x1c0e1ef1,0xa724eaad), _zNumU64(0x50b77c4a,0x7e8f6282) },
+  { _zNumU64(0x1188d357,0x087712ac), _zNumU64(0x5272adae,0x8f199d91) },
+  { _zNumU64(0x15eb082c,0xca94d757), _zNumU64(0x670f591a,0x32e004f6) },
+  { _zNumU64(0x1b65ca37,0xfd3a0d2d), _zNumU64(0x40d32f60,0xbf980633) },
+  { _zNumU64(0x111f9e62,0xfe44483c), _zNumU64(0x4883fd9c,0x77bf03e0) },
+  { _zNumU64(0x156785fb,0xbdd55a4b), _zNumU64(0x5aa4fd03,0x95aec4d8) },
+  { _zNumU64(0x1ac1677a,0xad4ab0de), _zNumU64(0x314e3c44,0x7b1a760e) },
+  { _zNumU64(0x10b8e0ac,0xac4eae8a), _zNumU64(0xded0e5aa,0xccf089c9) },
+  { _zNumU64(0x14e718d7,0xd7625a2d), _zNumU64(0x96851f15,0x802cac3b) },
+  { _zNumU64(0x1a20df0d,0xcd3af0b8), _zNumU64(0xfc2666da,0xe037d74a) },
+  { _zNumU64(0x10548b68,0xa044d673), _zNumU64(0x9d980048,0xcc22e68e) },
+  { _zNumU64(0x1469ae42,0xc8560c10), _zNumU64(0x84fe005a,0xff2ba032) },
+  { _zNumU64(0x198419d3,0x7a6b8f14), _zNumU64(0xa63d8071,0xbef6883e) },
+  { _zNumU64(0x1fe52048,0x590672d9), _zNumU64(0xcfcce08e,0x2eb42a4e) },
+  { _zNumU64(0x13ef342d,0x37a407c8), _zNumU64(0x21e00c58,0xdd309a70) },
+  { _zNumU64(0x18eb0138,0x858d09ba), _zNumU64(0x2a580f6f,0x147cc10d) },
+  { _zNumU64(0x1f25c186,0xa6f04c28), _zNumU64(0xb4ee134a,0xd99bf150) },
+  { _zNumU64(0x137798f4,0x28562f99), _zNumU64(0x7114cc0e,0xc80176d2) },
+  { _zNumU64(0x18557f31,0x326bbb7f), _zNumU64(0xcd59ff12,0x7a01d486) },
+  { _zNumU64(0x1e6adefd,0x7f06aa5f), _zNumU64(0xc0b07ed7,0x188249a8) },
+  { _zNumU64(0x1302cb5e,0x6f642a7b), _zNumU64(0xd86e4f46,0x6f516e09) },
+  { _zNumU64(0x17c37e36,0x0b3d351a), _zNumU64(0xce89e318,0x0b25c98b) },
+  { _zNumU64(0x1db45dc3,0x8e0c8261), _zNumU64(0x822c5bde,0x0def3bee) },
+  { _zNumU64(0x1290ba9a,0x38c7d17c), _zNumU64(0xf15bb96a,0xc8b58575) },
+  { _zNumU64(0x1734e940,0xc6f9c5dc), _zNumU64(0x2db2a7c5,0x7ae2e6d2) },
+  { _zNumU64(0x1d022390,0xf8b83753), _zNumU64(0x391f51b6,0xd99ba086) },
+  { _zNumU64(0x1221563a,0x9b732294), _zNumU64(0x03b39312,0x48014454) },
+  { _zNumU64(0x16a9abc9,0x424feb39), _zNumU64(0x04a077d6,0xda019569) },
+  { _zNumU64(0x1c5416bb,0x92e3e607), _zNumU64(0x45c895cc,0x9081fac3) },
+  { _zNumU64(0x11b48e35,0x3bce6fc4), _zNumU64(0x8b9d5d9f,0xda513cba) },
+  { _zNumU64(0x1621b1c2,0x8ac20bb5), _zNumU64(0xae84b507,0xd0e58be8) },
+  { _zNumU64(0x1baa1e33,0x2d728ea3), _zNumU64(0x1a25e249,0xc51eeee3) },
+  { _zNumU64(0x114a52df,0xfc679925), _zNumU64(0xf057ad6e,0x1b33554d) },
+  { _zNumU64(0x159ce797,0xfb817f6f), _zNumU64(0x6c6d98c9,0xa2002aa1) },
+  { _zNumU64(0x1b04217d,0xfa61df4b), _zNumU64(0x4788fefc,0x0a803549) },
+  { _zNumU64(0x10e294ee,0xbc7d2b8f), _zNumU64(0x0cb59f5d,0x8690214e) },
+  { _zNumU64(0x151b3a2a,0x6b9c7672), _zNumU64(0xcfe30734,0xe83429a1) },
+  { _zNumU64(0x1a6208b5,0x0683940f), _zNumU64(0x83dbc902,0x2241340a) },
+  { _zNumU64(0x107d4571,0x24123c89), _zNumU64(0xb2695da1,0x5568c086) },
+  { _zNumU64(0x149c96cd,0x6d16cbac), _zNumU64(0x1f03b509,0xaac2f0a7) },
+  { _zNumU64(0x19c3bc80,0xc85c7e97), _zNumU64(0x26c4a24c,0x1573acd1) },
+  { _zNumU64(0x101a55d0,0x7d39cf1e), _zNumU64(0x783ae56f,0x8d684c03) },
+  { _zNumU64(0x1420eb44,0x9c8842e6), _zNumU64(0x16499ecb,0x70c25f03) },
+  { _zNumU64(0x19292615,0xc3aa539f), _zNumU64(0x9bdc067e,0x4cf2f6c4) },
+  { _zNumU64(0x1f736f9b,0x3494e887), _zNumU64(0x82d3081d,0xe02fb476) },
+  { _zNumU64(0x13a825c1,0x00dd1154), _zNumU64(0xb1c3e512,0xac1dd0c9) },
+  { _zNumU64(0x18922f31,0x411455a9), _zNumU64(0xde34de57,0x572544fc) },
+  { _zNumU64(0x1eb6bafd,0x91596b14), _zNumU64(0x55c215ed,0x2cee963b) },
+  { _zNumU64(0x133234de,0x7ad7e2ec), _zNumU64(0xb5994db4,0x3c151de5) },
+  { _zNumU64(0x17fec216,0x198ddba7), _zNumU64(0xe2ffa121,0x4b1a655e) },
+  { _zNumU64(0x1dfe729b,0x9ff15291), _zNumU64(0xdbbf8969,0x9de0feb6) },
+  { _zNumU64(0x12bf07a1,0x43f6d39b), _zNumU64(0x2957b5e2,0x02ac9f31) },
+  { _zNumU64(0x176ec989,0x94f48881), _zNumU64(0xf3ada35a,0x8357c6fe) },
+  { _zNumU64(0x1d4a7beb,0xfa31aaa2), _zNumU64(0x70990c31,0x242db8bd) },
+  { _zNumU64(0x124e8d73,0x7c5f0aa5), _zNumU64(0x865fa79e,0xb69c9376) },
+  { _zNumU64(0x16e230d0,0x5b76cd4e), _zNumU64(0xe7f79186,0x6443b854) },
+  { _zNumU64(0x1c9abd04,0x725480a2), _zNumU64(0xa1f575e7,0xfd54a669) },
+  { _zNumU64(0x11e0b622,0xc774d065), _zNumU64(0xa53969b0,0xfe54e801) },
+  { _zNumU64(0x1658e3ab,0x7952047f), _zNumU64(0x0e87c41d,0x3dea2202) },
+  { _zNumU64(0x1bef1c96,0x57a6859e), _zNumU64(0xd229b524,0x8d64aa82) },
+  { _zNumU64(0x117571dd,0xf6c81383), _zNumU64(0x435a1136,0xd85eea91) },
+  { _zNumU64(0x15d2ce55,0x747a1864), _zNumU64(0x14309584,0x8e76a536) },
+  { _zNumU64(0x1b4781ea,0xd1989e7d), _zNumU64(0x193cbae5,0xb2144e83) },
+  { _zNumU64(0x110cb132,0xc2ff630e), _zNumU64(0x2fc5f4cf,0x8f4cb112) },
+  { _zNumU64(0x154fdd7f,0x73bf3bd1), _zNumU64(0xbbb77203,0x731fdd56) },
+  { _zNumU64(0x1aa3d4df,0x50af0ac6), _zNumU64(0x2aa54e84,0x4fe7d4ac) },
+  { _zNumU64(0x10a6650b,0x926d66bb), _zNumU64(0xdaa75112,0xb1f0e4eb) },
+  { _zNumU64(0x14cffe4e,0x7708c06a), _zNumU64(0xd1512557,0x5e6d1e26) },
+  { _zNumU64(0x1a03fde2,0x14caf085), _zNumU64(0x85a56ead,0x360865b0) },
+  { _zNumU64(0x10427ead,0x4cfed653), _zNumU64(0x7387652c,0x41c53f8e) },
+  { _zNumU64(0x14531e58,0xa03e8be8), _zNumU64(0x50693e77,0x52368f71) },
+  { _zNumU64(0x1967e5ee,0xc84e2ee2), _zNumU64(0x64838e15,0x26c4334e) },
+  { _zNumU64(0x1fc1df6a,0x7a61ba9a), _zNumU64(0xfda4719a,0x70754022) },
+  { _zNumU64(0x13d92ba2,0x8c7d14a0), _zNumU64(0xde86c700,0x86494815) },
+  { _zNumU64(0x18cf768b,0x2f9c59c9), _zNumU64(0x162878c0,0xa7db9a1a) },
+  { _zNumU64(0x1f03542d,0xfb83703b), _zNumU64(0x5bb296f0,0xd1d280a1) },
+  { _zNumU64(0x1362149c,0xbd322625), _zNumU64(0x194f9e56,0x83239064) },
+  { _zNumU64(0x183a99c3,0xec7eafae), _zNumU64(0x5fa385ec,0x23ec747e) },
+  { _zNumU64(0x1e494034,0xe79e5b99), _zNumU64(0xf78c6767,0x2ce7919d) },
+  { _zNumU64(0x12edc821,0x10c2f940), _zNumU64(0x3ab7c0a0,0x7c10bb02) },
+  { _zNumU64(0x17a93a29,0x54f3b790), _zNumU64(0x4965b0c8,0x9b14e9c3) },
+  { _zNumU64(0x1d9388b3,0xaa30a574), _zNumU64(0x5bbf1cfa,0xc1da2433) },
+  { _zNumU64(0x127c3570,0x4a5e6768), _zNumU64(0xb957721c,0xb92856a0) },
+  { _zNumU64(0x171b42cc,0x5cf60142), _zNumU64(0xe7ad4ea3,0xe7726c48) },
+  { _zNumU64(0x1ce2137f,0x74338193), _zNumU64(0xa198a24c,0xe14f075a) },
+  { _zNumU64(0x120d4c2f,0xa8a030fc), _zNumU64(0x44ff6570,0x0cd16498) },
+  { _zNumU64(0x16909f3b,0x92c83d3b), _zNumU64(0x563f3ecc,0x1005bdbe) },
+  { _zNumU64(0x1c34c70a,0x777a4c8a), _zNumU64(0x2bcf0e7f,0x14072d2e) },
+  { _zNumU64(0x11a0fc66,0x8aac6fd6), _zNumU64(0x5b61690f,0x6c847c3d) },
+  { _zNumU64(0x16093b80,0x2d578bcb), _zNumU64(0xf239c353,0x47a59b4c) },
+  { _zNumU64(0x1b8b8a60,0x38ad6ebe), _zNumU64(0xeec83428,0x198f021f) },
+  { _zNumU64(0x1137367c,0x236c6537), _zNumU64(0x553d2099,0x0ff96153) },
+  { _zNumU64(0x1585041b,0x2c477e85), _zNumU64(0x2a8c68bf,0x53f7b9a8) },
+  { _zNumU64(0x1ae64521,0xf7595e26), _zNumU64(0x752f82ef,0x28f5a812) },
+  { _zNumU64(0x10cfeb35,0x3a97dad8), _zNumU64(0x093db1d5,0x7999890b) },
+  { _zNumU64(0x1503e602,0x893dd18e), _zNumU64(0x0b8d1e4a,0xd7ffeb4e) },
+  { _zNumU64(0x1a44df83,0x2b8d45f1), _zNumU64(0x8e7065dd,0x8dffe622) },
+  { _zNumU64(0x106b0bb1,0xfb384bb6), _zNumU64(0xf9063faa,0x78bfefd5) },
+  { _zNumU64(0x1485ce9e,0x7a065ea4), _zNumU64(0xb747cf95,0x16efebca) },
+  { _zNumU64(0x19a74246,0x1887f64d), _zNumU64(0xe519c37a,0x5cabe6bd) },
+  { _zNumU64(0x1008896b,0xcf54f9f0), _zNumU64(0xaf301a2c,0x79eb7036) },
+  { _zNumU64(0x140aabc6,0xc32a386c), _zNumU64(0xdafc20b7,0x98664c43) },
+  { _zNumU64(0x190d56b8,0x73f4c688), _zNumU64(0x11bb28e5,0x7e7fdf54) },
+  { _zNumU64(0x1f50ac66,0x90f1f82a), _zNumU64(0x1629f31e,0xde1fd72a) },
+  { _zNumU64(0x13926bc0,0x1a973b1a), _zNumU64(0x4dda37f3,0x4ad3e67a) },
+  { _zNumU64(0x187706b0,0x213d09e0), _zNumU64(0xe150c5f0,0x1d88e019) },
+  { _zNumU64(0x1e94c85c,0x298c4c59), _zNumU64(0x19a4f76c,0x24eb181f) },
+  { _zNumU64(0x131cfd39,0x99f7afb7), _zNumU64(0xb0071aa3,0x9712ef13) },
+  { _zNumU64(0x17e43c88,0x00759ba5), _zNumU64(0x9c08e14c,0x7cd7aad8) },
+  { _zNumU64(0x1ddd4baa,0x0093028f), _zNumU64(0x030b199f,0x9c0d958e) },
+  { _zNumU64(0x12aa4f4a,0x405be199), _zNumU64(0x61e6f003,0xc1887d79) },
+  { _zNumU64(0x1754e31c,0xd072d9ff), _zNumU64(0xba60ac04,0xb1ea9cd7) },
+  { _zNumU64(0x1d2a1be4,0x048f907f), _zNumU64(0xa8f8d705,0xde65440d) },
+  { _zNumU64(0x123a516e,0x82d9ba4f), _zNumU64(0xc99b8663,0xaaff4a88) },
+  { _zNumU64(0x16c8e5ca,0x239028e3), _zNumU64(0xbc0267fc,0x95bf1d2a) },
+  { _zNumU64(0x1c7b1f3c,0xac74331c), _zNumU64(0xab0301fb,0xbb2ee474) },
+  { _zNumU64(0x11ccf385,0xebc89ff1), _zNumU64(0xeae1e13d,0x54fd4ec9) },
+  { _zNumU64(0x16403067,0x66bac7ee), _zNumU64(0x659a598c,0xaa3ca27b) },
+  { _zNumU64(0x1bd03c81,0x406979e9), _zNumU64(0xff00efef,0xd4cbcb1a) },
+  { _zNumU64(0x116225d0,0xc841ec32), _zNumU64(0x3f6095f5,0xe4ff5ef0) },
+  { _zNumU64(0x15baaf44,0xfa52673e), _zNumU64(0xcf38bb73,0x5e3f36ac) },
+  { _zNumU64(0x1b295b16,0x38e7010e), _zNumU64(0x8306ea50,0x35cf0457) },
+  { _zNumU64(0x10f9d8ed,0xe39060a9), _zNumU64(0x11e45272,0x21a162b6) },
+  { _zNumU64(0x15384f29,0x5c7478d3), _zNumU64(0x565d670e,0xaa09bb64) },
+  { _zNumU64(0x1a8662f3,0xb3919708), _zNumU64(0x2bf4c0d2,0x548c2a3d) },
+  { _zNumU64(0x1093fdd8,0x503afe65), _zNumU64(0x1b78f883,0x74d79a66) },
+  { _zNumU64(0x14b8fd4e,0x6449bdfe), _zNumU64(0x625736a4,0x520d8100) },
+  { _zNumU64(0x19e73ca1,0xfd5c2d7d), _zNumU64(0xfaed044d,0x6690e140) },
+  { _zNumU64(0x103085e5,0x3e599c6e), _zNumU64(0xbcd422b0,0x601a8cc8) },
+  { _zNumU64(0x143ca75e,0x8df0038a), _zNumU64(0x6c092b5c,0x78212ffa) },
+  { _zNumU64(0x194bd136,0x316c046d), _zNumU64(0x070b7633,0x96297bf8) },
+  { _zNumU64(0x1f9ec583,0xbdc70588), _zNumU64(0x48ce53c0,0x7bb3daf6) },
+  { _zNumU64(0x13c33b72,0x569c6375), _zNumU64(0x2d80f458,0x4d5068da) },
+  { _zNumU64(0x18b40a4e,0xec437c52), _zNumU64(0x78e1316e,0x60a48310) }
+};
+
+/* bit length of 5^e */
+#define _zNumPow5Bits(e)  ( (int)( ( (uint32_t)(e) * 1217359 ) >> 19 ) + 1 )
+/* floor(log10(2^e)) */
+#define _zNumLog10Pow2(e) ( (int)( ( (uint32_t)(e) * 78913 ) >> 18 ) )
+/* floor(log10(5^e)) */
+#define _zNumLog10Pow5(e) ( (int)( ( (uint32_t)(e) * 732923 ) >> 20 ) )
+
+/* check if a 64-bit unsigned integer is divisible by 5^p. */
+static bool _zNumIsMultipleOfPow5(uint64_t val, int p)
+{
+  int count;
+
+  for( count=0; val % 5 == 0; val /= 5 )
+    if( ++count >= p ) return true;
+  return count >= p;
+}
+
+/* (m * mul) >> j for a 125-bit multiplier, where 64 < j < 128. */
+static uint64_t _zNumMulShift(uint64_t m, const _zNumU128 *mul, int j)
+{
+  _zNumU128 b0, b2;
+  uint64_t lo, hi;
+
+  b0 = _zNumMul( m, mul->lo );
+  b2 = _zNumMul( m, mul->hi );
+  lo = b0.hi + b2.lo;
+  hi = b2.hi + ( lo < b0.hi ? 1 : 0 );
+  j -= 64;
+  return ( hi << ( 64 - j ) ) | ( lo >> j );
+}
+
+/* the shortest decimal digits of a finite positive double-precision floating-point value
+ * that is correctly read back (Ryu algorithm). */
+static uint64_t _zNumShortest(uint64_t mantissa, int exponent, int *e10)
+{
+  uint64_t m2, mv, vr, vp, vm, output;
+  int e2, q, i, k, mmshift, removed = 0, lastdigit = 0;
+  bool even, vm_trailing = false, vr_trailing = false, roundup = false;
+
+  if( exponent == 0 ){
+    e2 = 1 - 1023 - 52 - 2;
+    m2 = mantissa;
+  } else{
+    e2 = exponent - 1023 - 52 - 2;
+    m2 = ( (uint64_t)1 << 52 ) | mantissa;
+  }
+  even = ( m2 & 1 ) == 0;
+  mv = 4 * m2;
+  mmshift = mantissa != 0 || exponent <= 1 ? 1 : 0;
+  /* the value and its halfway bounds in decimal */
+  if( e2 >= 0 ){
+    q = _zNumLog10Pow2( e2 ) - ( e2 > 3 ? 1 : 0 );
+    *e10 = q;
+    k = ZEDA_NUM_POW5_INV_BITCOUNT + _zNumPow5Bits( q ) - 1;
+    i = -e2 + q + k;
+    vr = _zNumMulShift( 4 * m2, &_znum_pow5_inv[q], i );
+    vp = _zNumMulShift( 4 * m2 + 2, &_znum_pow5_inv[q], i );
+    vm = _zNumMulShift( 4 * m2 - 1 - mmshift, &_znum_pow5_inv[q], i );
+    if( q <= 21 ){
+      if( mv % 5 == 0 )
+        vr_trailing = _zNumIsMultipleOfPow5( mv, q );
+      else if( even )
+        vm_trailing = _zNumIsMultipleOfPow5( mv - 1 - mmshift, q );
+      else
+        vp -= _zNumIsMultipleOfPow5( mv + 2, q ) ? 1 : 0;
+    }
+  } else{
+    q = _zNumLog10Pow5( -e2 ) - ( -e2 > 1 ? 1 : 0 );
+    *e10 = q + e2;
+    i = -e2 - q;
+    k = _zNumPow5Bits( i ) - ZEDA_NUM_POW5_BITCOUNT;
+    vr = _zNumMulShift( 4 * m2, &_znum_pow5_ryu[i], q - k );
+    vp = _zNumMulShift( 4 * m2 + 2, &_znum_pow5_ryu[i], q - k );
+    vm = _zNumMulShift( 4 * m2 - 1 - mmshift, &_znum_pow5_ryu[i], q - k );
+    if( q <= 1 ){
+      vr_trailing = true;
+      if( even )
+        vm_trailing = mmshift == 1;
+      else
+        vp--;
+    } else if( q < 63 )
+      vr_trailing = ( mv & ( ( (uint64_t)1 << q ) - 1 ) ) == 0;
+  }
+  /* remove digits while the bounds differ */
+  if( vm_trailing || vr_trailing ){
+    for( ; vp / 10 > vm / 10; vr /= 10, vp /= 10, vm /= 10, removed++ ){
+      vm_trailing = vm_trailing && vm % 10 == 0;
+      vr_trailing = vr_trailing && lastdigit == 0;
+      lastdigit = (int)( vr % 10 );
+    }
+    if( vm_trailing && even )
+      for( ; vm % 10 == 0; vr /= 10, vp /= 10, vm /= 10, removed++ ){
+        vr_trailing = vr_trailing && lastdigit == 0;
+        lastdigit = (int)( vr % 10 );
+      }
+    if( vr_trailing && lastdigit == 5 && vr % 2 == 0 ) lastdigit = 4; /* round to even */
+    output = vr + ( ( vr == vm && ( !even || !vm_trailing ) ) || lastdigit >= 5 ? 1 : 0 );
+  } else{
+    for( ; vp / 10 > vm / 10; vr /= 10, vp /= 10, vm /= 10, removed++ )
+      roundup = vr % 10 >= 5;
+    output = vr + ( vr == vm || roundup ? 1 : 0 );
+  }
+  *e10 += removed;
+  return output;
+}
+
+/* format a double-precision floating-point value to a string. */
+size_t zNumFormatDouble(double val, char *buf)
+{
+  uint64_t bits, mantissa, output;
+  int exponent, e10, pos;
+  char digit[20];
+  size_t n = 0, len;
+
+  memcpy( &bits, &val, sizeof(double) );
+  mantissa = bits & ( ( (uint64_t)1 << 52 ) - 1 );
+  exponent = (int)( ( bits >> 52 ) & 0x7ff );
+  if( exponent == 0x7ff ){ /* infinity or NaN */
+    strcpy( buf, mantissa != 0 ? "nan" : bits >> 63 ? "-inf" : "inf" );
+    return strlen( buf );
+  }
+  if( bits >> 63 ) buf[n++] = '-';
+  if( exponent == 0 && mantissa == 0 ){
+    strcpy( buf+n, "0" );
+    return n + 1;
+  }
+  output = _zNumShortest( mantissa, exponent, &e10 );
+  len = _zNumFormatU64( output, digit );
+  /* the exponent of the first digit decides the format in the same way with %g */
+  if( ( pos = (int)len + e10 ) - 1 < -4 || pos - 1 >= ZEDA_NUM_DIGIT_SHORTEST_MAX ){
+    buf[n++] = digit[0];
+    if( len > 1 ){
+      buf[n++] = '.';
+      memcpy( buf+n, digit+1, len-1 );
+      n += len - 1;
+    }
+    buf[n++] = 'e';
+    if( --pos < 0 ){
+      buf[n++] = '-';
+      pos = -pos;
+    } else
+      buf[n++] = '+';
+    if( pos < 10 ) buf[n++] = '0';
+    n += _zNumFormatU64( (uint64_t)pos, buf+n );
+  } else
+  if( e10 >= 0 ){ /* integer */
+    memcpy( buf+n, digit, len );
+    memset( buf+n+len, '0', e10 );
+    n += len + e10;
+  } else
+  if( pos > 0 ){
+    memcpy( buf+n, digit, pos );
+    buf[n+pos] = '.';
+    memcpy( buf+n+pos+1, digit+pos, len-pos );
+    n += len + 1;
+  } else{
+    buf[n++] = '0';
+    buf[n++] = '.';
+    memset( buf+n, '0', -pos );
+    memcpy( buf+n-pos, digit, len );
+    n += len - pos;
+  }
+  buf[n] = '\0';
+  return n;
+}
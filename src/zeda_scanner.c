@@ -0,0 +1,344 @@
+/* ZEDA - Elementary Data and Algorithms
+ * Copyright (C) 1998 Tomomichi Sugihara (Zhidao)
+ *
+ * zeda_scanner - buffered scanner of texts.
+ */
+
+#if !defined( _WIN32 ) && !defined( _POSIX_C_SOURCE )
+#define _POSIX_C_SOURCE 200809L /* for fileno() and mmap() */
+#endif
+
+#include <zeda/zeda_scanner.h>
+#include <ctype.h>
+
+/* files are mapped onto memory if available. */
+#if !defined( __WINDOWS__ ) && defined( _POSIX_C_SOURCE ) && _POSIX_C_SOURCE >= 200112L
+#define __ZEDA_SCANNER_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/* ********************************************************** */
+/* buffered scanner of texts.
+ *//* ******************************************************* */
+
+/* clear a scanner. */
+static zScanner *_zScannerInit(zScanner *scanner)
+{
+  scanner->cur = scanner->end = scanner->tkn = scanner->_mark = NULL;
+  scanner->tknlen = 0;
+  scanner->_buf = NULL;
+  scanner->_size = 0;
+  scanner->_fp = NULL;
+  scanner->_map = NULL;
+  scanner->_mapsize = 0;
+  scanner->config = zTokenizerConfigCurrent();
+  return scanner;
+}
+
+/* initialize a scanner of a memory buffer. */
+zScanner *zScannerInitMem(zScanner *scanner, const char *buf, size_t len)
+{
+  _zScannerInit( scanner );
+  scanner->cur = buf;
+  scanner->end = buf + len;
+  return scanner;
+}
+
+/* initialize a scanner of a file stream with an internal buffer. */
+zScanner *zScannerInitFP(zScanner *scanner, FILE *fp, size_t size)
+{
+  _zScannerInit( scanner );
+  if( size == 0 ) size = ZEDA_SCANNER_BUFSIZ;
+  if( !( scanner->_buf = zAlloc( char, size ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  scanner->_size = size;
+  scanner->_fp = fp;
+  scanner->cur = scanner->end = scanner->_buf;
+  return scanner;
+}
+
+/* initialize a scanner of a file mapped onto memory. */
+zScanner *zScannerMapFP(zScanner *scanner, FILE *fp)
+{
+#ifdef __ZEDA_SCANNER_MMAP
+  struct stat st;
+  long pos;
+  void *map;
+
+  if( fstat( fileno( fp ), &st ) == 0 && S_ISREG( st.st_mode ) && st.st_size > 0 &&
+      ( pos = ftell( fp ) ) >= 0 && pos <= st.st_size &&
+      ( map = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fileno( fp ), 0 ) ) != MAP_FAILED ){
+    _zScannerInit( scanner );
+    scanner->_fp = fp;
+    scanner->_map = map;
+    scanner->_mapsize = st.st_size;
+    scanner->cur = (const char *)map + pos;
+    scanner->end = (const char *)map + st.st_size;
+    return scanner;
+  }
+#endif /* __ZEDA_SCANNER_MMAP */
+  return zScannerInitFP( scanner, fp, 0 );
+}
+
+/* destroy a scanner. */
+void zScannerDestroy(zScanner *scanner)
+{
+  if( scanner->_fp ){ /* move the file position to the charactor next to the last one scanned */
+#ifdef __ZEDA_SCANNER_MMAP
+    if( scanner->_map ){
+      fseek( scanner->_fp, scanner->cur - (const char *)scanner->_map, SEEK_SET );
+      munmap( scanner->_map, scanner->_mapsize );
+    } else
+#endif /* __ZEDA_SCANNER_MMAP */
+    if( scanner->end > scanner->cur )
+      fseek( scanner->_fp, -(long)( scanner->end - scanner->cur ), SEEK_CUR );
+  }
+  free( scanner->_buf );
+  _zScannerInit( scanner );
+}
+
+/* refill the internal buffer of a scanner, keeping the last token. */
+static bool _zScannerRefill(zScanner *scanner, size_t n)
+{
+  const char *head;
+  char *buf;
+  size_t head_offset, tkn_offset, offset, keep, size;
+
+  if( !scanner->_buf || feof( scanner->_fp ) ) return false;
+  head = scanner->_mark ? scanner->_mark : scanner->cur;
+  tkn_offset = scanner->_mark ? scanner->tkn - scanner->_mark : 0;
+  offset = scanner->cur - head;
+  keep = scanner->end - head;
+  if( offset + n > scanner->_size ){ /* enlarge the buffer for a long token */
+    for( size=scanner->_size*2; size<offset+n; size*=2 );
+    head_offset = head - scanner->_buf;
+    if( !( buf = zRealloc( scanner->_buf, char, size ) ) ){
+      ZALLOCERROR();
+      return false;
+    }
+    head = buf + head_offset;
+    scanner->_buf = buf;
+    scanner->_size = size;
+  }
+  memmove( scanner->_buf, head, keep );
+  if( scanner->_mark ){
+    scanner->_mark = scanner->_buf;
+    scanner->tkn = scanner->_buf + tkn_offset;
+  }
+  scanner->cur = scanner->_buf + offset;
+  scanner->end = scanner->_buf + keep;
+  size = fread( scanner->_buf + keep, sizeof(char), scanner->_size - keep, scanner->_fp );
+  scanner->end += size;
+  return size > 0;
+}
+
+/* fill the buffer of a scanner until a number of bytes are stored ahead. */
+bool zScannerFill(zScanner *scanner, size_t n)
+{
+  while( (size_t)( scanner->end - scanner->cur ) < n )
+    if( !_zScannerRefill( scanner, n ) ) return false;
+  return true;
+}
+
+/* look up a charactor ahead of the current position of a scanner. */
+int zScannerPeek(zScanner *scanner, size_t n)
+{
+  return zScannerFill( scanner, n+1 ) ? (ubyte)scanner->cur[n] : EOF;
+}
+
+/* ********************************************************** */
+/* tokenizers on a scanner.
+ *//* ******************************************************* */
+
+/* clear the last token of a scanner. */
+void zScannerClearToken(zScanner *scanner)
+{
+  scanner->tkn = scanner->_mark = NULL;
+  scanner->tknlen = 0;
+}
+
+/* mark the head of a token at the current position of a scanner. */
+static void _zScannerMarkToken(zScanner *scanner)
+{
+  scanner->tkn = scanner->_mark = scanner->cur;
+  scanner->tknlen = 0;
+}
+
+/* set a token from the marked position of a scanner. */
+static bool _zScannerSetToken(zScanner *scanner, size_t offset, size_t len, size_t next)
+{
+  scanner->tkn = scanner->_mark + offset;
+  scanner->tknlen = len;
+  scanner->cur = scanner->_mark + next;
+  return true;
+}
+
+/* skip delimiters of a scanner. */
+static int _zScanSkipDelimiter(zScanner *scanner)
+{
+  do{
+    if( ( scanner->cur = zTokenizerMemSkipDelimiter( scanner->config, scanner->cur, scanner->end ) ) < scanner->end )
+      return *scanner->cur ? (ubyte)*scanner->cur : EOF;
+  } while( zScannerFill( scanner, 1 ) );
+  return EOF;
+}
+
+/* skip delimiters and comments of a scanner. */
+static int _zScanSkipComment(zScanner *scanner)
+{
+  int c;
+  char ident;
+
+  ident = scanner->config->comment_ident;
+  while( ( c = _zScanSkipDelimiter( scanner ) ) != EOF && (char)c == ident )
+    while( !zScannerIsEnd(scanner) )
+      if( *scanner->cur++ == '\n' ) break;
+  return c;
+}
+
+/* skip delimiters of a scanner. */
+int zScanSkipDelimiter(zScanner *scanner)
+{
+  zScannerClearToken( scanner );
+  return _zScanSkipDelimiter( scanner );
+}
+
+/* skip delimiters and comments of a scanner. */
+int zScanSkipComment(zScanner *scanner)
+{
+  zScannerClearToken( scanner );
+  return _zScanSkipComment( scanner );
+}
+
+/* check if the last token of a scanner is a key. */
+bool zScanPostCheckKey(zScanner *scanner)
+{
+  char ident;
+
+  ident = scanner->config->key_ident;
+  for( ; !zScannerIsEnd(scanner); scanner->cur++ ){
+    if( *scanner->cur == ident ){
+      scanner->cur++;
+      return true;
+    }
+    if( !zTokenizerIsDelimiter( scanner->config, *scanner->cur ) ) break;
+  }
+  return false;
+}
+
+/* find the end identifier of a fenced token at the current position of a scanner. */
+static bool _zScanFence(zScanner *scanner, char end_ident, size_t *i)
+{
+  for( *i=1; zScannerFill( scanner, *i+1 ) && scanner->cur[*i]; (*i)++ )
+    if( scanner->cur[*i] == end_ident && scanner->cur[*i-1] != '\\' ) return true;
+  return false;
+}
+
+/* get a token of a scanner without copying it. */
+bool zScanToken(zScanner *scanner)
+{
+  size_t i, j;
+  char c;
+
+  zScannerClearToken( scanner );
+  if( _zScanSkipComment( scanner ) == EOF ) return false;
+  _zScannerMarkToken( scanner );
+  if( ( c = *scanner->cur ) == '\"' || c == '\'' ){ /* quoted string */
+    if( _zScanFence( scanner, c, &i ) )
+      return _zScannerSetToken( scanner, 1, i - 1, i + 1 );
+    /* unterminated string; unfenced at the last quotation mark */
+    for( j=i; j>1 && scanner->cur[j-1]!=c; j-- );
+    return _zScannerSetToken( scanner, 1, ( j > 1 ? j - 1 : i ) - 1, i );
+  }
+  if( c == scanner->config->tag_begin_ident ){ /* tag */
+    if( _zScanFence( scanner, scanner->config->tag_end_ident, &i ) ) i++;
+    return _zScannerSetToken( scanner, 0, i, i );
+  }
+  do{
+    scanner->cur = zTokenizerMemSkipToken( scanner->config, scanner->cur, scanner->end );
+  } while( scanner->cur == scanner->end && zScannerFill( scanner, 1 ) );
+  return _zScannerSetToken( scanner, 0, scanner->cur - scanner->_mark, scanner->cur - scanner->_mark );
+}
+
+/* count digits from a position ahead of the current position of a scanner. */
+static size_t _zScanDigits(zScanner *scanner, size_t i)
+{
+  for( ; zScannerFill( scanner, i+1 ) && isdigit( (ubyte)scanner->cur[i] ); i++ );
+  return i;
+}
+
+/* find the end of an unsigned real number ahead of the current position of a scanner. */
+static size_t _zScanUnsigned(zScanner *scanner, size_t i)
+{
+  i = _zScanDigits( scanner, i );
+  if( zScannerFill( scanner, i+1 ) && scanner->cur[i] == '.' )
+    i = _zScanDigits( scanner, i+1 );
+  return i;
+}
+
+/* find the end of a signed real number ahead of the current position of a scanner. */
+static size_t _zScanSigned(zScanner *scanner, size_t i)
+{
+  size_t j;
+
+  if( !zScannerFill( scanner, i+1 ) || ( scanner->cur[i] != '+' && scanner->cur[i] != '-' ) )
+    return _zScanUnsigned( scanner, i );
+  return ( j = _zScanUnsigned( scanner, i+1 ) ) > i+1 ? j : i;
+}
+
+/* get a token that represents an integer number of a scanner without copying it. */
+bool zScanIntToken(zScanner *scanner)
+{
+  size_t i;
+
+  _zScannerMarkToken( scanner );
+  i = _zScanDigits( scanner, 0 );
+  return _zScannerSetToken( scanner, 0, i, i ) && i > 0;
+}
+
+/* get a token that represents a real number of a scanner without copying it. */
+bool zScanNumToken(zScanner *scanner)
+{
+  size_t i, j;
+
+  _zScannerMarkToken( scanner );
+  if( ( i = _zScanSigned( scanner, 0 ) ) > 0 && zScannerFill( scanner, i+1 ) &&
+      ( scanner->cur[i] == 'e' || scanner->cur[i] == 'E' ) &&
+      ( j = _zScanSigned( scanner, i+1 ) ) > i+1 ) i = j;
+  return _zScannerSetToken( scanner, 0, i, i ) && i > 0;
+}
+
+/* get a token of a scanner and copy it to a buffer. */
+char *zScanTokenCopy(zScanner *scanner, char *tkn, size_t size)
+{
+  size_t len;
+
+  *tkn = '\0';
+  if( !zScanToken( scanner ) ) return NULL;
+  if( ( len = scanner->tknlen ) >= size ){
+    ZRUNWARN( ZEDA_WARN_TOOLONG_TOKEN );
+    len = size - 1;
+  }
+  memcpy( tkn, scanner->tkn, len );
+  tkn[len] = '\0';
+  return tkn;
+}
+
+/* get an integer value of a scanner. */
+bool zScanInt(zScanner *scanner, int *val)
+{
+  if( !zScanToken( scanner ) ) return false;
+  zNumParseInt( scanner->tkn, scanner->tknlen, val );
+  return true;
+}
+
+/* get a double-precision floating-point value of a scanner. */
+bool zScanDouble(zScanner *scanner, double *val)
+{
+  if( !zScanToken( scanner ) ) return false;
+  zNumParseDouble( scanner->tkn, scanner->tknlen, val );
+  return true;
+}
@@ -37,6 +37,45 @@ char *zStrClone(const char *str)
   return str ? zClone( str, char, strlen(str)+1 ) : NULL;
 }
 
+/* clone a part of a string. */
+char *zStrCloneN(const char *str, size_t len)
+{
+  char *dest;
+
+  if( !str ) return NULL;
+  if( !( dest = zAlloc( char, len+1 ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  memcpy( dest, str, len );
+  dest[len] = '\0';
+  return dest;
+}
+
+/* hash value of a string (FNV-1a). */
+ulong zStrHash(const char *str)
+{
+  ulong hash = 2166136261UL;
+
+  for( ; *str; str++ ){
+    hash ^= (ubyte)*str;
+    hash *= 16777619UL;
+  }
+  return hash & 0xffffffffUL;
+}
+
+/* hash value of a string with a length (FNV-1a). */
+ulong zStrHashN(const char *str, size_t len)
+{
+  ulong hash = 2166136261UL;
+
+  for( ; len>0; str++, len-- ){
+    hash ^= (ubyte)*str;
+    hash *= 16777619UL;
+  }
+  return hash & 0xffffffffUL;
+}
+
 /* concatenate a string with another. */
 char *zStrCat(char *dest, const char *src, size_t size)
 {
@@ -190,26 +229,139 @@ char *zStrToLower(const char *src, size_t size, char *dest)
 }
 
 #ifndef __KERNEL__
+/* thread-local storage */
+#if defined( __GNUC__ )
+#define __ZEDA_THREAD_LOCAL __thread
+#elif defined( _MSC_VER )
+#define __ZEDA_THREAD_LOCAL __declspec( thread )
+#else
+#define __ZEDA_THREAD_LOCAL
+#endif
+
 static const char zeda_delimiter_default[] = {
   (char)EOF, '\t', '\v', '\f', '\n', '\r',
   ' ', ',', ';', ':', '|', '(', ')', '{', '}', '\0'
 };
-static const char *zeda_delimiter = zeda_delimiter_default;
+
+static const char zeda_operator_default[] = {
+  '!', '%', '&', '*', '+', '-', '/', '<', '=', '>',
+  '?', '@', '\\', '^', '~', '\0',
+};
+
+/* delimiters broadcasted to vectors for zTokenizerMemSkipDelimiter() and zTokenizerMemSkipToken(). */
+#define _zDelimiterVec(c) { c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c }
+
+/* the default configuration of tokenizers. */
+static zTokenizerConfig zeda_tokenizer_default = {
+  { /* classes of charactors for the default delimiters, operators and comment identifier */
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 0, 0, 0, 6, 2, 0, 1, 1, 2, 2, 1, 2, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+  },
+  {
+    _zDelimiterVec(0xff), _zDelimiterVec('\t'), _zDelimiterVec('\v'), _zDelimiterVec('\f'),
+    _zDelimiterVec('\n'), _zDelimiterVec('\r'), _zDelimiterVec(' '), _zDelimiterVec(','),
+    _zDelimiterVec(';'), _zDelimiterVec(':'), _zDelimiterVec('|'), _zDelimiterVec('('),
+    _zDelimiterVec(')'), _zDelimiterVec('{'), _zDelimiterVec('}'),
+  },
+  15,
+  zeda_delimiter_default,
+  zeda_operator_default,
+  ZDEFAULT_COMMENT_IDENT,
+  ZDEFAULT_TAG_BEGIN_IDENT,
+  ZDEFAULT_TAG_END_IDENT,
+  ZDEFAULT_KEY_IDENT,
+};
+
+/* the current configuration of tokenizers of each thread (the default one if null). */
+static __ZEDA_THREAD_LOCAL zTokenizerConfig *zeda_tokenizer = NULL;
+
+/* select the current configuration of tokenizers. */
+zTokenizerConfig *zTokenizerConfigSelect(zTokenizerConfig *config)
+{
+  zTokenizerConfig *prev;
+
+  prev = zTokenizerConfigCurrent();
+  zeda_tokenizer = config;
+  return prev;
+}
+
+/* the current configuration of tokenizers. */
+zTokenizerConfig *zTokenizerConfigCurrent(void)
+{
+  return zeda_tokenizer ? zeda_tokenizer : &zeda_tokenizer_default;
+}
+
+/* rebuild a class of charactors in the table. */
+static void _zCharClassSet(zTokenizerConfig *config, ubyte cls, const char s[])
+{
+  uint i;
+
+  for( i=0; i<0x100; i++ ) config->char_class[i] &= ~cls;
+  for( ; *s; s++ ) zTokenizerCharClass(config,*s) |= cls;
+}
+
+/* rebuild the vectors of delimiters. */
+static void _zDelimiterVecSet(zTokenizerConfig *config, const char s[])
+{
+  config->delimiter_vec_num = 0;
+  for( ; *s; s++ ){
+    if( config->delimiter_vec_num == ZEDA_DELIMITER_VEC_MAX ){
+      config->delimiter_vec_num = -1;
+      return;
+    }
+    memset( config->delimiter_vec[config->delimiter_vec_num++], (ubyte)*s, 32 );
+  }
+}
+
+/* initialize a configuration of tokenizers. */
+zTokenizerConfig *zTokenizerConfigInit(zTokenizerConfig *config)
+{
+  memset( config->char_class, 0, sizeof(config->char_class) );
+  zTokenizerConfigSetDelimiter( config, zeda_delimiter_default );
+  zTokenizerConfigSetOperator( config, zeda_operator_default );
+  zTokenizerConfigSetCommentIdent( config, ZDEFAULT_COMMENT_IDENT );
+  zTokenizerConfigSetTagIdent( config, ZDEFAULT_TAG_BEGIN_IDENT, ZDEFAULT_TAG_END_IDENT );
+  zTokenizerConfigSetKeyIdent( config, ZDEFAULT_KEY_IDENT );
+  return config;
+}
+
+/* specify a set of delimiters of a configuration of tokenizers. */
+void zTokenizerConfigSetDelimiter(zTokenizerConfig *config, const char s[])
+{
+  config->delimiter = s;
+  _zCharClassSet( config, ZEDA_CHAR_DELIMITER, s );
+  _zDelimiterVecSet( config, s );
+}
 
 /* specify a set of delimiters. */
-void zSetDelimiter(const char s[]){ zeda_delimiter = s; }
+void zSetDelimiter(const char s[]){ zTokenizerConfigSetDelimiter( zTokenizerConfigCurrent(), s ); }
 
 /* reset a set of delimiters. */
 void zResetDelimiter(void){ zSetDelimiter( zeda_delimiter_default ); }
 
-static const char zeda_operator_default[] = {
-  '!', '%', '&', '*', '+', '-', '/', '<', '=', '>',
-  '?', '@', '\\', '^', '~', '\0',
-};
-static const char *zeda_operator = zeda_operator_default;
+/* specify a set of operators of a configuration of tokenizers. */
+void zTokenizerConfigSetOperator(zTokenizerConfig *config, const char s[])
+{
+  config->operators = s;
+  _zCharClassSet( config, ZEDA_CHAR_OPERATOR, s );
+}
 
 /* specify a set of operators. */
-void zSetOperator(const char s[]){ zeda_operator = s; }
+void zSetOperator(const char s[]){ zTokenizerConfigSetOperator( zTokenizerConfigCurrent(), s ); }
 
 /* reset a set of operators. */
 void zResetOperator(void){ zSetOperator( zeda_operator_default ); }
@@ -224,13 +376,13 @@ bool zIsIncludedChar(char c, const char *s)
 /* check if a charactor is a delimiter. */
 bool zIsDelimiter(char c)
 {
-  return zIsIncludedChar( c, zeda_delimiter );
+  return _zIsDelimiter( c ) ? true : false;
 }
 
 /* check if a charactor is an operator. */
 bool zIsOperator(char c)
 {
-  return zIsIncludedChar( c, zeda_operator );
+  return _zIsOperator( c ) ? true : false;
 }
 
 /* check if a string represents a hexadecimal number. */
@@ -284,32 +436,144 @@ char *zSSkipIncludedChar(char *str, const char *s)
 /* skip delimiters in a file. */
 char zFSkipDelimiter(FILE *fp)
 {
-  return zFSkipIncludedChar( fp, zeda_delimiter );
+  const zTokenizerConfig *config;
+  char c;
+
+  config = zTokenizerConfigCurrent();
+  do{
+    c = fgetc( fp );
+    if( feof( fp ) ) return (char)0;
+  } while( zTokenizerIsDelimiter( config, c ) );
+  ungetc( c, fp );
+  return c;
 }
 
 /* skip delimiters in a string. */
 char *zSSkipDelimiter(char *str)
 {
-  return zSSkipIncludedChar( str, zeda_delimiter );
+  const zTokenizerConfig *config;
+
+  config = zTokenizerConfigCurrent();
+  for( ; *str && zTokenizerIsDelimiter(config,*str); str++ );
+  return str;
+}
+
+/* vectorized scan of memory buffers. */
+#if defined( __GNUC__ ) && defined( __AVX2__ )
+#include <immintrin.h>
+#define ZEDA_MEM_VEC_SIZE 32
+typedef __m256i _zMemVec;
+#define _zMemVecLoad(p)      _mm256_loadu_si256( (const __m256i *)(p) )
+#define _zMemVecZero()       _mm256_setzero_si256()
+#define _zMemVecEq(v1,v2)    _mm256_cmpeq_epi8( v1, v2 )
+#define _zMemVecOr(v1,v2)    _mm256_or_si256( v1, v2 )
+#define _zMemVecAnd(v1,v2)   _mm256_and_si256( v1, v2 )
+#define _zMemVecSet(c)       _mm256_set1_epi8( c )
+#define _zMemVecMask(v)      (uint)_mm256_movemask_epi8( v )
+#define ZEDA_MEM_VEC_FULL    0xffffffffU
+#elif defined( __GNUC__ ) && defined( __SSE2__ )
+#include <emmintrin.h>
+#define ZEDA_MEM_VEC_SIZE 16
+typedef __m128i _zMemVec;
+#define _zMemVecLoad(p)      _mm_loadu_si128( (const __m128i *)(p) )
+#define _zMemVecZero()       _mm_setzero_si128()
+#define _zMemVecEq(v1,v2)    _mm_cmpeq_epi8( v1, v2 )
+#define _zMemVecOr(v1,v2)    _mm_or_si128( v1, v2 )
+#define _zMemVecAnd(v1,v2)   _mm_and_si128( v1, v2 )
+#define _zMemVecSet(c)       _mm_set1_epi8( c )
+#define _zMemVecMask(v)      (uint)_mm_movemask_epi8( v )
+#define ZEDA_MEM_VEC_FULL    0xffffU
+#endif
+
+/* short runs are scanned by table lookup before vectorized scan */
+#define ZEDA_MEM_SCALAR_RUN 8
+
+#ifdef ZEDA_MEM_VEC_SIZE
+/* a bitmap of delimiters in a block of a memory buffer. */
+static uint _zMemDelimiterMask(const zTokenizerConfig *config, _zMemVec v)
+{
+  _zMemVec m;
+  int i;
+
+  m = _zMemVecZero();
+  for( i=0; i<config->delimiter_vec_num; i++ )
+    m = _zMemVecOr( m, _zMemVecEq( v, _zMemVecLoad( config->delimiter_vec[i] ) ) );
+  return _zMemVecMask( m );
 }
+#endif /* ZEDA_MEM_VEC_SIZE */
 
-static char zcommentident = ZDEFAULT_COMMENT_IDENT;
+/* skip delimiters in a memory buffer. */
+const char *zTokenizerMemSkipDelimiter(const zTokenizerConfig *config, const char *str, const char *end)
+{
+  const char *run;
+#ifdef ZEDA_MEM_VEC_SIZE
+  uint mask;
+#endif /* ZEDA_MEM_VEC_SIZE */
+
+  for( run=str+ZEDA_MEM_SCALAR_RUN; str<end && str<run; str++ )
+    if( !zTokenizerIsDelimiter(config,*str) ) return str;
+#ifdef ZEDA_MEM_VEC_SIZE
+  if( config->delimiter_vec_num >= 0 )
+    for( ; end - str >= ZEDA_MEM_VEC_SIZE; str+=ZEDA_MEM_VEC_SIZE )
+      if( ( mask = _zMemDelimiterMask( config, _zMemVecLoad( str ) ) ) != ZEDA_MEM_VEC_FULL )
+        return str + __builtin_ctz( ~mask );
+#endif /* ZEDA_MEM_VEC_SIZE */
+  for( ; str<end && zTokenizerIsDelimiter(config,*str); str++ );
+  return str;
+}
+
+/* skip a token until a delimiter or the null charactor in a memory buffer. */
+const char *zTokenizerMemSkipToken(const zTokenizerConfig *config, const char *str, const char *end)
+{
+  const char *run;
+#ifdef ZEDA_MEM_VEC_SIZE
+  _zMemVec v;
+  uint mask;
+#endif /* ZEDA_MEM_VEC_SIZE */
+
+  for( run=str+ZEDA_MEM_SCALAR_RUN; str<end && str<run; str++ )
+    if( !*str || zTokenizerIsDelimiter(config,*str) ) return str;
+#ifdef ZEDA_MEM_VEC_SIZE
+  if( config->delimiter_vec_num >= 0 )
+    for( ; end - str >= ZEDA_MEM_VEC_SIZE; str+=ZEDA_MEM_VEC_SIZE ){
+      v = _zMemVecLoad( str );
+      if( ( mask = _zMemDelimiterMask( config, v ) | _zMemVecMask( _zMemVecEq( v, _zMemVecZero() ) ) ) )
+        return str + __builtin_ctz( mask );
+    }
+#endif /* ZEDA_MEM_VEC_SIZE */
+  for( ; str<end && *str && !zTokenizerIsDelimiter(config,*str); str++ );
+  return str;
+}
+
+/* specify the comment identifier of a configuration of tokenizers. */
+void zTokenizerConfigSetCommentIdent(zTokenizerConfig *config, char ident)
+{
+  char s[2];
+
+  s[0] = config->comment_ident = ident;
+  s[1] = '\0';
+  _zCharClassSet( config, ZEDA_CHAR_COMMENT, s );
+}
 
 /* specify the comment identifier. */
-void zSetCommentIdent(char ident){ zcommentident = ident; }
+void zSetCommentIdent(char ident){ zTokenizerConfigSetCommentIdent( zTokenizerConfigCurrent(), ident ); }
 
 /* reset the comment identifier. */
 void zResetCommentIdent(void){ zSetCommentIdent( ZDEFAULT_COMMENT_IDENT ); }
 
+/* the current comment identifier. */
+char zCommentIdent(void){ return zTokenizerConfigCurrent()->comment_ident; }
+
 /* skip comments in a file. */
 char zFSkipComment(FILE *fp)
 {
-  char c;
+  char c, ident;
   char dummy[BUFSIZ];
 
+  ident = zCommentIdent();
   while( 1 ){
     if( !zFSkipDelimiter( fp ) ) return (char)0;
-    if( ( c = fgetc( fp ) ) == zcommentident ){
+    if( ( c = fgetc( fp ) ) == ident ){
       if( !fgets( dummy, BUFSIZ, fp ) ) return (char)0;
     } else{
       ungetc( c, fp );
@@ -400,53 +664,69 @@ static char *_zSFencedTokenAndUnfence(char *str, char *tkn, size_t size, const c
 
 /* for ZTK (Z's tag-and-key) format */
 
-static char zeda_tag_begin_ident = ZDEFAULT_TAG_BEGIN_IDENT;
-static char zeda_tag_end_ident   = ZDEFAULT_TAG_END_IDENT;
+/* specify the tag identifiers of a configuration of tokenizers. */
+void zTokenizerConfigSetTagIdent(zTokenizerConfig *config, char begin_ident, char end_ident)
+{
+  config->tag_begin_ident = begin_ident;
+  config->tag_end_ident   = end_ident;
+}
 
 /* specify the tag identifiers. */
 void zSetTagIdent(char begin_ident, char end_ident){
-  zeda_tag_begin_ident = begin_ident;
-  zeda_tag_end_ident   = end_ident;
+  zTokenizerConfigSetTagIdent( zTokenizerConfigCurrent(), begin_ident, end_ident );
 }
 
 /* reset the tag identifiers to default values. */
 void zResetTagIdent(void){ zSetTagIdent( ZDEFAULT_TAG_BEGIN_IDENT, ZDEFAULT_TAG_END_IDENT ); }
 
+/* the current tag identifiers. */
+char zTagBeginIdent(void){ return zTokenizerConfigCurrent()->tag_begin_ident; }
+char zTagEndIdent(void){ return zTokenizerConfigCurrent()->tag_end_ident; }
+
 /* get a tagged token. */
-#define _zFTag(fp,tkn,size) _zFFencedToken( fp, tkn, size, zeda_tag_begin_ident, zeda_tag_end_ident )
-#define _zSTag(fp,tkn,size) _zSFencedToken( fp, tkn, size, zeda_tag_begin_ident, zeda_tag_end_ident )
+#define _zFTag(fp,tkn,size,config) _zFFencedToken( fp, tkn, size, (config)->tag_begin_ident, (config)->tag_end_ident )
+#define _zSTag(fp,tkn,size,config) _zSFencedToken( fp, tkn, size, (config)->tag_begin_ident, (config)->tag_end_ident )
 
 /* check if a string is a tag. */
 bool zStrIsTag(const char *str)
 {
-  return str && ( str[0] == zeda_tag_begin_ident && str[strlen(str)-1] == zeda_tag_end_ident )
+  const zTokenizerConfig *config;
+
+  config = zTokenizerConfigCurrent();
+  return str && ( str[0] == config->tag_begin_ident && str[strlen(str)-1] == config->tag_end_ident )
     ? true : false;
 }
 
 /* extract a tagged part from string. */
 char *zExtractTag(char *tag, char *notag)
 {
-  return _zStrUnfence( tag, notag, zeda_tag_begin_ident, zeda_tag_end_ident );
+  return _zStrUnfence( tag, notag, zTagBeginIdent(), zTagEndIdent() );
 }
 
-static char zeda_key_ident = ZDEFAULT_KEY_IDENT;
+/* specify the key identifier of a configuration of tokenizers. */
+void zTokenizerConfigSetKeyIdent(zTokenizerConfig *config, char ident){ config->key_ident = ident; }
 
 /* specify the key identifier. */
-void zSetKeyIdent(char ident){ zeda_key_ident = ident; }
+void zSetKeyIdent(char ident){ zTokenizerConfigSetKeyIdent( zTokenizerConfigCurrent(), ident ); }
 
 /* reset the key identifier. */
 void zResetKeyIdent(void){ zSetKeyIdent( ZDEFAULT_KEY_IDENT ); }
 
+/* the current key identifier. */
+char zKeyIdent(void){ return zTokenizerConfigCurrent()->key_ident; }
+
 /* check if the last token is a key. */
 bool zFPostCheckKey(FILE *fp)
 {
+  const zTokenizerConfig *config;
   int c;
 
+  config = zTokenizerConfigCurrent();
   do{
     c = fgetc( fp );
     if( feof( fp ) ) break;
-    if( c == zeda_key_ident ) return true;
-    if( !zIsDelimiter( c ) ){
+    if( c == config->key_ident ) return true;
+    if( !zTokenizerIsDelimiter( config, c ) ){
       ungetc( c, fp );
       break;
     }
@@ -457,13 +737,15 @@ bool zFPostCheckKey(FILE *fp)
 /* get a token in a file. */
 char *zFToken(FILE *fp, char *tkn, size_t size)
 {
+  const zTokenizerConfig *config;
   uint i;
 
+  config = zTokenizerConfigCurrent();
   *tkn = '\0'; /* initialize buffer */
   if( !zFSkipComment( fp ) ) return NULL;
   *tkn = fgetc( fp );
   /* check if token is fenced */
-  if( _zFString( fp, tkn, size ) || _zFQuote( fp, tkn, size ) || _zFTag( fp, tkn, size ) )
+  if( _zFString( fp, tkn, size ) || _zFQuote( fp, tkn, size ) || _zFTag( fp, tkn, size, config ) )
     return tkn;
 
   size--; /* token already has one charactor. */
@@ -475,7 +757,7 @@ char *zFToken(FILE *fp, char *tkn, size_t size)
     }
     tkn[i] = fgetc( fp );
     if( feof( fp ) ) break;
-    if( zIsDelimiter( tkn[i] ) ){
+    if( zTokenizerIsDelimiter( config, tkn[i] ) ){
       ungetc( tkn[i], fp );
       break;
     }
@@ -487,9 +769,11 @@ char *zFToken(FILE *fp, char *tkn, size_t size)
 /* skim a token in a string. */
 char *zSTokenSkim(char *str, char *tkn, size_t size)
 {
+  const zTokenizerConfig *config;
   uint i;
   char *sp, *sp_next;
 
+  config = zTokenizerConfigCurrent();
   if( !*( sp = zSSkipDelimiter( str ) ) ){ /* empty string case */
     *tkn = '\0';
     return sp;
@@ -497,9 +781,9 @@ char *zSTokenSkim(char *str, char *tkn, size_t size)
   /* check if token is fenced */
   if( ( sp_next = _zSString( sp, tkn, size ) ) ) return sp_next;
   if( ( sp_next = _zSQuote( sp, tkn, size ) ) ) return sp_next;
-  if( ( sp_next = _zSTag( sp, tkn, size ) ) ) return sp_next;
+  if( ( sp_next = _zSTag( sp, tkn, size, config ) ) ) return sp_next;
 
-  for( i=0; *sp && !zIsDelimiter(*sp); sp++, i++ ){
+  for( i=0; *sp && !zTokenizerIsDelimiter(config,*sp); sp++, i++ ){
     if( i >= size ){
       ZRUNWARN( ZEDA_WARN_TOOLONG_TOKEN );
       i = size - 1;
@@ -689,7 +973,7 @@ bool zFInt(FILE *fp, int *val)
   char buf[BUFSIZ];
 
   if( !zFToken( fp, buf, BUFSIZ ) ) return false;
-  *val = atoi( buf );
+  zNumParseInt( buf, strlen(buf), val );
   return true;
 }
 
@@ -699,7 +983,7 @@ bool zSInt(char *str, int *val)
   char buf[BUFSIZ];
 
   if( !*zSToken( str, buf, BUFSIZ ) ) return false;
-  *val = atoi( buf );
+  zNumParseInt( buf, strlen(buf), val );
   return true;
 }
 
@@ -709,7 +993,7 @@ bool zFDouble(FILE *fp, double *val)
   char buf[BUFSIZ];
 
   if( !zFToken( fp, buf, BUFSIZ ) ) return false;
-  *val = atof( buf );
+  zNumParseDouble( buf, strlen(buf), val );
   return true;
 }
 
@@ -719,7 +1003,7 @@ bool zSDouble(char *str, double *val)
   char buf[BUFSIZ];
 
   if( !*zSToken( str, buf, BUFSIZ ) ) return false;
-  *val = atof( buf );
+  zNumParseDouble( buf, strlen(buf), val );
   return true;
 }
 
@@ -765,69 +1049,137 @@ void zIndent(int n)
 #endif /* __KERNEL__ */
 
 /* generate a table for string search by Knuth-Morris-Pratt algorithm. */
-static int *_zStrSearchKMPTable(char *pat, int lp)
+static void _zStrSearchKMPTable(const char *pat, int lp, int *table)
 {
-  int i=2, j=0;
-  int *table;
+  int i, j;
 
-  if( !( table = zAlloc( int, lp ) ) ){
-    ZALLOCERROR();
-    return NULL;
-  }
   table[0] = -1;
-  if( lp == 1 ) return table;
-  table[1] = 0;
-  if( lp == 2 ) return table;
-  while( i < lp ){
-    if( pat[i-1] == pat[j] )
-      table[++i] = ++j + 1;
+  if( lp > 1 ) table[1] = 0;
+  for( i=1, j=0; i<lp-1; ){
+    if( pat[i] == pat[j] )
+      table[++i] = ++j;
     else
     if( j > 0 )
       j = table[j];
     else
       table[++i] = 0;
   }
-  return table;
 }
 
+/* a table for a short pattern is put on the stack */
+#define ZEDA_STRSEARCH_KMP_TABLE_SIZE 0x100
+
 /* search a string by Knuth-Morris-Pratt algorithm. */
 char *zStrSearchKMP(char *text, char *pat)
 {
-  int m=0, i=0, lt, lp;
-  int *table;
-
-  lt = strlen( text );
-  lp = strlen( pat );
-  if( !( table = _zStrSearchKMPTable( pat, lp ) ) ) return NULL;
-  while( m + i < lt ){
-    if( pat[i] == text[m+i] ){
-      if( ++i == lp ) return text + m;
-    } else{
-      m = m + i - table[i];
-      if( i > 0 ) i = table[i];
-    }
+  int i, j, lp;
+  int table_local[ZEDA_STRSEARCH_KMP_TABLE_SIZE], *table;
+  char *ret = NULL;
+
+  if( ( lp = strlen( pat ) ) == 0 ) return text;
+  if( lp <= ZEDA_STRSEARCH_KMP_TABLE_SIZE )
+    table = table_local;
+  else
+  if( !( table = zAlloc( int, lp ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  _zStrSearchKMPTable( pat, lp, table );
+  for( i=j=0; text[i]; ){
+    if( text[i] == pat[j] ){
+      i++;
+      if( ++j == lp ){
+        ret = text + i - lp;
+        break;
+      }
+    } else
+    if( j > 0 )
+      j = table[j];
+    else
+      i++;
   }
+  if( table != table_local ) free( table );
+  return ret;
+}
+
+/* generate a skip table for string search by Boyer-Moore-Horspool algorithm. */
+static void _zStrSearchBMTable(const char *pat, size_t len, size_t skip[])
+{
+  size_t i;
+
+  for( i=0; i<0x100; i++ ) skip[i] = len;
+  for( i=0; i<len-1; i++ )
+    skip[(ubyte)pat[i]] = len - 1 - i;
+}
+
+/* search a pattern in a memory buffer by Boyer-Moore-Horspool algorithm from a position. */
+static const char *_zStrSearchBM(const char *text, size_t len, const char *pat, size_t lp, const size_t skip[], size_t i)
+{
+  char c;
+
+  for( c=pat[lp-1]; i+lp<=len; i+=skip[(ubyte)text[i+lp-1]] )
+    if( text[i+lp-1] == c && memcmp( text+i, pat, lp-1 ) == 0 ) return text + i;
   return NULL;
 }
 
 /* search a string by Boyer-Moore algorithm. */
 char *zStrSearchBM(char *text, char *pat)
 {
-  int i, j, n, m;
-  ubyte skip[0x80];
-
-  m = strlen( pat ) - 1;
-  memset( skip, m+1, 0x80 );
-  for( i=0; i<m; i++ )
-    skip[ (int)pat[i] ] = m - i;
-  n = strlen( text ) - m;
-  for( i=0; i<n; i+= skip[(int)text[i+m]] )
-    if( text[i+m] == pat[m] ){
-      for( j=m-1; j>=0; j-- )
-        if( text[i+j] != pat[j] ) break;
-      if( j < 0 ) return text + i;
+  size_t lp, skip[0x100];
+
+  if( ( lp = strlen( pat ) ) == 0 ) return text;
+  _zStrSearchBMTable( pat, lp, skip );
+  return (char *)_zStrSearchBM( text, strlen( text ), pat, lp, skip, 0 );
+}
+
+/* compile a pattern for string search. */
+zStrPattern *zStrPatternCompile(zStrPattern *pattern, const char *pat, size_t len)
+{
+  if( !( pattern->pat = zAlloc( char, len + 1 ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  memcpy( pattern->pat, pat, len );
+  pattern->pat[len] = '\0';
+  if( ( pattern->len = len ) > 0 )
+    _zStrSearchBMTable( pattern->pat, len, pattern->_skip );
+  return pattern;
+}
+
+/* destroy a compiled pattern for string search. */
+void zStrPatternDestroy(zStrPattern *pattern)
+{
+  zFree( pattern->pat );
+  pattern->len = 0;
+}
+
+/* search a compiled pattern in a memory buffer. */
+const char *zStrPatternSearch(const zStrPattern *pattern, const char *text, size_t len)
+{
+  size_t i = 0, lp;
+#ifdef ZEDA_MEM_VEC_SIZE
+  _zMemVec first, last;
+  uint mask;
+  size_t j;
+#endif /* ZEDA_MEM_VEC_SIZE */
+
+  if( ( lp = pattern->len ) == 0 ) return text;
+  if( len < lp ) return NULL;
+  if( lp == 1 ) return (const char *)memchr( text, pattern->pat[0], len );
+#ifdef ZEDA_MEM_VEC_SIZE
+  /* candidates are filtered by the first and the last charactors of the pattern */
+  first = _zMemVecSet( pattern->pat[0] );
+  last = _zMemVecSet( pattern->pat[lp-1] );
+  for( ; i+lp-1+ZEDA_MEM_VEC_SIZE<=len; i+=ZEDA_MEM_VEC_SIZE ){
+    mask = _zMemVecMask( _zMemVecAnd( _zMemVecEq( first, _zMemVecLoad( text+i ) ),
+                                      _zMemVecEq( last, _zMemVecLoad( text+i+lp-1 ) ) ) );
+    for( ; mask; mask &= mask - 1 ){
+      j = i + __builtin_ctz( mask );
+      if( memcmp( text+j+1, pattern->pat+1, lp-2 ) == 0 ) return text + j;
     }
-  return NULL;
+  }
+#endif /* ZEDA_MEM_VEC_SIZE */
+  return _zStrSearchBM( text, len, pattern->pat, lp, pattern->_skip, i );
 }
 
 #endif /* __KERNEL__ */
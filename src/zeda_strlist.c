@@ -107,3 +107,211 @@ zStrAddrListCell *zStrAddrListAdd(zStrAddrList *list, char *str)
   zListInsertHead( list, cell );
   return cell;
 }
+
+/* ********************************************************** */
+/* automaton to search multiple patterns at once.
+ *//* ******************************************************* */
+
+/* classify bytes that appear in patterns, and count bytes of all patterns. */
+static size_t _zStrMultiSearchClassify(zStrMultiSearch *ms, zStrList *list)
+{
+  zStrListCell *cp;
+  const char *sp;
+  size_t total = 0;
+  int c;
+
+  for( c=0; c<0x100; c++ ) ms->_class[c] = 0;
+  zListForEach( list, cp )
+    for( sp=cp->data; *sp; sp++, total++ )
+      ms->_class[(ubyte)*sp] = 1;
+  for( ms->_classnum=1, c=0; c<0x100; c++ ) /* class 0 is for bytes in no pattern */
+    if( ms->_class[c] ) ms->_class[c] = ms->_classnum++;
+  return total;
+}
+
+/* add a pattern to the trie of an automaton. */
+static void _zStrMultiSearchAddPattern(zStrMultiSearch *ms, int id, const char *pat)
+{
+  int s, *t, *id_p;
+
+  /* no transition goes back to the root in the trie, so 0 means no transition */
+  for( s=0; *pat; pat++, s=*t )
+    if( *( t = &ms->_delta[s*ms->_classnum+ms->_class[(ubyte)*pat]] ) == 0 )
+      *t = ms->_statenum++;
+  if( s == 0 ) return; /* an empty pattern */
+  for( id_p=&ms->_match[s]; *id_p>=0; id_p=&ms->_next[*id_p] ); /* identical patterns */
+  *id_p = id;
+}
+
+/* complete transitions of an automaton along the failure links in breadth-first order. */
+static bool _zStrMultiSearchLink(zStrMultiSearch *ms)
+{
+  int *queue, *fail, head, tail, s, c, *t, *t_fail;
+
+  queue = zAlloc( int, ms->_statenum );
+  fail = zAlloc( int, ms->_statenum );
+  if( !queue || !fail ){
+    ZALLOCERROR();
+    free( queue );
+    free( fail );
+    return false;
+  }
+  ms->_out[0] = ms->_link[0] = -1;
+  for( tail=0, c=0; c<ms->_classnum; c++ )
+    if( ( s = ms->_delta[c] ) != 0 ){
+      fail[s] = 0;
+      queue[tail++] = s;
+    }
+  for( head=0; head<tail; head++ ){
+    s = queue[head];
+    ms->_link[s] = ms->_out[fail[s]];
+    ms->_out[s] = ms->_match[s] >= 0 ? s : ms->_link[s];
+    t = &ms->_delta[s*ms->_classnum];
+    t_fail = &ms->_delta[fail[s]*ms->_classnum];
+    for( c=0; c<ms->_classnum; c++ )
+      if( t[c] != 0 ){
+        fail[t[c]] = t_fail[c];
+        queue[tail++] = t[c];
+      } else
+        t[c] = t_fail[c];
+  }
+  free( queue );
+  free( fail );
+  return true;
+}
+
+/* compile an automaton to search multiple patterns. */
+zStrMultiSearch *zStrMultiSearchCompile(zStrMultiSearch *ms, zStrList *list)
+{
+  zStrListCell *cp;
+  size_t total;
+  int i;
+
+  ms->num = zListSize( list );
+  total = _zStrMultiSearchClassify( ms, list ) + 1;
+  ms->_statenum = 1;
+  ms->_len = zAlloc( size_t, ms->num );
+  ms->_next = zAlloc( int, ms->num );
+  ms->_delta = zAlloc( int, total * ms->_classnum );
+  ms->_match = zAlloc( int, total );
+  ms->_out = zAlloc( int, total );
+  ms->_link = zAlloc( int, total );
+  if( ( ms->num > 0 && ( !ms->_len || !ms->_next ) ) ||
+      !ms->_delta || !ms->_match || !ms->_out || !ms->_link ){
+    ZALLOCERROR();
+    zStrMultiSearchDestroy( ms );
+    return NULL;
+  }
+  for( i=0; i<(int)total; i++ ) ms->_match[i] = -1;
+  i = 0;
+  zListForEach( list, cp ){
+    ms->_len[i] = strlen( cp->data );
+    ms->_next[i] = -1;
+    _zStrMultiSearchAddPattern( ms, i++, cp->data );
+  }
+  if( !_zStrMultiSearchLink( ms ) ){
+    zStrMultiSearchDestroy( ms );
+    return NULL;
+  }
+  return ms;
+}
+
+/* destroy an automaton to search multiple patterns. */
+void zStrMultiSearchDestroy(zStrMultiSearch *ms)
+{
+  zFree( ms->_len );
+  zFree( ms->_next );
+  zFree( ms->_delta );
+  zFree( ms->_match );
+  zFree( ms->_out );
+  zFree( ms->_link );
+  ms->num = ms->_statenum = 0;
+}
+
+/* state of a search over successive chunks of texts. */
+typedef struct{
+  int state;     /* current state of the automaton */
+  size_t offset; /* offset of the chunk from the head of texts */
+  int count;     /* number of occurrences */
+  bool stop;     /* flag to stop the search */
+  bool (* match)(void*,int,size_t);
+  void *arg;
+} _zStrMultiSearchRun;
+
+/* search multiple patterns in a chunk of texts, and return the number of bytes searched. */
+static size_t _zStrMultiSearchFeed(const zStrMultiSearch *ms, _zStrMultiSearchRun *run, const char *text, size_t len)
+{
+  size_t i;
+  int s, t, id;
+
+  for( s=run->state, i=0; i<len; i++ ){
+    s = ms->_delta[s*ms->_classnum+ms->_class[(ubyte)text[i]]];
+    for( t=ms->_out[s]; t>=0; t=ms->_link[t] )
+      for( id=ms->_match[t]; id>=0; id=ms->_next[id] ){
+        run->count++;
+        if( run->match && !run->match( run->arg, id, run->offset + i + 1 - ms->_len[id] ) ){
+          run->stop = true;
+          len = i + 1;
+          goto TERMINATE;
+        }
+      }
+  }
+ TERMINATE:
+  run->state = s;
+  run->offset += len;
+  return len;
+}
+
+/* initialize a search over successive chunks of texts. */
+static _zStrMultiSearchRun *_zStrMultiSearchRunInit(_zStrMultiSearchRun *run, bool (* match)(void*,int,size_t), void *arg)
+{
+  run->state = 0;
+  run->offset = 0;
+  run->count = 0;
+  run->stop = false;
+  run->match = match;
+  run->arg = arg;
+  return run;
+}
+
+/* search multiple patterns in a memory buffer. */
+int zStrMultiSearchMem(const zStrMultiSearch *ms, const char *text, size_t len, bool (* match)(void*,int,size_t), void *arg)
+{
+  _zStrMultiSearchRun run;
+
+  _zStrMultiSearchFeed( ms, _zStrMultiSearchRunInit( &run, match, arg ), text, len );
+  return run.count;
+}
+
+/* size of chunks of a file stream to search multiple patterns */
+#define ZEDA_STRMULTISEARCH_BUFSIZ 0x10000
+
+/* search multiple patterns in a file stream. */
+int zStrMultiSearchFP(const zStrMultiSearch *ms, FILE *fp, bool (* match)(void*,int,size_t), void *arg)
+{
+  _zStrMultiSearchRun run;
+  char *buf;
+  size_t len;
+
+  _zStrMultiSearchRunInit( &run, match, arg );
+  if( !( buf = zAlloc( char, ZEDA_STRMULTISEARCH_BUFSIZ ) ) ){
+    ZALLOCERROR();
+    return 0;
+  }
+  while( !run.stop && ( len = fread( buf, sizeof(char), ZEDA_STRMULTISEARCH_BUFSIZ, fp ) ) > 0 )
+    _zStrMultiSearchFeed( ms, &run, buf, len );
+  free( buf );
+  return run.count;
+}
+
+/* search multiple patterns in texts of a scanner. */
+int zStrMultiSearchScanner(const zStrMultiSearch *ms, zScanner *scanner, bool (* match)(void*,int,size_t), void *arg)
+{
+  _zStrMultiSearchRun run;
+
+  _zStrMultiSearchRunInit( &run, match, arg );
+  zScannerClearToken( scanner );
+  while( !run.stop && ( scanner->cur < scanner->end || zScannerFill( scanner, 1 ) ) )
+    scanner->cur += _zStrMultiSearchFeed( ms, &run, scanner->cur, scanner->end - scanner->cur );
+  return run.count;
+}
@@ -4,7 +4,31 @@
  * zeda_ztk - ZTK (Z's tag-and-key) file format.
  */
 
+#if !defined( _WIN32 ) && !defined( _POSIX_C_SOURCE )
+#define _POSIX_C_SOURCE 200809L /* for open_memstream() */
+#endif
+
 #include <zeda/zeda_ztk.h>
+#include <stddef.h>
+#include <ctype.h>
+#ifdef __ZEDA_USE_PTHREAD
+#include <pthread.h>
+#endif /* __ZEDA_USE_PTHREAD */
+
+#ifdef __WINDOWS__
+#include <process.h>
+#define _ZTKWriteFD(fd,buf,size) _write( fd, buf, (unsigned int)(size) )
+#define _ZTKPid()                (ulong)_getpid()
+#else
+#include <unistd.h>
+#define _ZTKWriteFD(fd,buf,size) write( fd, buf, size )
+#define _ZTKPid()                (ulong)getpid()
+#endif /* __WINDOWS__ */
+
+/* formatted contents of ZTKWriter are kept in a memory stream if available, or a temporary file otherwise. */
+#if !defined( __WINDOWS__ ) && defined( _POSIX_C_SOURCE ) && _POSIX_C_SOURCE >= 200809L
+#define __ZTK_WRITER_MEMSTREAM
+#endif
 
 /* ********************************************************** */
 /* file stack.
@@ -30,11 +54,13 @@ zFileStack *zFileStackPush(zFileStack *head, const char *pathname)
   for( cp=head->prev; cp; cp=cp->prev ){
     if( zFileIsIdent( cp->fp, fp ) ){
       ZRUNWARN( ZEDA_WARN_ZTK_INCLUDE_DUP, pathname );
+      fclose( fp );
       return NULL;
     }
   }
   if( !( cp = zAlloc( zFileStack, 1 ) ) ){
     ZALLOCERROR();
+    fclose( fp );
     return NULL;
   }
   if( !( cp->pathname = zStrClone( pathname ) ) ){
@@ -67,23 +93,273 @@ void zFileStackDestroy(zFileStack *head)
   while( zFileStackPop( head ) );
 }
 
+/* ********************************************************** */
+/* memory allocation for a tag-and-key list.
+ *//* ******************************************************* */
+
+/* allocate memory for a tag-and-key list from a memory arena (if given) or the heap. */
+#define _ZTKAlloc(arena,type) ( (arena) ? zArenaAllocType( arena, type, 1 ) : zAlloc( type, 1 ) )
+
+/* clone a string for a tag-and-key list into a memory arena (if given) or the heap. */
+#define _ZTKStrCloneN(arena,str,len) ( (arena) ? zArenaStrCloneN( arena, str, len ) : zStrCloneN( str, len ) )
+
+/* enlarge an array for a tag-and-key list (the old array is left in a memory arena). */
+static void *_ZTKRealloc(zArena *arena, void *ptr, size_t size, size_t newsize)
+{
+  void *newptr;
+
+  if( !arena ) return realloc( ptr, newsize );
+  if( ( newptr = zArenaAlloc( arena, newsize ) ) && size > 0 )
+    memcpy( newptr, ptr, size );
+  return newptr;
+}
+
+/* ********************************************************** */
+/* hash index of fields of ZTK format.
+ *//* ******************************************************* */
+
+#define ZTK_INDEX_INIT_CAPACITY 8
+
+/* find a slot of a hash table for a string. */
+static ZTKIndexEntry *_ZTKIndexSlot(ZTKIndexEntry *entry, uint capacity, const char *str, ulong hash)
+{
+  uint i;
+
+  for( i=hash&(capacity-1); entry[i].str; i=(i+1)&(capacity-1) )
+    if( entry[i].str == str || ( entry[i].hash == hash && strcmp( entry[i].str, str ) == 0 ) ) break;
+  return &entry[i];
+}
+
+/* find a slot of a hash table for a string with a length. */
+static ZTKIndexEntry *_ZTKIndexSlotN(ZTKIndexEntry *entry, uint capacity, const char *str, size_t len, ulong hash)
+{
+  uint i;
+
+  for( i=hash&(capacity-1); entry[i].str; i=(i+1)&(capacity-1) )
+    if( entry[i].hash == hash && strncmp( entry[i].str, str, len ) == 0 && entry[i].str[len] == '\0' ) break;
+  return &entry[i];
+}
+
+/* find an entry of a hash index associated with a string with a hash value. */
+static ZTKIndexEntry *_ZTKIndexFind(const ZTKIndex *index, const char *str, ulong hash)
+{
+  ZTKIndexEntry *entry;
+
+  if( index->capacity == 0 ) return NULL;
+  entry = _ZTKIndexSlot( index->entry, index->capacity, str, hash );
+  return entry->str ? entry : NULL;
+}
+
+/* enlarge a hash table of a hash index. */
+static bool _ZTKIndexEnlarge(zArena *arena, ZTKIndex *index)
+{
+  ZTKIndexEntry *entry;
+  uint i, capacity;
+
+  capacity = index->capacity == 0 ? ZTK_INDEX_INIT_CAPACITY : index->capacity * 2;
+  if( !( entry = arena ? zArenaAllocType( arena, ZTKIndexEntry, capacity ) : zAlloc( ZTKIndexEntry, capacity ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  for( i=0; i<index->capacity; i++ )
+    if( index->entry[i].str )
+      *_ZTKIndexSlot( entry, capacity, index->entry[i].str, index->entry[i].hash ) = index->entry[i];
+  if( !arena ) zFree( index->entry );
+  index->entry = entry;
+  index->capacity = capacity;
+  return true;
+}
+
+/* find an entry of a hash index associated with a string with a hash value, and add a new one if not found. */
+static ZTKIndexEntry *_ZTKIndexEntry(zArena *arena, ZTKIndex *index, const char *str, ulong hash)
+{
+  ZTKIndexEntry *entry;
+
+  if( ( index->size + 1 ) * 2 > index->capacity && !_ZTKIndexEnlarge( arena, index ) )
+    return NULL;
+  if( !( entry = _ZTKIndexSlot( index->entry, index->capacity, str, hash ) )->str ){
+    entry->str = str;
+    entry->hash = hash;
+    index->size++;
+  }
+  return entry;
+}
+
+/* clear entries of a hash index. */
+static void _ZTKIndexClear(ZTKIndex *index)
+{
+  if( index->entry ) memset( index->entry, 0, sizeof(ZTKIndexEntry)*index->capacity );
+  index->size = 0;
+}
+
+/* destroy a hash index. */
+static void _ZTKIndexDestroy(ZTKIndex *index)
+{
+  zFree( index->entry );
+  index->size = index->capacity = 0;
+}
+
+/* ********************************************************** */
+/* pool of interned tags and keys of ZTK format.
+ *//* ******************************************************* */
+
+/* intern a string with a length into a pool, and return the entry of the interned string. */
+static ZTKIndexEntry *_ZTKStrPoolInternN(zArena *arena, ZTKIndex *pool, const char *str, size_t len)
+{
+  ZTKIndexEntry *entry;
+  ulong hash;
+
+  if( !str ) return NULL;
+  if( ( pool->size + 1 ) * 2 > pool->capacity && !_ZTKIndexEnlarge( arena, pool ) )
+    return NULL;
+  hash = zStrHashN( str, len );
+  if( !( entry = _ZTKIndexSlotN( pool->entry, pool->capacity, str, len, hash ) )->str ){
+    if( !( entry->str = _ZTKStrCloneN( arena, str, len ) ) ){
+      ZALLOCERROR();
+      return NULL;
+    }
+    entry->hash = hash;
+    pool->size++;
+  }
+  return entry;
+}
+
+/* destroy a pool of interned strings. */
+static void _ZTKStrPoolDestroy(ZTKIndex *pool)
+{
+  uint i;
+
+  for( i=0; i<pool->capacity; i++ )
+    if( pool->entry[i].str ) free( (char *)pool->entry[i].str );
+  _ZTKIndexDestroy( pool );
+}
+
+/* a list cell that contains a field. */
+#define _ZTKFieldCell(field,cell_t) ( (cell_t *)( (char *)(field) - offsetof( cell_t, data ) ) )
+
 /* ********************************************************** */
 /* key field of ZTK format.
  *//* ******************************************************* */
 
-/* add a value to a key field of ZTK format. */
-#define ZTKKeyFieldAddVal(kf,val) zStrListAdd( &(kf)->vallist, val )
+#define ZTK_VALLIST_INIT_CAPACITY 4
+#define ZTK_VALLIST_INIT_BUFSIZE  32
+
+/* add a value to a list of value strings of ZTK format. */
+static const char *_ZTKValListAdd(zArena *arena, ZTKValList *list, const char *val, size_t len)
+{
+  void *ptr;
+  size_t bufsize;
+  int capacity;
+
+  if( list->size == list->capacity ){
+    capacity = list->capacity == 0 ? ZTK_VALLIST_INIT_CAPACITY : list->capacity * 2;
+    if( !( ptr = _ZTKRealloc( arena, list->offset, sizeof(uint)*list->size, sizeof(uint)*capacity ) ) ){
+      ZALLOCERROR();
+      return NULL;
+    }
+    list->offset = (uint *)ptr;
+    list->capacity = capacity;
+  }
+  if( list->len + len + 1 > list->bufsize ){
+    for( bufsize=list->bufsize==0?ZTK_VALLIST_INIT_BUFSIZE:list->bufsize*2; list->len + len + 1 > bufsize; bufsize*=2 );
+    if( !( ptr = _ZTKRealloc( arena, list->buf, list->len, bufsize ) ) ){
+      ZALLOCERROR();
+      return NULL;
+    }
+    list->buf = (char *)ptr;
+    list->bufsize = bufsize;
+  }
+  if( len > 0 ) memcpy( list->buf + list->len, val, len );
+  list->buf[list->len+len] = '\0';
+  list->offset[list->size++] = (uint)list->len;
+  list->len += len + 1;
+  return ZTKValListStr( list, list->size - 1 );
+}
+
+/* destroy a list of value strings of ZTK format allocated in the heap. */
+static void _ZTKValListDestroy(ZTKValList *list)
+{
+  free( list->offset );
+  free( list->buf );
+  list->offset = NULL;
+  list->buf = NULL;
+  list->size = list->capacity = 0;
+  list->len = list->bufsize = 0;
+}
+
+/* convert a value string to a number if the whole string represents a number. */
+static bool _ZTKValToNum(const char *str, double *val, bool *isint)
+{
+  const char *cp;
+  size_t len;
+
+  if( !( len = strlen( str ) ) ) return false;
+  if( zNumParseDouble( str, len, val ) != len ) return false;
+  cp = ( *str == '+' || *str == '-' ) ? str + 1 : str;
+  for( ; isdigit( *cp ); cp++ );
+  *isint = !*cp && *val >= -(double)INT_MAX-1 && *val <= (double)INT_MAX;
+  return true;
+}
+
+/* destroy a block of numeric values of a key field of ZTK format. */
+static void _ZTKKeyFieldNumBlockDestroy(zArena *arena, ZTKKeyField *kf)
+{
+  if( !arena && kf->numblock ){ /* released when the memory arena is destroyed */
+    free( kf->numblock->val );
+    free( kf->numblock );
+  }
+  kf->numblock = NULL;
+}
+
+#define ZTK_NUMBLOCK_INIT_CAPACITY 4
+
+/* add a numeric value to the block of a key field of ZTK format. */
+static bool _ZTKKeyFieldAddNum(zArena *arena, ZTKKeyField *kf, const char *str)
+{
+  ZTKNumBlock *block;
+  double val, *array;
+  bool isint;
+  int capacity;
+
+  if( !( block = kf->numblock ) ){
+    /* a block is created only at the first value; a non-numeric value already exists otherwise. */
+    if( ZTKValListSize(&kf->vallist) != 1 || !_ZTKValToNum( str, &val, &isint ) ) return true;
+    if( !( block = kf->numblock = _ZTKAlloc( arena, ZTKNumBlock ) ) ){
+      ZALLOCERROR();
+      return false;
+    }
+    block->size = block->capacity = 0;
+    block->isint = true;
+    block->val = NULL;
+  } else
+  if( !_ZTKValToNum( str, &val, &isint ) ){
+    _ZTKKeyFieldNumBlockDestroy( arena, kf );
+    return true;
+  }
+  if( block->size == block->capacity ){
+    capacity = block->capacity == 0 ? ZTK_NUMBLOCK_INIT_CAPACITY : block->capacity * 2;
+    if( !( array = (double *)_ZTKRealloc( arena, block->val, sizeof(double)*block->size, sizeof(double)*capacity ) ) ){
+      ZALLOCERROR();
+      _ZTKKeyFieldNumBlockDestroy( arena, kf );
+      return false;
+    }
+    block->val = array;
+    block->capacity = capacity;
+  }
+  block->val[block->size++] = val;
+  if( !isint ) block->isint = false;
+  return true;
+}
 
 /* print out a key field of ZTK format. */
 void ZTKKeyFieldFPrint(FILE *fp, ZTKKeyField *kf)
 {
-  zStrListCell *cp;
+  int i;
 
   if( kf->key && kf->key[0] ) fprintf( fp, "%s: ", kf->key );
-  zListForEach( &kf->vallist, cp ){
-    fprintf( fp, "%s", cp->data );
-    if( zListCellNext(cp) != zListRoot(&kf->vallist) )
-      fprintf( fp, " " );
+  for( i=0; i<ZTKValListSize(&kf->vallist); i++ ){
+    if( i > 0 ) fprintf( fp, " " );
+    fprintf( fp, "%s", ZTKValListStr(&kf->vallist,i) );
   }
   fprintf( fp, "\n" );
 }
@@ -92,41 +368,61 @@ void ZTKKeyFieldFPrint(FILE *fp, ZTKKeyField *kf)
 /* a list of key fields of ZTK format.
  *//* ******************************************************* */
 
-/* insert a new key field of ZTK format to a list. */
-ZTKKeyFieldListCell *ZTKKeyFieldListNew(ZTKKeyFieldList *list, const char *key)
+/* insert a new key field of ZTK format with an allocated key to a list. */
+static ZTKKeyFieldListCell *_ZTKKeyFieldListNew(zArena *arena, ZTKKeyFieldList *list, char *key)
 {
   ZTKKeyFieldListCell *cp;
 
-  if( !( cp = zAlloc( ZTKKeyFieldListCell, 1 ) ) ){
-    ZALLOCERROR();
-    return NULL;
-  }
-  if( !( cp->data.key = zStrClone( key ) ) ){
+  if( !( cp = _ZTKAlloc( arena, ZTKKeyFieldListCell ) ) ){
     ZALLOCERROR();
-    free( cp );
     return NULL;
   }
-  zListInit( &cp->data.vallist );
+  cp->data.key = key;
+  cp->data.numblock = NULL; /* vallist is cleared at allocation */
   zListInsertHead( list, cp );
   return cp;
 }
 
-/* destroy the head of a list of key fields of ZTK format. */
-void ZTKKeyFieldListHeadDestroy(ZTKKeyFieldList *list)
+/* insert a new key field of ZTK format to a list. */
+ZTKKeyFieldListCell *ZTKKeyFieldListNew(ZTKKeyFieldList *list, const char *key)
+{
+  ZTKKeyFieldListCell *cp;
+  char *str;
+
+  if( !( str = zStrCloneN( key, key ? strlen( key ) : 0 ) ) ) return NULL;
+  if( !( cp = _ZTKKeyFieldListNew( NULL, list, str ) ) ) free( str );
+  return cp;
+}
+
+/* destroy the head of a list of key fields of ZTK format (keys interned in a pool are not freed). */
+static void _ZTKKeyFieldListHeadDestroy(ZTKKeyFieldList *list, bool interned)
 {
   ZTKKeyFieldListCell *cp;
 
   zListDeleteHead( list, &cp );
-  free( cp->data.key );
-  zStrListDestroy( &cp->data.vallist );
+  if( !interned ) free( cp->data.key );
+  _ZTKValListDestroy( &cp->data.vallist );
+  _ZTKKeyFieldNumBlockDestroy( NULL, &cp->data );
   free( cp );
 }
 
+/* destroy the head of a list of key fields of ZTK format. */
+void ZTKKeyFieldListHeadDestroy(ZTKKeyFieldList *list)
+{
+  _ZTKKeyFieldListHeadDestroy( list, false );
+}
+
+/* destroy a list of key fields of ZTK format (keys interned in a pool are not freed). */
+static void _ZTKKeyFieldListDestroy(ZTKKeyFieldList *list, bool interned)
+{
+  while( !zListIsEmpty( list ) )
+    _ZTKKeyFieldListHeadDestroy( list, interned );
+}
+
 /* destroy a list of key fields of ZTK format. */
 void ZTKKeyFieldListDestroy(ZTKKeyFieldList *list)
 {
-  while( !zListIsEmpty( list ) )
-    ZTKKeyFieldListHeadDestroy( list );
+  _ZTKKeyFieldListDestroy( list, false );
 }
 
 /* ********************************************************** */
@@ -147,37 +443,58 @@ void ZTKTagFieldFPrint(FILE *fp, ZTKTagField *tf)
 /* a list of tagged fields of ZTK format.
  *//* ******************************************************* */
 
-/* insert a new tagged field of ZTK format to a list. */
-ZTKTagFieldListCell *ZTKTagFieldListNew(const char *buf)
+/* create a new tagged field of ZTK format. */
+static ZTKTagFieldListCell *_ZTKTagFieldListNew(zArena *arena, char *tag)
 {
   ZTKTagFieldListCell *cp;
 
-  if( !( cp = zAlloc( ZTKTagFieldListCell, 1 ) ) ){
-    ZALLOCERROR();
-    return NULL;
-  }
-  if( !( cp->data.tag = zStrClone( buf ) ) ){
+  if( !( cp = _ZTKAlloc( arena, ZTKTagFieldListCell ) ) ){
     ZALLOCERROR();
-    free( cp );
     return NULL;
   }
+  cp->data.tag = tag;
   zListInit( &cp->data.kflist );
+  cp->data.src = NULL;
   return cp;
 }
 
-/* destroy a list of tagged fields of ZTK format. */
-void ZTKTagFieldListDestroy(ZTKTagFieldList *list)
+/* insert a new tagged field of ZTK format to a list. */
+ZTKTagFieldListCell *ZTKTagFieldListNew(const char *buf)
+{
+  ZTKTagFieldListCell *cp;
+  char *tag;
+
+  if( !( tag = zStrCloneN( buf, buf ? strlen( buf ) : 0 ) ) ) return NULL;
+  if( !( cp = _ZTKTagFieldListNew( NULL, tag ) ) ) free( tag );
+  return cp;
+}
+
+/* destroy a tagged field of ZTK format (tags and keys interned in a pool are not freed). */
+static void _ZTKTagFieldListCellDestroy(ZTKTagFieldListCell *cp, bool interned)
+{
+  if( !interned ) free( cp->data.tag );
+  _ZTKKeyFieldListDestroy( &cp->data.kflist, interned );
+  _ZTKIndexDestroy( &cp->data.keyindex );
+  free( cp );
+}
+
+/* destroy a list of tagged fields of ZTK format (tags and keys interned in a pool are not freed). */
+static void _ZTKTagFieldListDestroy(ZTKTagFieldList *list, bool interned)
 {
   ZTKTagFieldListCell *cp;
 
   while( !zListIsEmpty( list ) ){
     zListDeleteHead( list, &cp );
-    free( cp->data.tag );
-    ZTKKeyFieldListDestroy( &cp->data.kflist );
-    free( cp );
+    _ZTKTagFieldListCellDestroy( cp, interned );
   }
 }
 
+/* destroy a list of tagged fields of ZTK format. */
+void ZTKTagFieldListDestroy(ZTKTagFieldList *list)
+{
+  _ZTKTagFieldListDestroy( list, false );
+}
+
 /* print out a list of tagged fields of ZTK format (for debug). */
 void ZTKTagFieldListFPrint(FILE *fp, ZTKTagFieldList *list)
 {
@@ -187,6 +504,267 @@ void ZTKTagFieldListFPrint(FILE *fp, ZTKTagFieldList *list)
     ZTKTagFieldFPrint( fp, &cp->data );
 }
 
+/* ********************************************************** */
+/* a list of source files of ZTK format.
+ *//* ******************************************************* */
+
+/* resolve a path of a source file of ZTK format to the absolute path against the working directory, as fopen() does. */
+static char *_ZTKSrcAbsPath(const char *path, char *abspath, size_t size)
+{
+#ifdef __WINDOWS__
+  return _fullpath( abspath, path, size ) ? abspath : zStrCopy( abspath, path, size );
+#else
+  if( path[0] == '/' || !getcwd( abspath, size ) ) return zStrCopy( abspath, path, size );
+  zStrCat( abspath, "/", size );
+  zStrCat( abspath, path, size );
+  return abspath;
+#endif /* __WINDOWS__ */
+}
+
+/* add a source file of ZTK format to a list.
+ * the path is recorded as the absolute path, so that it is valid after the working directory changes. */
+static ZTKSrcListCell *_ZTKSrcListAdd(ZTKSrcList *list, const char *path, zFileStamp *stamp)
+{
+  ZTKSrcListCell *cp;
+  char abspath[BUFSIZ];
+
+  if( !( cp = zAlloc( ZTKSrcListCell, 1 ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  if( !( cp->data.path = zStrClone( _ZTKSrcAbsPath( path, abspath, BUFSIZ ) ) ) ){
+    ZALLOCERROR();
+    free( cp );
+    return NULL;
+  }
+  zCopy( zFileStamp, stamp, &cp->data.stamp );
+  cp->data.parent = NULL;
+  cp->data.head = NULL;
+  cp->data.num = 0;
+  cp->data.shared = false;
+  cp->data.doc = NULL;
+  zListInsertHead( list, cp );
+  return cp;
+}
+
+/* an absent source file, namely, an included file that was not found, is stamped with zeros. */
+static bool _ZTKSrcStampIsAbsent(zFileStamp *stamp)
+{
+  return stamp->dev == 0 && stamp->ino == 0 && stamp->mtime == 0 && stamp->mtime_nsec == 0 && stamp->size == 0;
+}
+
+/* check if a source file of ZTK format is modified after stamped, or created if it was absent. */
+static bool _ZTKSrcIsModified(const char *path, zFileStamp *stamp)
+{
+  zFileStamp stamp_now;
+  char fullpath[BUFSIZ];
+
+  if( _ZTKSrcStampIsAbsent( stamp ) ) /* in the same way with zOpenZTKFile() */
+    return zFileStampGetPath( path, &stamp_now ) ||
+           zFileStampGetPath( zAddSuffix( path, ZEDA_ZTK_SUFFIX, fullpath, BUFSIZ ), &stamp_now );
+  return !zFileStampGetPath( path, &stamp_now ) || !zFileStampIsEqual( stamp, &stamp_now );
+}
+
+/* check if a source file of ZTK format is an ancestor of (or the same with) another in a chain of inclusion. */
+static bool _ZTKSrcIsAncestor(ZTKSrc *src, ZTKSrc *desc)
+{
+  for( ; desc; desc=desc->parent )
+    if( desc == src ) return true;
+  return false;
+}
+
+/* mark source files that share a tagged field up to the common ancestor. */
+static void _ZTKSrcShare(ZTKSrc *src, ZTKSrc *other)
+{
+  ZTKSrc *sp;
+
+  for( sp=src; sp && !_ZTKSrcIsAncestor( sp, other ); sp=sp->parent )
+    sp->shared = true;
+  for( sp=other; sp && !_ZTKSrcIsAncestor( sp, src ); sp=sp->parent )
+    sp->shared = true;
+}
+
+/* release a document shared via the cache of included files (see below). */
+static void _ZTKDocRelease(void *doc);
+
+/* destroy a list of source files of ZTK format. */
+void ZTKSrcListDestroy(ZTKSrcList *list)
+{
+  ZTKSrcListCell *cp;
+
+  while( !zListIsEmpty( list ) ){
+    zListDeleteHead( list, &cp );
+    if( cp->data.doc ) _ZTKDocRelease( cp->data.doc );
+    free( cp->data.path );
+    free( cp );
+  }
+}
+
+/* ********************************************************** */
+/* timings of ZTK format processor (only with __ZEDA_USE_ZTK_STATS).
+ *//* ******************************************************* */
+
+#ifdef __ZEDA_USE_ZTK_STATS
+#include <time.h>
+
+/* accumulated timings of a ZTK format processor */
+typedef struct{
+  double t_parse;
+  double t_alloc;
+  double t_parse_begin; /* time when the outermost parser began */
+  double t_alloc_begin; /* time when the current allocation began */
+  int depth;            /* depth of nested calls of parsers */
+  int prpnum;
+  int prpcapacity;
+  ZTKPrpStats *prp;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_t mutex; /* for parallel evaluations */
+#endif /* __ZEDA_USE_PTHREAD */
+} _ZTKStatsTimer;
+
+#ifdef __ZEDA_USE_PTHREAD
+#define _ZTKStatsTimerLock(timer)   pthread_mutex_lock( &(timer)->mutex )
+#define _ZTKStatsTimerUnlock(timer) pthread_mutex_unlock( &(timer)->mutex )
+#else
+#define _ZTKStatsTimerLock(timer)
+#define _ZTKStatsTimerUnlock(timer)
+#endif /* __ZEDA_USE_PTHREAD */
+
+/* current time in seconds. */
+static double _ZTKStatsClock(void)
+{
+#ifdef CLOCK_MONOTONIC
+  struct timespec ts;
+
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec * 1.0e-9;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif /* CLOCK_MONOTONIC */
+}
+
+/* timings of a ZTK format processor, which are allocated on demand. */
+static _ZTKStatsTimer *_ZTKStatsTimerGet(ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+
+  if( !ztk->stats ){
+    if( !( timer = zAlloc( _ZTKStatsTimer, 1 ) ) ){
+      ZALLOCERROR();
+      return NULL;
+    }
+#ifdef __ZEDA_USE_PTHREAD
+    pthread_mutex_init( &timer->mutex, NULL );
+#endif /* __ZEDA_USE_PTHREAD */
+    ztk->stats = timer;
+  }
+  return (_ZTKStatsTimer *)ztk->stats;
+}
+
+/* destroy timings of a ZTK format processor. */
+static void _ZTKStatsTimerDestroy(ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+  int i;
+
+  if( !( timer = (_ZTKStatsTimer *)ztk->stats ) ) return;
+  for( i=0; i<timer->prpnum; i++ ) free( timer->prp[i].str );
+  free( timer->prp );
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_destroy( &timer->mutex );
+#endif /* __ZEDA_USE_PTHREAD */
+  free( timer );
+  ztk->stats = NULL;
+}
+
+/* begin to measure time of a parser, which is only counted for the outermost one. */
+static void _ZTKStatsParseBegin(ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+
+  if( ( timer = _ZTKStatsTimerGet( ztk ) ) && timer->depth++ == 0 )
+    timer->t_parse_begin = _ZTKStatsClock();
+}
+
+/* finish measuring time of a parser. */
+static void _ZTKStatsParseEnd(ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+
+  if( ( timer = (_ZTKStatsTimer *)ztk->stats ) && timer->depth > 0 && --timer->depth == 0 )
+    timer->t_parse += _ZTKStatsClock() - timer->t_parse_begin;
+}
+
+/* begin to measure time of an allocation of a tag, a key or a value in a parser. */
+static void _ZTKStatsAllocBegin(ZTK *ztk)
+{
+  if( ztk->stats )
+    ( (_ZTKStatsTimer *)ztk->stats )->t_alloc_begin = _ZTKStatsClock();
+}
+
+/* finish measuring time of an allocation. */
+static void _ZTKStatsAllocEnd(ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+
+  if( ( timer = (_ZTKStatsTimer *)ztk->stats ) )
+    timer->t_alloc += _ZTKStatsClock() - timer->t_alloc_begin;
+}
+
+/* record time of an evaluation of a property. */
+static void _ZTKStatsRecordEval(_ZTKStatsTimer *timer, const char *str, double t)
+{
+  ZTKPrpStats *prp;
+  int i;
+
+  _ZTKStatsTimerLock( timer );
+  for( i=0; i<timer->prpnum; i++ )
+    if( strcmp( timer->prp[i].str, str ) == 0 ) break;
+  if( i == timer->prpnum ){
+    if( timer->prpnum == timer->prpcapacity ){
+      if( !( prp = zRealloc( timer->prp, ZTKPrpStats, timer->prpcapacity == 0 ? 8 : timer->prpcapacity * 2 ) ) ){
+        ZALLOCERROR();
+        goto TERMINATE;
+      }
+      timer->prp = prp;
+      timer->prpcapacity = timer->prpcapacity == 0 ? 8 : timer->prpcapacity * 2;
+    }
+    if( !( timer->prp[i].str = zStrClone( str ) ) ){
+      ZALLOCERROR();
+      goto TERMINATE;
+    }
+    timer->prp[i].count = 0;
+    timer->prp[i].time = 0;
+    timer->prpnum++;
+  }
+  timer->prp[i].count++;
+  timer->prp[i].time += t;
+ TERMINATE:
+  _ZTKStatsTimerUnlock( timer );
+}
+
+/* call an evaluation function of a property, and measure the time. */
+static void *_ZTKPrpEval(const ZTKPrp *prp, void *obj, int i, void *arg, ZTK *ztk)
+{
+  _ZTKStatsTimer *timer;
+  double t;
+
+  if( !( timer = (_ZTKStatsTimer *)ztk->stats ) ) return prp->_eval( obj, i, arg, ztk );
+  t = _ZTKStatsClock();
+  obj = prp->_eval( obj, i, arg, ztk );
+  _ZTKStatsRecordEval( timer, prp->str, _ZTKStatsClock() - t );
+  return obj;
+}
+#else
+#define _ZTKStatsTimerGet(ztk)
+#define _ZTKStatsTimerDestroy(ztk)
+#define _ZTKStatsParseBegin(ztk)
+#define _ZTKStatsParseEnd(ztk)
+#define _ZTKStatsAllocBegin(ztk)
+#define _ZTKStatsAllocEnd(ztk)
+#define _ZTKPrpEval(prp,obj,i,arg,ztk) (prp)->_eval( obj, i, arg, ztk )
+#endif /* __ZEDA_USE_ZTK_STATS */
+
 /* ********************************************************** */
 /* ZTK format processor.
  *//* ******************************************************* */
@@ -199,6 +777,19 @@ ZTK *ZTKInit(ZTK *ztk)
   ztk->tf_cp = NULL;
   ztk->kf_cp = NULL;
   ztk->val_cp = NULL;
+  ztk->val_id = -1;
+  ztk->numblock = false;
+  ztk->inccache = false;
+  ztk->threadnum = 0;
+  ztk->tokenizer = NULL;
+  ztk->arena = NULL;
+  ztk->tagindex.size = ztk->tagindex.capacity = 0;
+  ztk->tagindex.entry = NULL;
+  ztk->strpool.size = ztk->strpool.capacity = 0;
+  ztk->strpool.entry = NULL;
+  zListInit( &ztk->srclist );
+  ztk->src_cp = NULL;
+  ztk->stats = NULL;
   return ztk;
 }
 
@@ -206,155 +797,1685 @@ ZTK *ZTKInit(ZTK *ztk)
 void ZTKDestroy(ZTK *ztk)
 {
   zFileStackDestroy( &ztk->fs );
-  ZTKTagFieldListDestroy( &ztk->tflist );
+  if( ztk->arena ){ /* all cells are released at once */
+    zArenaDestroy( ztk->arena );
+    zFree( ztk->arena );
+    zListInit( &ztk->tflist );
+    ztk->tagindex.entry = NULL;
+    ztk->strpool.entry = NULL;
+  } else{
+    _ZTKTagFieldListDestroy( &ztk->tflist, true );
+    _ZTKStrPoolDestroy( &ztk->strpool );
+  }
+  _ZTKIndexDestroy( &ztk->tagindex );
+  _ZTKIndexDestroy( &ztk->strpool );
+  ZTKSrcListDestroy( &ztk->srclist );
+  _ZTKStatsTimerDestroy( ztk );
+  ztk->src_cp = NULL;
+  ztk->tf_cp = NULL;
+  ztk->kf_cp = NULL;
+  ztk->val_cp = NULL;
+}
+
+/* enable a memory arena of a ZTK format processor. */
+bool ZTKEnableArena(ZTK *ztk, size_t blocksize)
+{
+  if( ztk->arena ) return true;
+  if( !zListIsEmpty( &ztk->tflist ) ){
+    ZRUNERROR( ZEDA_ERR_ZTK_ARENA_NONEMPTY );
+    return false;
+  }
+  if( !( ztk->arena = zAlloc( zArena, 1 ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  zArenaInit( ztk->arena, blocksize );
+  return true;
+}
+
+/* intern a string in a ZTK format processor. */
+const char *ZTKIntern(ZTK *ztk, const char *str)
+{
+  ZTKIndexEntry *entry;
+
+  if( !str ) return NULL;
+  if( !( entry = _ZTKStrPoolInternN( ztk->arena, &ztk->strpool, str, strlen( str ) ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  return entry->str;
+}
+
+/* register a tagged field to the hash index of tags of a ZTK format processor. */
+static bool _ZTKIndexTag(ZTK *ztk, ZTKTagField *tf, ulong hash)
+{
+  ZTKIndexEntry *entry;
+
+  if( !( entry = _ZTKIndexEntry( ztk->arena, &ztk->tagindex, tf->tag, hash ) ) ) return false;
+  if( entry->tail ) /* chain tagged fields with the same tag */
+    ( (ZTKTagField *)entry->tail )->sibling = tf;
+  else
+    entry->head = tf;
+  entry->tail = tf;
+  entry->num++;
+  return true;
+}
+
+/* add a new tag to a ZTK format processor. */
+static bool _ZTKAddTag(ZTK *ztk, const char *tag, size_t len)
+{
+  ZTKTagFieldListCell *cp;
+  ZTKIndexEntry *entry;
+
+  if( !( entry = _ZTKStrPoolInternN( ztk->arena, &ztk->strpool, tag, len ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  if( !( cp = _ZTKTagFieldListNew( ztk->arena, (char *)entry->str ) ) ) /* allocate a new tagged field */
+    return false;
+  if( !_ZTKIndexTag( ztk, &cp->data, entry->hash ) ){
+    if( !ztk->arena ) free( cp );
+    return false;
+  }
+  cp->data.src = ztk->src_cp;
+  zListInsertHead( &ztk->tflist, ( ztk->tf_cp = cp ) );
+  ztk->kf_cp = NULL; /* unactivate the key field */
+  return true;
+}
+
+/* add a new tag to a ZTK format processor. */
+bool ZTKAddTag(ZTK *ztk, const char *tag)
+{
+  return _ZTKAddTag( ztk, tag, tag ? strlen( tag ) : 0 );
+}
+
+/* register a key field to the hash index of keys of a tagged field. */
+static bool _ZTKTagFieldIndexKey(zArena *arena, ZTKTagField *tf, ZTKKeyField *kf, ulong hash)
+{
+  ZTKIndexEntry *entry;
+
+  if( !( entry = _ZTKIndexEntry( arena, &tf->keyindex, kf->key, hash ) ) ) return false;
+  if( entry->tail ) /* chain key fields with the same key */
+    ( (ZTKKeyField *)entry->tail )->sibling = kf;
+  else
+    entry->head = kf;
+  entry->tail = kf;
+  entry->num++;
+  return true;
+}
+
+/* add a new key to the current tag field of a ZTK format processor. */
+static bool _ZTKAddKey(ZTK *ztk, const char *key, size_t len)
+{
+  ZTKIndexEntry *entry;
+
+  if( ztk->tf_cp->data.src != ztk->src_cp ) /* a tagged field of another file */
+    _ZTKSrcShare( ztk->tf_cp->data.src, ztk->src_cp );
+  if( !( entry = _ZTKStrPoolInternN( ztk->arena, &ztk->strpool, key, len ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  if( !( ztk->kf_cp = _ZTKKeyFieldListNew( ztk->arena, &ztk->tf_cp->data.kflist, (char *)entry->str ) ) )
+    return false;
+  if( !_ZTKTagFieldIndexKey( ztk->arena, &ztk->tf_cp->data, &ztk->kf_cp->data, entry->hash ) ){
+    ZTKDelKey( ztk );
+    return false;
+  }
+  return true;
+}
+
+/* add a new key to the current tag field of a ZTK format processor. */
+bool ZTKAddKey(ZTK *ztk, const char *key)
+{
+  return _ZTKAddKey( ztk, key, key ? strlen( key ) : 0 );
+}
+
+/* delete a key at the head of the current tag field of a ZTK format processor. */
+void ZTKDelKey(ZTK *ztk)
+{
+  ZTKKeyFieldListCell *cp;
+
+  if( ztk->arena ) /* released when the memory arena is destroyed */
+    zListDeleteHead( &ztk->tf_cp->data.kflist, &cp );
+  else
+    _ZTKKeyFieldListHeadDestroy( &ztk->tf_cp->data.kflist, true );
+  /* rebuild the hash index of keys, which never requires a larger table */
+  _ZTKIndexClear( &ztk->tf_cp->data.keyindex );
+  zListForEach( &ztk->tf_cp->data.kflist, cp ){
+    cp->data.sibling = NULL;
+    _ZTKTagFieldIndexKey( ztk->arena, &ztk->tf_cp->data, &cp->data, zStrHash( cp->data.key ) );
+  }
+  ztk->kf_cp = zListIsEmpty( &ztk->tf_cp->data.kflist ) ? NULL : zListHead( &ztk->tf_cp->data.kflist );
+}
+
+/* add a new value to the current key field of a ZTK format processor. */
+static bool _ZTKAddVal(ZTK *ztk, const char *val, size_t len)
+{
+  const char *str;
+
+  if( ztk->tf_cp->data.src != ztk->src_cp ) /* a tagged field of another file */
+    _ZTKSrcShare( ztk->tf_cp->data.src, ztk->src_cp );
+  if( !( str = _ZTKValListAdd( ztk->arena, &ztk->kf_cp->data.vallist, val, len ) ) ) return false;
+  return ztk->numblock ? _ZTKKeyFieldAddNum( ztk->arena, &ztk->kf_cp->data, str ) : true;
+}
+
+/* add a new value to the current key field of a ZTK format processor. */
+bool ZTKAddVal(ZTK *ztk, const char *val)
+{
+  return _ZTKAddVal( ztk, val, val ? strlen( val ) : 0 );
+}
+
+/* add a new integer value to the current key field of a ZTK format processor. */
+bool ZTKAddInt(ZTK *ztk, const int val)
+{
+  char buf[ZEDA_NUM_INT_BUFSIZ];
+
+  return _ZTKAddVal( ztk, buf, zNumFormatInt( val, buf ) );
+}
+
+/* add a new double-precision floating-point value value to the current key field of a ZTK format processor. */
+bool ZTKAddDouble(ZTK *ztk, const double val)
+{
+  char buf[ZEDA_NUM_DOUBLE_BUFSIZ];
+
+  return _ZTKAddVal( ztk, buf, zNumFormatDouble( val, buf ) );
+}
+
+/* read the whole contents of a file stream into a buffer. */
+static char *_ZTKFileRead(FILE *fp, size_t *size)
+{
+  char *buf;
+
+  if( ( *size = zFileSize( fp ) ) == 0 || *size == (size_t)-1 ) return NULL;
+  if( !( buf = zAlloc( char, *size ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  if( ( *size = fread( buf, sizeof(char), *size, fp ) ) == 0 ){
+    free( buf );
+    return NULL;
+  }
+  return buf;
+}
+
+/* ********************************************************** */
+/* streaming parser of ZTK format.
+ *//* ******************************************************* */
+
+/* initialize a streaming parser of ZTK format. */
+ZTKStream *ZTKStreamInit(ZTKStream *stream, bool (* on_tag)(void*,const char*,size_t), bool (* on_key)(void*,const char*,size_t), bool (* on_val)(void*,const char*,size_t), void *arg)
+{
+  stream->on_tag = on_tag;
+  stream->on_key = on_key;
+  stream->on_val = on_val;
+  stream->arg = arg;
+  stream->tokenizer = zTokenizerConfigCurrent();
+  zFileStackInit( &stream->fs );
+  stream->_tagged = stream->_keyed = false;
+  stream->_include = ZTKStreamParse;
+  return stream;
+}
+
+/* destroy a streaming parser of ZTK format. */
+void ZTKStreamDestroy(ZTKStream *stream)
+{
+  zFileStackDestroy( &stream->fs );
+}
+
+/* notify a tag to a streaming parser of ZTK format. */
+static bool _ZTKStreamTag(ZTKStream *stream, const char *tag, size_t len)
+{
+  stream->_tagged = true;
+  stream->_keyed = false;
+  return stream->on_tag ? stream->on_tag( stream->arg, tag, len ) : true;
+}
+
+/* notify a key to a streaming parser of ZTK format. */
+static bool _ZTKStreamKey(ZTKStream *stream, const char *key, size_t len)
+{
+  if( !stream->_tagged && !_ZTKStreamTag( stream, "", 0 ) ) return false; /* activate a null tag */
+  stream->_keyed = true;
+  return stream->on_key ? stream->on_key( stream->arg, key, len ) : true;
+}
+
+/* notify a value to a streaming parser of ZTK format. */
+static bool _ZTKStreamVal(ZTKStream *stream, const char *val, size_t len)
+{
+  if( !stream->_tagged && !_ZTKStreamTag( stream, "", 0 ) ) return false; /* activate a null tag */
+  if( !stream->_keyed && !_ZTKStreamKey( stream, "", 0 ) ) return false; /* activate a null key */
+  return stream->on_val ? stream->on_val( stream->arg, val, len ) : true;
+}
+
+/* scan texts of a scanner by a streaming parser of ZTK format. */
+static bool _ZTKStreamParseScanner(ZTKStream *stream, zScanner *scanner)
+{
+  char path[BUFSIZ];
+
+  zScannerSetTokenizer( scanner, stream->tokenizer );
+  while( zScanToken( scanner ) ){
+    if( scanner->tknlen > 0 && scanner->tkn[0] == stream->tokenizer->tag_begin_ident && scanner->tkn[scanner->tknlen-1] == stream->tokenizer->tag_end_ident ){
+      if( !_ZTKStreamTag( stream, scanner->tkn+1, scanner->tknlen >= 2 ? scanner->tknlen - 2 : 0 ) ) return false;
+      continue;
+    }
+    /* might be a key or a value */
+    if( scanner->tknlen == 7 && strncmp( scanner->tkn, "include", 7 ) == 0 ){ /* include a file */
+      if( zScanTokenCopy( scanner, path, BUFSIZ ) )
+        stream->_include( stream, path );
+      continue;
+    }
+    /* the token might be moved in the buffer by zScanPostCheckKey() */
+    if( zScanPostCheckKey( scanner ) ){ /* token is a key. */
+      if( !_ZTKStreamKey( stream, scanner->tkn, scanner->tknlen ) ) return false;
+    } else{ /* token is a value. */
+      if( !_ZTKStreamVal( stream, scanner->tkn, scanner->tknlen ) ) return false;
+    }
+  }
+  return true;
+}
+
+/* scan a file stream by a streaming parser of ZTK format. */
+bool ZTKStreamParseFP(ZTKStream *stream, FILE *fp)
+{
+  zScanner scanner;
+  bool ret;
+
+  if( !zScannerInitFP( &scanner, fp, 0 ) ) return false;
+  ret = _ZTKStreamParseScanner( stream, &scanner );
+  zScannerDestroy( &scanner );
+  return ret;
+}
+
+/* scan a memory buffer by a streaming parser of ZTK format. */
+bool ZTKStreamParseMem(ZTKStream *stream, const char *buf, size_t len)
+{
+  zScanner scanner;
+
+  return _ZTKStreamParseScanner( stream, zScannerInitMem( &scanner, buf, len ) );
+}
+
+/* scan a file by a streaming parser of ZTK format. */
+bool ZTKStreamParse(ZTKStream *stream, const char *path)
+{
+  zFileStack *fs;
+  bool ret;
+
+  if( !( fs = zFileStackPush( &stream->fs, path ) ) ) return false;
+  ret = ZTKStreamParseFP( stream, fs->fp );
+  zFileStackPop( &stream->fs );
+  return ret;
+}
+
+/* ********************************************************** */
+/* parser of ZTK format.
+ *//* ******************************************************* */
+
+/* add a tag notified by a streaming parser to a ZTK format processor. */
+static bool _ZTKStreamAddTag(void *ztk, const char *tag, size_t len)
+{
+  bool ret;
+
+  _ZTKStatsAllocBegin( (ZTK *)ztk );
+  ret = _ZTKAddTag( (ZTK *)ztk, tag, len );
+  _ZTKStatsAllocEnd( (ZTK *)ztk );
+  return ret;
+}
+
+/* add a key notified by a streaming parser to a ZTK format processor. */
+static bool _ZTKStreamAddKey(void *ztk, const char *key, size_t len)
+{
+  bool ret;
+
+  _ZTKStatsAllocBegin( (ZTK *)ztk );
+  ret = _ZTKAddKey( (ZTK *)ztk, key, len );
+  _ZTKStatsAllocEnd( (ZTK *)ztk );
+  return ret;
+}
+
+/* add a value notified by a streaming parser to a ZTK format processor. */
+static bool _ZTKStreamAddVal(void *ztk, const char *val, size_t len)
+{
+  bool ret;
+
+  _ZTKStatsAllocBegin( (ZTK *)ztk );
+  ret = _ZTKAddVal( (ZTK *)ztk, val, len );
+  _ZTKStatsAllocEnd( (ZTK *)ztk );
+  return ret;
+}
+
+/* begin to parse a source file into a tag-and-key list of a ZTK format processor. */
+static void _ZTKSrcBegin(ZTK *ztk, ZTKSrc *src)
+{
+  src->parent = ztk->src_cp;
+  src->head = zListHead( &ztk->tflist ); /* temporarily the last tagged field */
+  src->num = zListSize( &ztk->tflist ); /* temporarily the number of tagged fields */
+  ztk->src_cp = src;
+}
+
+/* finish parsing a source file into a tag-and-key list of a ZTK format processor. */
+static void _ZTKSrcEnd(ZTK *ztk, ZTKSrc *src)
+{
+  src->num = zListSize( &ztk->tflist ) - src->num;
+  src->head = src->num > 0 ? zListCellNext( src->head ) : NULL;
+  ztk->src_cp = src->parent;
+}
+
+/* record a file to be included that is not found, so that its creation is detected afterward. */
+static bool _ZTKSrcAddAbsent(ZTK *ztk, const char *path)
+{
+  zFileStamp stamp;
+  ZTKSrcListCell *sp;
+
+  memset( &stamp, 0, sizeof(zFileStamp) );
+  if( !ztk->src_cp || _ZTKSrcIsModified( path, &stamp ) ) return true; /* not included or existing */
+  if( !( sp = _ZTKSrcListAdd( &ztk->srclist, path, &stamp ) ) ) return false;
+  sp->data.parent = ztk->src_cp;
+  return true;
+}
+
+/* refer to and replay a document shared via the cache of included files (see below). */
+static void *_ZTKDocAcquire(FILE *fp, zFileStamp *stamp, const zTokenizerConfig *tokenizer);
+static bool _ZTKDocReplay(ZTK *ztk, void *doc);
+
+/* scan and parse texts of a scanner (see below). */
+static bool _ZTKParseScanner(ZTK *ztk, zScanner *scanner);
+
+/* internally scan and parse a file into a tag-and-key list of a ZTK format processor. */
+static bool _ZTKParse(ZTK *ztk, const char *path)
+{
+  bool ret = true;
+  zFileStack *fs;
+  zFileStamp stamp, stamp_path;
+  ZTKSrcListCell *sp;
+  zScanner scanner;
+  char fullpath[BUFSIZ];
+
+  if( !( fs = zFileStackPush( &ztk->fs, path ) ) ){
+    _ZTKSrcAddAbsent( ztk, path );
+    return false;
+  }
+  /* record the source file as zOpenFile() resolves the path */
+  zAddSuffix( path, ZEDA_ZTK_SUFFIX, fullpath, BUFSIZ );
+  if( !zFileStampGet( fs->fp, &stamp ) ||
+      !( sp = _ZTKSrcListAdd( &ztk->srclist, zFileStampGetPath( path, &stamp_path ) ? path : fullpath, &stamp ) ) ){
+    zFileStackPop( &ztk->fs );
+    return false;
+  }
+  _ZTKSrcBegin( ztk, &sp->data );
+  if( ztk->inccache && sp->data.parent && ( sp->data.doc = _ZTKDocAcquire( fs->fp, &stamp, ZTKTokenizer(ztk) ) ) ){
+    ret = _ZTKDocReplay( ztk, sp->data.doc );
+  } else
+  if( zScannerMapFP( &scanner, fs->fp ) ){
+    ret = _ZTKParseScanner( ztk, &scanner );
+    zScannerDestroy( &scanner );
+  } else
+    ret = false;
+  _ZTKSrcEnd( ztk, &sp->data );
+  zFileStackPop( &ztk->fs );
+  return ret;
+}
+
+/* include a file notified by a streaming parser into a ZTK format processor. */
+static bool _ZTKStreamInclude(ZTKStream *stream, const char *path)
+{
+  ZTK *ztk;
+  bool ret;
+
+  ret = _ZTKParse( ( ztk = (ZTK *)stream->arg ), path );
+  /* the included file might activate another tagged field */
+  stream->_tagged = ztk->tf_cp ? true : false;
+  stream->_keyed = ztk->kf_cp ? true : false;
+  return ret;
+}
+
+/* initialize a streaming parser that builds a tag-and-key list of a ZTK format processor. */
+static ZTKStream *_ZTKStreamInit(ZTKStream *stream, ZTK *ztk)
+{
+  ZTKStreamInit( stream, _ZTKStreamAddTag, _ZTKStreamAddKey, _ZTKStreamAddVal, ztk );
+  stream->tokenizer = ZTKTokenizer( ztk );
+  stream->_tagged = ztk->tf_cp ? true : false;
+  stream->_keyed = ztk->kf_cp ? true : false;
+  stream->_include = _ZTKStreamInclude;
+  return stream;
+}
+
+/* scan and parse texts of a scanner into a tag-and-key list of a ZTK format processor. */
+static bool _ZTKParseScanner(ZTK *ztk, zScanner *scanner)
+{
+  ZTKStream stream;
+  bool ret;
+
+  _ZTKStatsParseBegin( ztk );
+  ret = _ZTKStreamParseScanner( _ZTKStreamInit( &stream, ztk ), scanner );
+  _ZTKStatsParseEnd( ztk );
+  return ret;
+}
+
+/* scan and parse a file stream into a tag-and-key list of a ZTK format processor. */
+bool ZTKParseFP(ZTK *ztk, FILE *fp)
+{
+  zScanner scanner;
+  bool ret;
+
+  if( !zScannerInitFP( &scanner, fp, 0 ) ) return false;
+  ret = _ZTKParseScanner( ztk, &scanner );
+  zScannerDestroy( &scanner );
+  return ret;
+}
+
+/* scan and parse a memory buffer into a tag-and-key list of a ZTK format processor. */
+bool ZTKParseMem(ZTK *ztk, const char *buf, size_t len)
+{
+  zScanner scanner;
+
+  return _ZTKParseScanner( ztk, zScannerInitMem( &scanner, buf, len ) );
+}
+
+/* ********************************************************** */
+/* concurrent parser of included files of ZTK format.
+ *
+ * Each file is read and scanned by a worker thread into a list
+ * of events, in which the tokens refer to the contents of the
+ * file. Included files are registered to a table as they are
+ * found, and are scanned by other workers in turn. The events
+ * are then replayed from the top file in the original order, so
+ * that the resulting tag-and-key list is identical with the one
+ * by serial parsing.
+ *//* ******************************************************* */
+
+#define ZTK_EVENT_TAG     0
+#define ZTK_EVENT_KEY     1
+#define ZTK_EVENT_VAL     2
+#define ZTK_EVENT_INCLUDE 3
+
+/* an event notified by a streaming parser. */
+typedef struct{
+  int type;        /* type of the event */
+  const char *str; /* token in the contents of a file */
+  size_t len;      /* length of the token */
+  int include;     /* identifier of the included file */
+} _ZTKEvent;
+
+#define ZTK_INCLUDE_PENDING 0 /* not scanned yet */
+#define ZTK_INCLUDE_READY   1 /* scanned into events */
+#define ZTK_INCLUDE_FAILED  2 /* failed to open */
+#define ZTK_INCLUDE_UNREAD  3 /* failed to scan; parsed serially at replaying */
+
+/* a file to be included. */
+typedef struct{
+  char *path;        /* path of the file as specified */
+  ulong hash;        /* hash value of the path */
+  char *srcpath;     /* path of the file recorded to the list of source files */
+  zFileStamp stamp;  /* stamp of the file */
+  char *buf;         /* contents of the file */
+  int status;        /* status of scanning */
+  int eventnum;      /* number of events */
+  int eventcapacity; /* size of the array of events */
+  _ZTKEvent *event;  /* array of events */
+} _ZTKIncludeFile;
+
+/* a table of files to be included. */
+typedef struct{
+  int num;                /* number of files */
+  int capacity;           /* size of the array of files */
+  _ZTKIncludeFile **file; /* array of files */
+  int next;               /* identifier of the next file to be scanned */
+  int busy;               /* number of files being scanned */
+  const zTokenizerConfig *tokenizer; /* configuration of tokenizers */
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+#endif /* __ZEDA_USE_PTHREAD */
+} _ZTKIncludeTable;
+
+#ifdef __ZEDA_USE_PTHREAD
+#define _ZTKIncludeTableLock(table)   pthread_mutex_lock( &(table)->mutex )
+#define _ZTKIncludeTableUnlock(table) pthread_mutex_unlock( &(table)->mutex )
+#define _ZTKIncludeTableWait(table)   pthread_cond_wait( &(table)->cond, &(table)->mutex )
+#define _ZTKIncludeTableNotify(table) pthread_cond_broadcast( &(table)->cond )
+#else
+#define _ZTKIncludeTableLock(table)
+#define _ZTKIncludeTableUnlock(table)
+#define _ZTKIncludeTableWait(table)
+#define _ZTKIncludeTableNotify(table)
+#endif /* __ZEDA_USE_PTHREAD */
+
+/* initialize a table of files to be included. */
+static void _ZTKIncludeTableInit(_ZTKIncludeTable *table)
+{
+  table->num = table->capacity = 0;
+  table->file = NULL;
+  table->next = table->busy = 0;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_init( &table->mutex, NULL );
+  pthread_cond_init( &table->cond, NULL );
+#endif /* __ZEDA_USE_PTHREAD */
+}
+
+/* release events and contents of a file to be included. */
+static void _ZTKIncludeFileClear(_ZTKIncludeFile *file)
+{
+  zFree( file->buf );
+  zFree( file->event );
+  file->eventnum = file->eventcapacity = 0;
+}
+
+/* destroy a table of files to be included. */
+static void _ZTKIncludeTableDestroy(_ZTKIncludeTable *table)
+{
+  int i;
+
+  for( i=0; i<table->num; i++ ){
+    _ZTKIncludeFileClear( table->file[i] );
+    free( table->file[i]->path );
+    zFree( table->file[i]->srcpath );
+    free( table->file[i] );
+  }
+  zFree( table->file );
+  table->num = table->capacity = 0;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_destroy( &table->mutex );
+  pthread_cond_destroy( &table->cond );
+#endif /* __ZEDA_USE_PTHREAD */
+}
+
+/* register a file to a table of files to be included (the table has to be locked).
+ * the identifier of the file is returned. if the same path is already registered,
+ * the file is shared. */
+static int _ZTKIncludeTableAdd(_ZTKIncludeTable *table, const char *path)
+{
+  _ZTKIncludeFile *file, **array;
+  ulong hash;
+  int i;
+
+  hash = zStrHash( path );
+  for( i=0; i<table->num; i++ )
+    if( table->file[i]->hash == hash && strcmp( table->file[i]->path, path ) == 0 ) return i;
+  if( table->num == table->capacity ){
+    if( !( array = zRealloc( table->file, _ZTKIncludeFile*, table->capacity == 0 ? 8 : table->capacity * 2 ) ) ){
+      ZALLOCERROR();
+      return -1;
+    }
+    table->file = array;
+    table->capacity = table->capacity == 0 ? 8 : table->capacity * 2;
+  }
+  if( !( file = zAlloc( _ZTKIncludeFile, 1 ) ) || !( file->path = zStrClone( path ) ) ){
+    ZALLOCERROR();
+    zFree( file );
+    return -1;
+  }
+  file->hash = hash;
+  file->status = ZTK_INCLUDE_PENDING;
+  table->file[table->num] = file;
+  _ZTKIncludeTableNotify( table );
+  return table->num++;
+}
+
+/* add an event to a file to be included. */
+static bool _ZTKIncludeFileAddEvent(_ZTKIncludeFile *file, int type, const char *str, size_t len, int include)
+{
+  _ZTKEvent *array;
+
+  if( file->eventnum == file->eventcapacity ){
+    if( !( array = zRealloc( file->event, _ZTKEvent, file->eventcapacity == 0 ? 16 : file->eventcapacity * 2 ) ) ){
+      ZALLOCERROR();
+      return false;
+    }
+    file->event = array;
+    file->eventcapacity = file->eventcapacity == 0 ? 16 : file->eventcapacity * 2;
+  }
+  file->event[file->eventnum].type = type;
+  file->event[file->eventnum].str = str;
+  file->event[file->eventnum].len = len;
+  file->event[file->eventnum].include = include;
+  file->eventnum++;
+  return true;
+}
+
+/* recorder of events of a file to be included. */
+typedef struct{
+  _ZTKIncludeTable *table;
+  _ZTKIncludeFile *file;
+  bool ok;
+} _ZTKRecorder;
+
+/* record a tag notified by a streaming parser. */
+static bool _ZTKRecordTag(void *rec, const char *tag, size_t len)
+{
+  return _ZTKIncludeFileAddEvent( ((_ZTKRecorder *)rec)->file, ZTK_EVENT_TAG, tag, len, -1 );
+}
+
+/* record a key notified by a streaming parser. */
+static bool _ZTKRecordKey(void *rec, const char *key, size_t len)
+{
+  return _ZTKIncludeFileAddEvent( ((_ZTKRecorder *)rec)->file, ZTK_EVENT_KEY, key, len, -1 );
+}
+
+/* record a value notified by a streaming parser. */
+static bool _ZTKRecordVal(void *rec, const char *val, size_t len)
+{
+  return _ZTKIncludeFileAddEvent( ((_ZTKRecorder *)rec)->file, ZTK_EVENT_VAL, val, len, -1 );
+}
+
+/* record an inclusion notified by a streaming parser, and register the included file. */
+static bool _ZTKRecordInclude(ZTKStream *stream, const char *path)
+{
+  _ZTKRecorder *rec;
+  int id;
+
+  rec = (_ZTKRecorder *)stream->arg;
+  _ZTKIncludeTableLock( rec->table );
+  id = _ZTKIncludeTableAdd( rec->table, path );
+  _ZTKIncludeTableUnlock( rec->table );
+  if( id < 0 || !_ZTKIncludeFileAddEvent( rec->file, ZTK_EVENT_INCLUDE, NULL, 0, id ) )
+    return ( rec->ok = false );
+  /* the tagged and keyed states after inclusion are resolved at replaying */
+  stream->_tagged = stream->_keyed = true;
+  return true;
+}
+
+/* read and scan a file to be included into events. */
+static void _ZTKIncludeFileScan(_ZTKIncludeTable *table, _ZTKIncludeFile *file)
+{
+  FILE *fp;
+  ZTKStream stream;
+  _ZTKRecorder rec;
+  zFileStamp stamp_path;
+  char fullpath[BUFSIZ];
+  size_t size;
+
+  if( !( fp = zOpenZTKFile( file->path, "rb" ) ) ){
+    file->status = ZTK_INCLUDE_FAILED;
+    return;
+  }
+  zAddSuffix( file->path, ZEDA_ZTK_SUFFIX, fullpath, BUFSIZ );
+  if( !zFileStampGet( fp, &file->stamp ) ||
+      !( file->srcpath = zStrClone( zFileStampGetPath( file->path, &stamp_path ) ? file->path : fullpath ) ) ||
+      !( file->buf = _ZTKFileRead( fp, &size ) ) ){
+    fclose( fp );
+    file->status = ZTK_INCLUDE_UNREAD;
+    return;
+  }
+  fclose( fp );
+  rec.table = table;
+  rec.file = file;
+  rec.ok = true;
+  ZTKStreamInit( &stream, _ZTKRecordTag, _ZTKRecordKey, _ZTKRecordVal, &rec );
+  stream.tokenizer = table->tokenizer;
+  /* null tags and keys at the head of a file are activated at replaying */
+  stream._tagged = stream._keyed = true;
+  stream._include = _ZTKRecordInclude;
+  if( ZTKStreamParseMem( &stream, file->buf, size ) && rec.ok )
+    file->status = ZTK_INCLUDE_READY;
+  else{
+    _ZTKIncludeFileClear( file );
+    file->status = ZTK_INCLUDE_UNREAD;
+  }
+  ZTKStreamDestroy( &stream );
+}
+
+/* a worker that scans files registered in a table one after another. */
+static void *_ZTKIncludeWorker(void *arg)
+{
+  _ZTKIncludeTable *table;
+  _ZTKIncludeFile *file;
+
+  table = (_ZTKIncludeTable *)arg;
+  _ZTKIncludeTableLock( table );
+  while( 1 ){
+    if( table->next < table->num ){
+      file = table->file[table->next++];
+      table->busy++;
+      _ZTKIncludeTableUnlock( table );
+      _ZTKIncludeFileScan( table, file );
+      _ZTKIncludeTableLock( table );
+      table->busy--;
+      continue;
+    }
+    if( table->busy == 0 ) break; /* no more files would be registered */
+    _ZTKIncludeTableWait( table );
+  }
+  _ZTKIncludeTableNotify( table );
+  _ZTKIncludeTableUnlock( table );
+  return NULL;
+}
+
+/* an ancestor in a chain of inclusion. */
+typedef struct __ZTKIncludeAncestor{
+  _ZTKIncludeFile *file;
+  struct __ZTKIncludeAncestor *prev;
+} _ZTKIncludeAncestor;
+
+/* replay events of a file to be included into a tag-and-key list of a ZTK format processor. */
+static bool _ZTKIncludeReplay(ZTK *ztk, _ZTKIncludeTable *table, int id, _ZTKIncludeAncestor *prev)
+{
+  _ZTKIncludeFile *file;
+  _ZTKIncludeAncestor ancestor, *ap;
+  _ZTKEvent *event;
+  ZTKStream stream;
+  ZTKSrcListCell *sp;
+  bool ret = true;
+  int i;
+
+  file = table->file[id];
+  if( file->status == ZTK_INCLUDE_FAILED ){
+    _ZTKSrcAddAbsent( ztk, file->path );
+    return false;
+  }
+  if( file->status == ZTK_INCLUDE_UNREAD ) return _ZTKParse( ztk, file->path );
+  for( ap=prev; ap; ap=ap->prev ) /* the same check with zFileStackPush() */
+    if( zFileStampIsIdent( &ap->file->stamp, &file->stamp ) ){
+      ZRUNWARN( ZEDA_WARN_ZTK_INCLUDE_DUP, file->path );
+      return false;
+    }
+  if( !( sp = _ZTKSrcListAdd( &ztk->srclist, file->srcpath, &file->stamp ) ) ) return false;
+  ancestor.file = file;
+  ancestor.prev = prev;
+  _ZTKSrcBegin( ztk, &sp->data );
+  _ZTKStreamInit( &stream, ztk );
+  for( event=file->event, i=0; ret && i<file->eventnum; event++, i++ ){
+    switch( event->type ){
+    case ZTK_EVENT_TAG: ret = _ZTKStreamTag( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_KEY: ret = _ZTKStreamKey( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_VAL: ret = _ZTKStreamVal( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_INCLUDE:
+      _ZTKIncludeReplay( ztk, table, event->include, &ancestor );
+      /* the included file might activate another tagged field */
+      stream._tagged = ztk->tf_cp ? true : false;
+      stream._keyed = ztk->kf_cp ? true : false;
+      break;
+    default: ;
+    }
+  }
+  ZTKStreamDestroy( &stream );
+  _ZTKSrcEnd( ztk, &sp->data );
+  return ret;
+}
+
+/* scan and parse a file and included files concurrently into a tag-and-key list of a ZTK format processor. */
+static bool _ZTKParseConcurrent(ZTK *ztk, const char *path)
+{
+  _ZTKIncludeTable table;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_t *thread;
+  int i, threadnum = 0;
+#endif /* __ZEDA_USE_PTHREAD */
+  bool ret;
+
+  _ZTKIncludeTableInit( &table );
+  table.tokenizer = ZTKTokenizer( ztk );
+  if( _ZTKIncludeTableAdd( &table, path ) < 0 ){
+    _ZTKIncludeTableDestroy( &table );
+    return false;
+  }
+#ifdef __ZEDA_USE_PTHREAD
+  /* the current thread also works as one of workers */
+  if( ( thread = zAlloc( pthread_t, ztk->threadnum ) ) )
+    for( ; threadnum<ztk->threadnum-1; threadnum++ )
+      if( pthread_create( &thread[threadnum], NULL, _ZTKIncludeWorker, &table ) != 0 ) break;
+  _ZTKIncludeWorker( &table );
+  for( i=0; i<threadnum; i++ )
+    pthread_join( thread[i], NULL );
+  zFree( thread );
+#else
+  _ZTKIncludeWorker( &table );
+#endif /* __ZEDA_USE_PTHREAD */
+  ret = _ZTKIncludeReplay( ztk, &table, 0, NULL );
+  _ZTKIncludeTableDestroy( &table );
+  return ret;
+}
+
+/* ********************************************************** */
+/* shared cache of included files of ZTK format.
+ *
+ * An included file is scanned into events once, and kept with
+ * its contents in a process-wide cache keyed by the stamp of the
+ * file. Processors with the cache enabled replay the events of a
+ * cached file instead of reading and scanning it again. Each
+ * document is referred by source files of processors, and is
+ * released when the last referrer is destroyed.
+ *//* ******************************************************* */
+
+#define ZTK_DOC_CACHE_SLOT 64
+
+/* a document of an included file. */
+typedef struct __ZTKDoc{
+  _ZTKIncludeFile file; /* stamp, contents and events of the file */
+  zTokenizerConfig tokenizer; /* copy of the configuration of tokenizers which scanned the file */
+  int refcount;         /* number of referrers */
+  struct __ZTKDoc *next;
+} _ZTKDoc;
+
+static _ZTKDoc *_ztk_doc_cache[ZTK_DOC_CACHE_SLOT];
+static int _ztk_doc_cache_size = 0;
+
+#ifdef __ZEDA_USE_PTHREAD
+static pthread_mutex_t _ztk_doc_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+#define _ZTKDocCacheLock()   pthread_mutex_lock( &_ztk_doc_cache_mutex )
+#define _ZTKDocCacheUnlock() pthread_mutex_unlock( &_ztk_doc_cache_mutex )
+#else
+#define _ZTKDocCacheLock()
+#define _ZTKDocCacheUnlock()
+#endif /* __ZEDA_USE_PTHREAD */
+
+#define _ZTKDocCacheSlot(stamp) ( ( (stamp)->dev ^ (stamp)->ino ) % ZTK_DOC_CACHE_SLOT )
+
+/* destroy a document of an included file. */
+static void _ZTKDocDestroy(_ZTKDoc *doc)
+{
+  int i;
+
+  for( i=0; i<doc->file.eventnum; i++ )
+    if( doc->file.event[i].type == ZTK_EVENT_INCLUDE ) free( (char *)doc->file.event[i].str );
+  _ZTKIncludeFileClear( &doc->file );
+  free( doc );
+}
+
+/* record an inclusion notified by a streaming parser to a document. */
+static bool _ZTKDocRecordInclude(ZTKStream *stream, const char *path)
+{
+  _ZTKRecorder *rec;
+  char *str;
+
+  rec = (_ZTKRecorder *)stream->arg;
+  if( !( str = zStrClone( path ) ) ){
+    ZALLOCERROR();
+    return ( rec->ok = false );
+  }
+  if( !_ZTKIncludeFileAddEvent( rec->file, ZTK_EVENT_INCLUDE, str, strlen( str ), -1 ) ){
+    free( str );
+    return ( rec->ok = false );
+  }
+  /* the tagged and keyed states after inclusion are resolved at replaying */
+  stream->_tagged = stream->_keyed = true;
+  return true;
+}
+
+/* read and scan a file into a document. */
+static _ZTKDoc *_ZTKDocScan(FILE *fp, zFileStamp *stamp, const zTokenizerConfig *tokenizer)
+{
+  _ZTKDoc *doc;
+  ZTKStream stream;
+  _ZTKRecorder rec;
+  size_t size;
+
+  if( !( doc = zAlloc( _ZTKDoc, 1 ) ) ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  zCopy( zFileStamp, stamp, &doc->file.stamp );
+  zCopy( zTokenizerConfig, tokenizer, &doc->tokenizer );
+  if( !( doc->file.buf = _ZTKFileRead( fp, &size ) ) ){
+    free( doc );
+    return NULL;
+  }
+  rec.table = NULL;
+  rec.file = &doc->file;
+  rec.ok = true;
+  ZTKStreamInit( &stream, _ZTKRecordTag, _ZTKRecordKey, _ZTKRecordVal, &rec );
+  stream.tokenizer = tokenizer;
+  /* null tags and keys at the head of a file are activated at replaying */
+  stream._tagged = stream._keyed = true;
+  stream._include = _ZTKDocRecordInclude;
+  if( ZTKStreamParseMem( &stream, doc->file.buf, size ) && rec.ok )
+    doc->refcount = 1;
+  else{
+    _ZTKDocDestroy( doc );
+    doc = NULL;
+  }
+  ZTKStreamDestroy( &stream );
+  return doc;
+}
+
+/* check if two configurations of tokenizers tokenize texts in the same way.
+ * they are compared by contents, since a configuration can be modified in place. */
+static bool _ZTKTokenizerIsEqual(const zTokenizerConfig *config1, const zTokenizerConfig *config2)
+{
+  return memcmp( config1->char_class, config2->char_class, sizeof(config1->char_class) ) == 0 &&
+    config1->comment_ident == config2->comment_ident &&
+    config1->tag_begin_ident == config2->tag_begin_ident &&
+    config1->tag_end_ident == config2->tag_end_ident &&
+    config1->key_ident == config2->key_ident;
+}
+
+/* find a document of a file in the cache, and refer to it (the cache has to be locked). */
+static _ZTKDoc *_ZTKDocCacheFind(zFileStamp *stamp, const zTokenizerConfig *tokenizer)
+{
+  _ZTKDoc *doc;
+
+  for( doc=_ztk_doc_cache[_ZTKDocCacheSlot(stamp)]; doc; doc=doc->next )
+    if( zFileStampIsEqual( &doc->file.stamp, stamp ) && _ZTKTokenizerIsEqual( &doc->tokenizer, tokenizer ) ){
+      doc->refcount++;
+      return doc;
+    }
+  return NULL;
+}
+
+/* refer to a document of a file, which is read and cached if not found in the cache. */
+static void *_ZTKDocAcquire(FILE *fp, zFileStamp *stamp, const zTokenizerConfig *tokenizer)
+{
+  _ZTKDoc *doc, *found;
+
+  _ZTKDocCacheLock();
+  doc = _ZTKDocCacheFind( stamp, tokenizer );
+  _ZTKDocCacheUnlock();
+  if( doc ) return doc;
+  if( !( doc = _ZTKDocScan( fp, stamp, tokenizer ) ) ){
+    rewind( fp ); /* to be parsed in the ordinary way */
+    return NULL;
+  }
+  _ZTKDocCacheLock();
+  if( !( found = _ZTKDocCacheFind( stamp, tokenizer ) ) ){ /* another thread might cache the same file meanwhile */
+    doc->next = _ztk_doc_cache[_ZTKDocCacheSlot(stamp)];
+    _ztk_doc_cache[_ZTKDocCacheSlot(stamp)] = doc;
+    _ztk_doc_cache_size++;
+  }
+  _ZTKDocCacheUnlock();
+  if( found ){
+    _ZTKDocDestroy( doc );
+    doc = found;
+  }
+  return doc;
+}
+
+/* release a document of an included file, which is destroyed if no longer referred. */
+static void _ZTKDocRelease(void *doc)
+{
+  _ZTKDoc **dp;
+
+  _ZTKDocCacheLock();
+  if( --((_ZTKDoc *)doc)->refcount == 0 ){
+    for( dp=&_ztk_doc_cache[_ZTKDocCacheSlot(&((_ZTKDoc *)doc)->file.stamp)]; *dp!=doc; dp=&(*dp)->next );
+    *dp = (*dp)->next;
+    _ztk_doc_cache_size--;
+  } else
+    doc = NULL;
+  _ZTKDocCacheUnlock();
+  if( doc ) _ZTKDocDestroy( (_ZTKDoc *)doc );
+}
+
+/* replay events of a document into a tag-and-key list of a ZTK format processor. */
+static bool _ZTKDocReplay(ZTK *ztk, void *doc)
+{
+  _ZTKIncludeFile *file;
+  _ZTKEvent *event;
+  ZTKStream stream;
+  bool ret = true;
+  int i;
+
+  file = &((_ZTKDoc *)doc)->file;
+  _ZTKStreamInit( &stream, ztk );
+  for( event=file->event, i=0; ret && i<file->eventnum; event++, i++ ){
+    switch( event->type ){
+    case ZTK_EVENT_TAG: ret = _ZTKStreamTag( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_KEY: ret = _ZTKStreamKey( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_VAL: ret = _ZTKStreamVal( &stream, event->str, event->len ); break;
+    case ZTK_EVENT_INCLUDE: _ZTKStreamInclude( &stream, event->str ); break;
+    default: ;
+    }
+  }
+  ZTKStreamDestroy( &stream );
+  return ret;
+}
+
+/* the number of documents in the cache of included files. */
+int ZTKIncludeCacheSize(void)
+{
+  int size;
+
+  _ZTKDocCacheLock();
+  size = _ztk_doc_cache_size;
+  _ZTKDocCacheUnlock();
+  return size;
+}
+
+/* scan and parse a file (serially or concurrently) into a tag-and-key list of a ZTK format processor. */
+#define _ZTKParseFile(ztk,path) ( (ztk)->threadnum > 0 ? _ZTKParseConcurrent( ztk, path ) : _ZTKParse( ztk, path ) )
+
+/* write a binary cache (see below). */
+static bool _ZTKWriteCache(ZTK *ztk, const char *path, bool quiet);
+
+/* scan and parse a file into a tag-and-key list of a ZTK format processor via the binary cache if available. */
+static bool _ZTKParseCached(ZTK *ztk, const char *path)
+{
+  char cachepath[BUFSIZ];
+  zFileStamp stamp;
+
+  if( !zListIsEmpty( &ztk->tflist ) ||
+      !zFileStampGetPath( ZTKCachePath( path, cachepath, BUFSIZ ), &stamp ) )
+    return _ZTKParseFile( ztk, path );
+  if( ZTKReadCache( ztk, cachepath ) ) return true;
+  if( !_ZTKParseFile( ztk, path ) ) return false;
+  _ZTKWriteCache( ztk, cachepath, true ); /* refresh the stale cache if the directory is writable */
+  return true;
+}
+
+/* scan and parse a file into a tag-and-key list of a ZTK format processor. */
+bool ZTKParse(ZTK *ztk, const char *path)
+{
+  bool ret;
+
+  _ZTKStatsParseBegin( ztk );
+  ret = _ZTKParseCached( ztk, path );
+  _ZTKStatsParseEnd( ztk );
+  return ret;
+}
+
+/* ********************************************************** */
+/* incremental reload of ZTK format.
+ *//* ******************************************************* */
+
+/* rebuild the hash index of tags of a ZTK format processor. */
+static bool _ZTKReindexTag(ZTK *ztk)
+{
+  ZTKTagFieldListCell *cp;
+
+  _ZTKIndexClear( &ztk->tagindex );
+  zListForEach( &ztk->tflist, cp ){
+    cp->data.sibling = NULL;
+    if( !_ZTKIndexTag( ztk, &cp->data, zStrHash( cp->data.tag ) ) ) return false;
+  }
+  return true;
+}
+
+/* push ancestors of a source file to the file stack of a ZTK format processor to detect duplicate inclusions.
+ * if one of them cannot be pushed, those already pushed are popped. */
+static int _ZTKSrcPushAncestor(ZTK *ztk, ZTKSrc *src)
+{
+  int depth;
+
+  if( !src ) return 0;
+  if( ( depth = _ZTKSrcPushAncestor( ztk, src->parent ) ) < 0 ) return -1;
+  if( zFileStackPush( &ztk->fs, src->path ) ) return depth + 1;
+  for( ; depth>0; depth-- ) zFileStackPop( &ztk->fs );
+  return -1;
+}
+
+/* re-parse a source file, and replace the tagged fields parsed from it next to an anchor. */
+static bool _ZTKSrcSplice(ZTK *ztk, ZTKSrc *src, ZTKTagFieldListCell *anchor)
+{
+  ZTKTagFieldList rest;
+  ZTKTagFieldListCell *cp;
+  ZTKSrcList srclist;
+  ZTKSrcListCell *sp, *sp_next;
+  ZTKSrc *ap;
+  int i, num, depth;
+  bool ret = false;
+
+  for( i=0; i<src->num; i++ ){ /* remove the old tagged fields */
+    cp = zListCellNext( anchor );
+    zListPurge( &ztk->tflist, cp );
+    if( !ztk->arena ) /* otherwise released when the memory arena is destroyed */
+      _ZTKTagFieldListCellDestroy( cp, true );
+  }
+  zListInit( &rest ); /* detach the following tagged fields */
+  while( zListHead(&ztk->tflist) != anchor ){
+    zListDeleteHead( &ztk->tflist, &cp );
+    zListInsertTail( &rest, cp );
+  }
+  /* restore the context at the beginning of the file */
+  ztk->tf_cp = anchor == zListRoot(&ztk->tflist) ? NULL : anchor;
+  ztk->kf_cp = ztk->tf_cp && !zListIsEmpty(&ztk->tf_cp->data.kflist) ? zListHead(&ztk->tf_cp->data.kflist) : NULL;
+  ztk->src_cp = src->parent;
+  num = zListSize( &ztk->tflist );
+  if( ( depth = _ZTKSrcPushAncestor( ztk, src->parent ) ) >= 0 )
+    ret = _ZTKParse( ztk, src->path );
+  for( ; depth>0; depth-- ) zFileStackPop( &ztk->fs );
+  ztk->src_cp = NULL;
+  num = zListSize( &ztk->tflist ) - num;
+  zListAppendA( &ztk->tflist, &rest );
+  for( ap=src->parent; ap; ap=ap->parent ){ /* update ranges of including files */
+    ap->num += num - src->num;
+    if( ap->head == src->head ) ap->head = ap->num > 0 ? zListCellNext( anchor ) : NULL;
+  }
+  /* remove the old source file and files included from it */
+  zListInit( &srclist );
+  for( sp=zListTail(&ztk->srclist); sp!=zListRoot(&ztk->srclist); sp=sp_next ){
+    sp_next = zListCellNext( sp );
+    if( _ZTKSrcIsAncestor( src, &sp->data ) ){
+      zListPurge( &ztk->srclist, sp );
+      zListInsertHead( &srclist, sp );
+    }
+  }
+  ZTKSrcListDestroy( &srclist );
+  return ret;
+}
+
+/* check if a whole tag-and-key list of a ZTK format processor is parsed from a single file. */
+static ZTKSrc *_ZTKSrcRoot(ZTK *ztk)
+{
+  ZTKSrcListCell *sp;
+  ZTKTagFieldListCell *cp;
+  ZTKSrc *root = NULL;
+
+  zListForEach( &ztk->srclist, sp )
+    if( !sp->data.parent ){
+      if( root ) return NULL;
+      root = &sp->data;
+    }
+  zListForEach( &ztk->tflist, cp )
+    if( !cp->data.src ) return NULL;
+  return root;
+}
+
+/* reload changed source files of a ZTK format processor. */
+bool ZTKReload(ZTK *ztk)
+{
+  ZTKSrcListCell *sp;
+  ZTKSrc **src, *sp_reload, *root = NULL;
+  int i, j, num = 0;
+  bool whole = false, ret = true;
+
+  if( !( src = zAlloc( ZTKSrc*, zListSize(&ztk->srclist) + 1 ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  zListForEach( &ztk->srclist, sp ){
+    if( !_ZTKSrcIsModified( sp->data.path, &sp->data.stamp ) ) continue;
+    /* the nearest file whose tagged fields can be replaced independently */
+    for( sp_reload=&sp->data; sp_reload && ( sp_reload->shared || sp_reload->num == 0 ); sp_reload=sp_reload->parent );
+    if( !sp_reload ){
+      whole = true;
+      break;
+    }
+    for( i=0; i<num; i++ )
+      if( src[i] == sp_reload ) break;
+    if( i == num ) src[num++] = sp_reload;
+  }
+  if( whole ){
+    if( !( root = _ZTKSrcRoot( ztk ) ) ){
+      ZRUNERROR( ZEDA_ERR_ZTK_RELOAD_UNSPLICEABLE );
+      ret = false;
+    } else{
+      _ZTKIndexClear( &ztk->tagindex );
+      ret = _ZTKSrcSplice( ztk, root, zListRoot(&ztk->tflist) );
+    }
+  } else
+  if( num > 0 ){
+    for( i=0; i<num; i++ ) /* files included from another file to be reloaded are skipped */
+      for( j=0; j<num; j++ )
+        if( i != j && src[j] && src[i] != src[j] && _ZTKSrcIsAncestor( src[j], src[i] ) ){
+          src[i] = NULL;
+          break;
+        }
+    _ZTKIndexClear( &ztk->tagindex ); /* chains of tagged fields are rebuilt afterward */
+    for( i=0; i<num; i++ )
+      if( src[i] && !_ZTKSrcSplice( ztk, src[i], zListCellPrev( src[i]->head ) ) ) ret = false;
+  }
+  free( src );
+  if( whole || num > 0 ){
+    if( !_ZTKReindexTag( ztk ) ) ret = false;
+    ZTKRewind( ztk );
+  }
+  return ret;
+}
+
+/* ********************************************************** */
+/* binary cache of ZTK format.
+ *
+ * All integers are stored in little endian. A string is stored
+ * as its length (4 bytes) followed by the charactors without
+ * the null charactor.
+ *
+ *  "ZTKC" version(4) number-of-sources(4) number-of-tags(4)
+ *  table-of-classes-of-charactors(256) comment(1) tag-begin(1) tag-end(1) key(1)
+ *  for each source: dev(8) ino(8) mtime(8) mtime_nsec(4) size(8) parent(4) shared(1) path
+ *  for each tag: source(4) tag number-of-keys(4)
+ *   for each key: key number-of-values(4)
+ *    for each value: value
+ *
+ * A source file and that of a tag are stored as the index of
+ * the source file, or ZTK_CACHE_NOSRC if it does not exist.
+ * The cache is stale if the tokenizer settings differ from
+ * those of the reader (see _ZTKTokenizerIsEqual()).
+ * An included file that was not found is stored with a stamp
+ * of zeros, and the cache is stale once the file is created.
+ *//* ******************************************************* */
+
+#define ZTK_CACHE_ID      "ZTKC"
+#define ZTK_CACHE_VERSION 4
+#define ZTK_CACHE_NOSRC   0xffffffffUL
+
+/* make a path to the binary cache of a ZTK file. */
+char *ZTKCachePath(const char *path, char *cachepath, size_t size)
+{
+  char *sfx;
+
+  return ( sfx = zGetSuffix( path ) ) && strcmp( sfx, ZEDA_ZTK_SUFFIX ) == 0 ?
+    zReplaceSuffix( path, ZEDA_ZTK_CACHE_SUFFIX, cachepath, size ) :
+    zAddSuffix( path, ZEDA_ZTK_CACHE_SUFFIX, cachepath, size );
+}
+
+/* write an unsigned integer to a binary cache. */
+static bool _ZTKCacheFWriteUInt(FILE *fp, ulong val, int size)
+{
+  ubyte buf[8];
+  int i;
+
+  for( i=0; i<size; i++, val>>=8 ) buf[i] = (ubyte)( val & 0xff );
+  return fwrite( buf, 1, size, fp ) == (size_t)size;
+}
+
+/* write a string to a binary cache. */
+static bool _ZTKCacheFWriteStr(FILE *fp, const char *str)
+{
+  size_t len;
+
+  len = strlen( str );
+  return _ZTKCacheFWriteUInt( fp, len, 4 ) && fwrite( str, 1, len, fp ) == len;
+}
+
+/* write tokenizer settings to a binary cache. */
+static bool _ZTKCacheFWriteTokenizer(FILE *fp, const zTokenizerConfig *tokenizer)
+{
+  return fwrite( tokenizer->char_class, 1, sizeof(tokenizer->char_class), fp ) == sizeof(tokenizer->char_class) &&
+    _ZTKCacheFWriteUInt( fp, (ubyte)tokenizer->comment_ident, 1 ) &&
+    _ZTKCacheFWriteUInt( fp, (ubyte)tokenizer->tag_begin_ident, 1 ) &&
+    _ZTKCacheFWriteUInt( fp, (ubyte)tokenizer->tag_end_ident, 1 ) &&
+    _ZTKCacheFWriteUInt( fp, (ubyte)tokenizer->key_ident, 1 );
+}
+
+/* index of a source file in an array for a binary cache. */
+static ulong _ZTKCacheSrcIndex(ZTKSrc **src, int num, ZTKSrc *sp)
+{
+  int i;
+
+  if( sp )
+    for( i=0; i<num; i++ )
+      if( src[i] == sp ) return i;
+  return ZTK_CACHE_NOSRC;
+}
+
+/* write a tag-and-key list to a binary cache. */
+static bool _ZTKCacheFWrite(FILE *fp, ZTK *ztk, ZTKSrc **src)
+{
+  ZTKSrcListCell *sp;
+  ZTKTagFieldListCell *tp;
+  ZTKKeyFieldListCell *kp;
+  ZTKSrc *src_prev = NULL;
+  ulong id = ZTK_CACHE_NOSRC;
+  int i = 0, j;
+
+  if( fwrite( ZTK_CACHE_ID, 1, 4, fp ) != 4 ||
+      !_ZTKCacheFWriteUInt( fp, ZTK_CACHE_VERSION, 4 ) ||
+      !_ZTKCacheFWriteUInt( fp, zListSize(&ztk->srclist), 4 ) ||
+      !_ZTKCacheFWriteUInt( fp, zListSize(&ztk->tflist), 4 ) ||
+      !_ZTKCacheFWriteTokenizer( fp, ZTKTokenizer(ztk) ) ) return false;
+  zListForEach( &ztk->srclist, sp )
+    src[i++] = &sp->data;
+  zListForEach( &ztk->srclist, sp )
+    if( !_ZTKCacheFWriteUInt( fp, sp->data.stamp.dev, 8 ) ||
+        !_ZTKCacheFWriteUInt( fp, sp->data.stamp.ino, 8 ) ||
+        !_ZTKCacheFWriteUInt( fp, sp->data.stamp.mtime, 8 ) ||
+        !_ZTKCacheFWriteUInt( fp, sp->data.stamp.mtime_nsec, 4 ) ||
+        !_ZTKCacheFWriteUInt( fp, sp->data.stamp.size, 8 ) ||
+        !_ZTKCacheFWriteUInt( fp, _ZTKCacheSrcIndex( src, i, sp->data.parent ), 4 ) ||
+        !_ZTKCacheFWriteUInt( fp, sp->data.shared ? 1 : 0, 1 ) ||
+        !_ZTKCacheFWriteStr( fp, sp->data.path ) ) return false;
+  zListForEach( &ztk->tflist, tp ){
+    if( tp->data.src != src_prev ) /* successive tagged fields are mostly from the same file */
+      id = _ZTKCacheSrcIndex( src, i, ( src_prev = tp->data.src ) );
+    if( !_ZTKCacheFWriteUInt( fp, id, 4 ) ||
+        !_ZTKCacheFWriteStr( fp, tp->data.tag ) ||
+        !_ZTKCacheFWriteUInt( fp, zListSize(&tp->data.kflist), 4 ) ) return false;
+    zListForEach( &tp->data.kflist, kp ){
+      if( !_ZTKCacheFWriteStr( fp, kp->data.key ) ||
+          !_ZTKCacheFWriteUInt( fp, ZTKValListSize(&kp->data.vallist), 4 ) ) return false;
+      for( j=0; j<ZTKValListSize(&kp->data.vallist); j++ )
+        if( !_ZTKCacheFWriteStr( fp, ZTKValListStr(&kp->data.vallist,j) ) ) return false;
+    }
+  }
+  return true;
+}
+
+/* replace a file with another. */
+static bool _ZTKCacheRename(const char *from, const char *to)
+{
+  if( rename( from, to ) == 0 ) return true;
+#ifdef __WINDOWS__
+  /* rename() of MS-Windows does not overwrite an existing file */
+  if( remove( to ) == 0 && rename( from, to ) == 0 ) return true;
+#endif /* __WINDOWS__ */
+  return false;
+}
+
+/* write a binary cache of a ZTK format processor.
+ * the cache is written to a temporary file in the same directory, and replaces the old one
+ * at once, so that a concurrent reader never sees a partially written cache. */
+static bool _ZTKWriteCache(ZTK *ztk, const char *path, bool quiet)
+{
+  FILE *fp;
+  ZTKSrc **src;
+  char tmppath[BUFSIZ];
+  bool ret;
+
+  if( strlen( path ) + 48 > BUFSIZ ){ /* room for the process ID and the address */
+    if( !quiet ) ZOPENERROR( path );
+    return false;
+  }
+  sprintf( tmppath, "%s.%lu.%lx.tmp", path, _ZTKPid(), (ulong)(size_t)ztk );
+  if( !( src = zAlloc( ZTKSrc*, zListSize(&ztk->srclist) + 1 ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  if( !( fp = fopen( tmppath, "wb" ) ) ){
+    if( !quiet ) ZOPENERROR( tmppath );
+    free( src );
+    return false;
+  }
+  ret = _ZTKCacheFWrite( fp, ztk, src );
+  free( src );
+  if( fclose( fp ) != 0 ) ret = false;
+  if( ret && !( ret = _ZTKCacheRename( tmppath, path ) ) && !quiet )
+    ZRUNERROR( ZEDA_ERR_ZTK_CACHE_UNREPLACEABLE, path );
+  if( !ret ) remove( tmppath ); /* never leave a broken cache */
+  return ret;
+}
+
+/* write a binary cache of a ZTK format processor. */
+bool ZTKWriteCache(ZTK *ztk, const char *path)
+{
+  return _ZTKWriteCache( ztk, path, false );
+}
+
+/* reader of a binary cache in memory. */
+typedef struct{
+  const ubyte *cur;
+  const ubyte *end;
+} _ZTKCacheReader;
+
+/* read an unsigned integer from a binary cache. */
+static bool _ZTKCacheReadUInt(_ZTKCacheReader *reader, int size, ulong *val)
+{
+  int i;
+
+  if( reader->end - reader->cur < size ) return false;
+  for( *val=0, i=size-1; i>=0; i-- )
+    *val = ( *val << 8 ) | reader->cur[i];
+  reader->cur += size;
+  return true;
+}
+
+/* read a string from a binary cache. */
+static bool _ZTKCacheReadStr(_ZTKCacheReader *reader, const char **str, size_t *len)
+{
+  ulong l;
+
+  if( !_ZTKCacheReadUInt( reader, 4, &l ) || (ulong)( reader->end - reader->cur ) < l ) return false;
+  *str = (const char *)reader->cur;
+  reader->cur += ( *len = l );
+  return true;
+}
+
+/* check if tokenizer settings stored in a binary cache are the same with the given ones. */
+static bool _ZTKCacheReadTokenizer(_ZTKCacheReader *reader, const zTokenizerConfig *tokenizer, bool *equal)
+{
+  zTokenizerConfig stored;
+  ulong c[4];
+  int i;
+
+  if( reader->end - reader->cur < (long)sizeof(stored.char_class) ) return false;
+  memcpy( stored.char_class, reader->cur, sizeof(stored.char_class) );
+  reader->cur += sizeof(stored.char_class);
+  for( i=0; i<4; i++ )
+    if( !_ZTKCacheReadUInt( reader, 1, &c[i] ) ) return false;
+  stored.comment_ident = (char)c[0];
+  stored.tag_begin_ident = (char)c[1];
+  stored.tag_end_ident = (char)c[2];
+  stored.key_ident = (char)c[3];
+  *equal = _ZTKTokenizerIsEqual( &stored, tokenizer );
+  return true;
+}
+
+/* scan a binary cache in memory, and build a tag-and-key list from it if required.
+ * in validation (src is null), a stale cache is rejected unless raw is true. */
+static bool _ZTKCacheScan(ZTK *ztk, _ZTKCacheReader *reader, ZTKSrc **src, ulong *parent, bool raw, bool *stale)
+{
+  ulong srcnum, tagnum, keynum, valnum, id, shared, i, j, k;
+  zFileStamp stamp;
+  ZTKSrcListCell *sp;
+  char pathbuf[BUFSIZ];
+  const char *str;
+  size_t len;
+  bool equal;
+
+  if( reader->end - reader->cur < 4 || memcmp( reader->cur, ZTK_CACHE_ID, 4 ) != 0 ) return false;
+  reader->cur += 4;
+  if( !_ZTKCacheReadUInt( reader, 4, &i ) || i != ZTK_CACHE_VERSION ||
+      !_ZTKCacheReadUInt( reader, 4, &srcnum ) ||
+      !_ZTKCacheReadUInt( reader, 4, &tagnum ) ||
+      !_ZTKCacheReadTokenizer( reader, ZTKTokenizer(ztk), &equal ) ) return false;
+  if( !src && !equal ){ /* scanned with different tokenizer settings */
+    *stale = true;
+    if( !raw ) return false;
+  }
+  for( i=0; i<srcnum; i++ ){
+    if( !_ZTKCacheReadUInt( reader, 8, &stamp.dev ) ||
+        !_ZTKCacheReadUInt( reader, 8, &stamp.ino ) ||
+        !_ZTKCacheReadUInt( reader, 8, &stamp.mtime ) ||
+        !_ZTKCacheReadUInt( reader, 4, &stamp.mtime_nsec ) ||
+        !_ZTKCacheReadUInt( reader, 8, &stamp.size ) ||
+        !_ZTKCacheReadUInt( reader, 4, &id ) || ( id != ZTK_CACHE_NOSRC && id >= srcnum ) ||
+        !_ZTKCacheReadUInt( reader, 1, &shared ) ||
+        !_ZTKCacheReadStr( reader, &str, &len ) || len >= BUFSIZ ) return false;
+    memcpy( pathbuf, str, len );
+    pathbuf[len] = '\0';
+    if( src ){
+      if( !( sp = _ZTKSrcListAdd( &ztk->srclist, pathbuf, &stamp ) ) ) return false;
+      src[i] = &sp->data;
+      parent[i] = id; /* resolved after all source files are read */
+      sp->data.shared = shared ? true : false;
+    } else
+    if( !*stale && _ZTKSrcIsModified( pathbuf, &stamp ) ){
+      *stale = true;
+      if( !raw ) return false;
+    }
+  }
+  if( src )
+    for( i=0; i<srcnum; i++ )
+      src[i]->parent = parent[i] == ZTK_CACHE_NOSRC ? NULL : src[parent[i]];
+  for( i=0; i<tagnum; i++ ){
+    if( !_ZTKCacheReadUInt( reader, 4, &id ) || ( id != ZTK_CACHE_NOSRC && id >= srcnum ) ) return false;
+    if( src ) ztk->src_cp = id == ZTK_CACHE_NOSRC ? NULL : src[id];
+    if( !_ZTKCacheReadStr( reader, &str, &len ) ||
+        ( src && !_ZTKAddTag( ztk, str, len ) ) ||
+        !_ZTKCacheReadUInt( reader, 4, &keynum ) ) return false;
+    for( j=0; j<keynum; j++ ){
+      if( !_ZTKCacheReadStr( reader, &str, &len ) ||
+          ( src && !_ZTKAddKey( ztk, str, len ) ) ||
+          !_ZTKCacheReadUInt( reader, 4, &valnum ) ) return false;
+      for( k=0; k<valnum; k++ )
+        if( !_ZTKCacheReadStr( reader, &str, &len ) ||
+            ( src && !_ZTKAddVal( ztk, str, len ) ) ) return false;
+    }
+  }
+  return reader->cur == reader->end;
+}
+
+/* build a tag-and-key list of a ZTK format processor from a validated binary cache. */
+static bool _ZTKCacheBuild(ZTK *ztk, _ZTKCacheReader *reader)
+{
+  _ZTKCacheReader header;
+  ZTKTagFieldListCell *cp;
+  ZTKSrc **src, *sp;
+  ulong srcnum = 0, *parent;
+  bool ret = false;
+
+  header.cur = reader->cur + 8; /* skip the identifier and the version */
+  header.end = reader->end;
+  _ZTKCacheReadUInt( &header, 4, &srcnum );
+  src = zAlloc( ZTKSrc*, srcnum + 1 );
+  parent = zAlloc( ulong, srcnum + 1 );
+  if( !src || !parent ){
+    ZALLOCERROR();
+  } else{
+    cp = zListHead( &ztk->tflist );
+    ret = _ZTKCacheScan( ztk, reader, src, parent, false, NULL );
+    ztk->src_cp = NULL;
+    /* ranges of tagged fields of source files */
+    for( cp=zListCellNext(cp); cp!=zListRoot(&ztk->tflist); cp=zListCellNext(cp) )
+      for( sp=cp->data.src; sp; sp=sp->parent )
+        if( sp->num++ == 0 ) sp->head = cp;
+  }
+  free( src );
+  free( parent );
+  return ret;
+}
+
+/* read a binary cache into a ZTK format processor. */
+static bool _ZTKReadCache(ZTK *ztk, const char *path, bool raw, bool *stale)
+{
+  FILE *fp;
+  char *buf;
+  size_t size;
+  _ZTKCacheReader reader;
+  bool ret = false;
+
+  if( !( fp = fopen( path, "rb" ) ) ) return false;
+  buf = _ZTKFileRead( fp, &size );
+  fclose( fp );
+  if( !buf ) return false;
+  reader.cur = (ubyte *)buf;
+  reader.end = reader.cur + size;
+  if( _ZTKCacheScan( ztk, &reader, NULL, NULL, raw, stale ) ){ /* validate the whole image in advance */
+    reader.cur = (ubyte *)buf;
+    _ZTKStatsParseBegin( ztk );
+    ret = _ZTKCacheBuild( ztk, &reader );
+    _ZTKStatsParseEnd( ztk );
+  } else
+  if( !*stale )
+    ZRUNWARN( ZEDA_WARN_ZTK_CACHE_BROKEN, path );
+  free( buf );
+  return ret;
+}
+
+/* read a binary cache into a ZTK format processor. */
+bool ZTKReadCache(ZTK *ztk, const char *path)
+{
+  bool stale = false;
+
+  return _ZTKReadCache( ztk, path, false, &stale );
 }
 
-/* add a new tag to a ZTK format processor. */
-bool ZTKAddTag(ZTK *ztk, const char *tag)
+/* read a binary cache into a ZTK format processor even if it is stale. */
+bool ZTKReadCacheRaw(ZTK *ztk, const char *path, bool *stale)
 {
-  if( !( ztk->tf_cp = ZTKTagFieldListNew( tag ) ) ) /* allocate a new tagged field */
-    return false;
-  zListInsertHead( &ztk->tflist, ztk->tf_cp );
-  ztk->kf_cp = NULL; /* unactivate the key field */
-  return true;
+  bool stale_dummy = false;
+
+  if( !stale ) stale = &stale_dummy;
+  *stale = false;
+  return _ZTKReadCache( ztk, path, true, stale );
 }
 
-/* add a new key to the current tag field of a ZTK format processor. */
-bool ZTKAddKey(ZTK *ztk, const char *key)
+/* count the number of tagged fields with a specified tag in a tag-and-key list of a ZTK format processor. */
+int ZTKCountTag(ZTK *ztk, const char *tag)
 {
-  return ( ztk->kf_cp = ZTKKeyFieldListNew( &ztk->tf_cp->data.kflist, key ) ) ? true : false;
+  ZTKIndexEntry *entry;
+
+  return ( entry = _ZTKIndexFind( &ztk->tagindex, tag, zStrHash( tag ) ) ) ? entry->num : 0;
 }
 
-/* delete a key at the head of the current tag field of a ZTK format processor. */
-void ZTKDelKey(ZTK *ztk)
+/* count the number of key fields with a specified key of the current tagged field in a tag-and-key list of a ZTK format processor. */
+int ZTKCountKey(ZTK *ztk, const char *key)
 {
-  ZTKKeyFieldListHeadDestroy( &ztk->tf_cp->data.kflist );
-  ztk->kf_cp = zListIsEmpty( &ztk->tf_cp->data.kflist ) ? NULL : zListHead( &ztk->tf_cp->data.kflist );
+  ZTKIndexEntry *entry;
+
+  if( !ztk->tf_cp ) return 0;
+  return ( entry = _ZTKIndexFind( &ztk->tf_cp->data.keyindex, key, zStrHash( key ) ) ) ? entry->num : 0;
 }
 
-/* add a new value to the current key field of a ZTK format processor. */
-bool ZTKAddVal(ZTK *ztk, const char *val)
+/* move to a tagged field with values in a chain of tagged fields with the same tag. */
+static ZTKTagFieldListCell *_ZTKFindTag(ZTK *ztk, ZTKTagField *tf)
 {
-  return ZTKKeyFieldAddVal( &ztk->kf_cp->data, val ) ? true : false;
+  ZTKTagFieldListCell *tp;
+  ZTKKeyFieldListCell *kp;
+  const char *vp;
+  int vid;
+
+  for( tp=ztk->tf_cp, kp=ztk->kf_cp, vp=ztk->val_cp, vid=ztk->val_id; tf; tf=tf->sibling ){
+    ztk->tf_cp = _ZTKFieldCell( tf, ZTKTagFieldListCell );
+    if( ZTKKeyRewind( ztk ) ) return ztk->tf_cp;
+  }
+  ztk->tf_cp = tp;
+  ztk->kf_cp = kp;
+  ztk->val_cp = vp;
+  ztk->val_id = vid;
+  return NULL;
 }
 
-/* add a new integer value to the current key field of a ZTK format processor. */
-bool ZTKAddInt(ZTK *ztk, const int val)
+/* find a tagged field with a specified tag in a tag-and-key list of a ZTK format processor. */
+ZTKTagFieldListCell *ZTKFindTag(ZTK *ztk, const char *tag)
 {
-  char buf[BUFSIZ];
-  sprintf( buf, "%d", val );
-  return ZTKAddVal( ztk, buf );
+  ZTKIndexEntry *entry;
+
+  return ( entry = _ZTKIndexFind( &ztk->tagindex, tag, zStrHash( tag ) ) ) ? _ZTKFindTag( ztk, (ZTKTagField *)entry->head ) : NULL;
 }
 
-/* add a new double-precision floating-point value value to the current key field of a ZTK format processor. */
-bool ZTKAddDouble(ZTK *ztk, const double val)
+/* find the next tagged field with the same tag with the current one in a tag-and-key list of a ZTK format processor. */
+ZTKTagFieldListCell *ZTKFindNextTag(ZTK *ztk)
 {
-  char buf[BUFSIZ];
-  sprintf( buf, "%.10g", val );
-  return ZTKAddVal( ztk, buf );
+  return ztk->tf_cp ? _ZTKFindTag( ztk, ztk->tf_cp->data.sibling ) : NULL;
 }
 
-/* internally scan and parse a file into a tag-and-key list of a ZTK format processor. */
-static bool _ZTKParse(ZTK *ztk, const char *path)
+/* move to a key field with values in a chain of key fields with the same key. */
+static ZTKKeyFieldListCell *_ZTKFindKey(ZTK *ztk, ZTKKeyField *kf)
 {
-  bool ret = true;
-  zFileStack *fs;
+  ZTKKeyFieldListCell *cp;
+  const char *vp;
+  int vid;
 
-  if( !( fs = zFileStackPush( &ztk->fs, path ) ) ) return false;
-  ret = ZTKParseFP( ztk, fs->fp );
-  zFileStackPop( &ztk->fs );
-  return ret;
+  for( cp=ztk->kf_cp, vp=ztk->val_cp, vid=ztk->val_id; kf; kf=kf->sibling ){
+    ztk->kf_cp = _ZTKFieldCell( kf, ZTKKeyFieldListCell );
+    if( ZTKValRewind( ztk ) ) return ztk->kf_cp;
+  }
+  ztk->kf_cp = cp;
+  ztk->val_cp = vp;
+  ztk->val_id = vid;
+  return NULL;
 }
 
-/* scan and parse a file stream into a tag-and-key list of a ZTK format processor. */
-bool ZTKParseFP(ZTK *ztk, FILE *fp)
+/* find a key field with a specified key in the current tagged field of a ZTK format processor. */
+ZTKKeyFieldListCell *ZTKFindKey(ZTK *ztk, const char *key)
 {
-  char buf[BUFSIZ];
-  bool ret = true;
+  ZTKIndexEntry *entry;
 
-  while( !feof( fp ) ){
-    if( !zFToken( fp, buf, BUFSIZ ) ) break;
-    if( zStrIsTag( buf ) ){
-      zExtractTag( buf, buf );
-      if( !ZTKAddTag( ztk, buf ) ){
-        ret = false;
-        break;
-      }
-    } else{ /* might be a key or a value */
-      if( strcmp( buf, "include" ) == 0 ){ /* include a file */
-        _ZTKParse( ztk, zFToken(fp,buf,BUFSIZ) );
-        continue;
-      }
-      if( !ztk->tf_cp )
-        if( !ZTKAddTag( ztk, "" ) ) continue; /* tagged field unactivated. */
-      if( zFPostCheckKey( fp ) ){ /* token is a key. */
-        if( !ZTKAddKey( ztk, buf ) ){
-          ret = false;
-          break;
-        }
-      } else{
-        if( !ztk->kf_cp ){ /* add and activate a null key field */
-          if( !ZTKAddKey( ztk, "" ) ){
-            ret = false;
-            break;
-          }
-        }
-        if( !ZTKAddVal( ztk, buf ) ){ /* token is a value. */
-          ret = false;
-          break;
-        }
-      }
-    }
-  }
-  return ret;
+  if( !ztk->tf_cp ) return NULL;
+  return ( entry = _ZTKIndexFind( &ztk->tf_cp->data.keyindex, key, zStrHash( key ) ) ) ? _ZTKFindKey( ztk, (ZTKKeyField *)entry->head ) : NULL;
 }
 
-/* scan and parse a file into a tag-and-key list of a ZTK format processor. */
-bool ZTKParse(ZTK *ztk, const char *path)
+/* find the next key field with the same key with the current one in the current tagged field of a ZTK format processor. */
+ZTKKeyFieldListCell *ZTKFindNextKey(ZTK *ztk)
 {
-  ZTKInit( ztk );
-  return _ZTKParse( ztk, path );
+  return ztk->kf_cp ? _ZTKFindKey( ztk, ztk->kf_cp->data.sibling ) : NULL;
 }
 
-/* count the number of tagged fields with a specified tag in a tag-and-key list of a ZTK format processor. */
-int ZTKCountTag(ZTK *ztk, const char *tag)
+/* look up the first tagged field with a specified tag without moving the current field. */
+ZTKTagField *ZTKFindTagField(const ZTK *ztk, const char *tag)
 {
-  ZTKTagFieldListCell *cp;
-  int count = 0;
+  ZTKIndexEntry *entry;
 
-  zListForEach( &ztk->tflist, cp )
-    if( strcmp( cp->data.tag, tag ) == 0 ) count++;
-  return count;
+  return ( entry = _ZTKIndexFind( &ztk->tagindex, tag, zStrHash( tag ) ) ) ? (ZTKTagField *)entry->head : NULL;
 }
 
-/* count the number of key fields with a specified key of the current tagged field in a tag-and-key list of a ZTK format processor. */
-int ZTKCountKey(ZTK *ztk, const char *key)
+/* look up the first key field with a specified key in a tagged field without moving the current field. */
+ZTKKeyField *ZTKFindKeyField(const ZTKTagField *tf, const char *key)
 {
-  ZTKKeyFieldListCell *cp;
-  int count = 0;
+  ZTKIndexEntry *entry;
 
-  if( !ztk->tf_cp ) return 0;
-  zListForEach( &ztk->tf_cp->data.kflist, cp )
-    if( strcmp( cp->data.key, key ) == 0 ) count++;
-  return count;
+  return ( entry = _ZTKIndexFind( &tf->keyindex, key, zStrHash( key ) ) ) ? (ZTKKeyField *)entry->head : NULL;
 }
 
 /* move to the next value string in the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
-zStrListCell *ZTKValNext(ZTK *ztk)
+const char *ZTKValNext(ZTK *ztk)
 {
-  if( !ztk->kf_cp ) return ztk->val_cp = NULL;
-  do{
-    if( ztk->val_cp == zListHead(&ztk->kf_cp->data.vallist) ) return ztk->val_cp = NULL;
-    ztk->val_cp = zListCellNext(ztk->val_cp);
-  } while( !ztk->val_cp->data );
-  return ztk->val_cp;
+  if( !ztk->kf_cp || ztk->val_id + 1 >= ZTKValListSize(&ztk->kf_cp->data.vallist) )
+    return ztk->val_cp = NULL;
+  return ztk->val_cp = ZTKValListStr( &ztk->kf_cp->data.vallist, ++ztk->val_id );
 }
 
 /* rewind the list of value strings of the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
-zStrListCell *ZTKValRewind(ZTK *ztk)
+const char *ZTKValRewind(ZTK *ztk)
 {
-  if( !ztk->kf_cp ) return ztk->val_cp = NULL;
-  ztk->val_cp = zListRoot(&ztk->kf_cp->data.vallist);
+  ztk->val_id = -1; /* incremented to zero at the first value */
   return ZTKValNext( ztk );
 }
 
@@ -398,11 +2519,9 @@ ZTKTagFieldListCell *ZTKTagRewind(ZTK *ztk)
 int ZTKInt(ZTK *ztk)
 {
   int retval;
-  char buf[BUFSIZ];
 
   if( !ZTKValPtr(ztk) ) return 0;
-  strncpy( buf, ZTKVal(ztk), BUFSIZ-1 );
-  zSInt( buf, &retval );
+  zNumParseInt( ZTKVal(ztk), strlen(ZTKVal(ztk)), &retval );
   ZTKValNext( ztk );
   return retval;
 }
@@ -411,19 +2530,279 @@ int ZTKInt(ZTK *ztk)
 double ZTKDouble(ZTK *ztk)
 {
   double retval;
-  char buf[BUFSIZ];
 
   if( !ZTKValPtr(ztk) ) return 0;
-  strncpy( buf, ZTKVal(ztk), BUFSIZ-1 );
-  zSDouble( buf, &retval );
+  zNumParseDouble( ZTKVal(ztk), strlen(ZTKVal(ztk)), &retval );
   ZTKValNext( ztk );
   return retval;
 }
 
+/* the number of values remained in the block of numeric values of the current key field. */
+static int _ZTKNumBlockRemain(ZTK *ztk, int n)
+{
+  ZTKNumBlock *block;
+
+  block = ztk->kf_cp->data.numblock;
+  return _zMin( n, block->size - ztk->val_id );
+}
+
+/* retrieve integer values from the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
+int ZTKIntN(ZTK *ztk, int *val, int n)
+{
+  ZTKNumBlock *block;
+  int i;
+
+  if( ZTKValPtr(ztk) && ( block = ztk->kf_cp->data.numblock ) && block->isint ){
+    n = _ZTKNumBlockRemain( ztk, n );
+    for( i=0; i<n; i++ ){
+      val[i] = (int)block->val[ztk->val_id];
+      ZTKValNext( ztk );
+    }
+    return n;
+  }
+  for( i=0; i<n && ZTKValPtr(ztk); i++ )
+    val[i] = ZTKInt( ztk );
+  return i;
+}
+
+/* retrieve real values from the current key field of the current tagged field in a tag-and-key list of a ZTK format processor. */
+int ZTKDoubleN(ZTK *ztk, double *val, int n)
+{
+  ZTKNumBlock *block;
+  int i;
+
+  if( ZTKValPtr(ztk) && ( block = ztk->kf_cp->data.numblock ) ){
+    n = _ZTKNumBlockRemain( ztk, n );
+    memcpy( val, block->val + ztk->val_id, sizeof(double)*n );
+    for( i=0; i<n; i++ ) ZTKValNext( ztk );
+    return n;
+  }
+  for( i=0; i<n && ZTKValPtr(ztk); i++ )
+    val[i] = ZTKDouble( ztk );
+  return i;
+}
+
+/* ********************************************************** */
+/* buffered writer of ZTK format.
+ *//* ******************************************************* */
+
+#define ZTK_WRITER_BLOCKSIZE 0x10000
+
+/* a writer which writes contents directly to the destination file stream without rollback. */
+#define _ZTKWriterIsDirect(writer) ( (writer)->fp == (writer)->out )
+
+/* open a buffered writer of ZTK format to a file stream or a file descriptor. */
+static ZTKWriter *_ZTKWriterOpen(ZTKWriter *writer, FILE *out, int fd)
+{
+  writer->out = out;
+  writer->fd = fd;
+  writer->buf = NULL;
+  writer->size = 0;
+  writer->mark = 0;
+#ifdef __ZTK_WRITER_MEMSTREAM
+  return ( writer->fp = open_memstream( &writer->buf, &writer->size ) ) ? writer : NULL;
+#else
+  return ( writer->fp = tmpfile() ) ? writer : NULL;
+#endif /* __ZTK_WRITER_MEMSTREAM */
+}
+
+/* open a buffered writer of ZTK format to a file stream, or let it write directly to the
+ * file stream if failing. */
+static void _ZTKWriterOpenFPrint(ZTKWriter *writer, FILE *fp)
+{
+  if( !_ZTKWriterOpen( writer, fp, -1 ) ) writer->fp = fp;
+}
+
+/* open a buffered writer of ZTK format to a file stream. */
+ZTKWriter *ZTKWriterOpen(ZTKWriter *writer, FILE *fp)
+{
+  if( _ZTKWriterOpen( writer, fp, -1 ) ) return writer;
+  ZALLOCERROR();
+  return NULL;
+}
+
+/* open a buffered writer of ZTK format to a file descriptor. */
+ZTKWriter *ZTKWriterOpenFD(ZTKWriter *writer, int fd)
+{
+  if( _ZTKWriterOpen( writer, NULL, fd ) ) return writer;
+  ZALLOCERROR();
+  return NULL;
+}
+
+/* output a block of formatted contents to the destination of a buffered writer. */
+static bool _ZTKWriterOutput(ZTKWriter *writer, const char *buf, size_t size)
+{
+  long n;
+
+  if( writer->out ) return fwrite( buf, 1, size, writer->out ) == size;
+  for( ; size>0; buf+=n, size-=n )
+    if( ( n = _ZTKWriteFD( writer->fd, buf, size ) ) <= 0 ) return false;
+  return true;
+}
+
+/* flush formatted contents of a buffered writer of ZTK format. */
+bool ZTKWriterFlush(ZTKWriter *writer)
+{
+  long size;
+  bool ret = true;
+#ifndef __ZTK_WRITER_MEMSTREAM
+  char buf[BUFSIZ];
+  size_t n;
+#endif /* __ZTK_WRITER_MEMSTREAM */
+
+  if( _ZTKWriterIsDirect( writer ) ) return fflush( writer->fp ) == 0;
+  if( fflush( writer->fp ) != 0 || ( size = ftell( writer->fp ) ) < 0 ) return false;
+#ifdef __ZTK_WRITER_MEMSTREAM
+  ret = _ZTKWriterOutput( writer, writer->buf, size );
+#else
+  rewind( writer->fp );
+  for( ; size>0; size-=n )
+    if( ( n = fread( buf, 1, _zMin( size, BUFSIZ ), writer->fp ) ) == 0 ||
+        !_ZTKWriterOutput( writer, buf, n ) ){
+      ret = false;
+      break;
+    }
+#endif /* __ZTK_WRITER_MEMSTREAM */
+  rewind( writer->fp );
+  writer->mark = 0;
+  return ret;
+}
+
+/* close a buffered writer of ZTK format. */
+bool ZTKWriterClose(ZTKWriter *writer)
+{
+  bool ret;
+
+  ret = ZTKWriterFlush( writer );
+  if( !_ZTKWriterIsDirect( writer ) ) fclose( writer->fp );
+  free( writer->buf );
+  writer->fp = NULL;
+  writer->buf = NULL;
+  return ret;
+}
+
+/* set a point of a buffered writer of ZTK format to roll back. */
+bool ZTKWriterMark(ZTKWriter *writer)
+{
+  long pos;
+
+  if( _ZTKWriterIsDirect( writer ) ) return !ferror( writer->fp );
+  if( ( pos = ftell( writer->fp ) ) < 0 ) return false;
+  if( pos >= ZTK_WRITER_BLOCKSIZE ) return ZTKWriterFlush( writer );
+  writer->mark = pos;
+  return true;
+}
+
+/* roll back a buffered writer of ZTK format to the marked point. */
+void ZTKWriterRollback(ZTKWriter *writer)
+{
+  if( !_ZTKWriterIsDirect( writer ) )
+    fseek( writer->fp, writer->mark, SEEK_SET );
+}
+
+/* write ZTK to a buffered writer. */
+bool ZTKWrite(ZTKWriter *writer, ZTK *ztk)
+{
+  ZTKTagFieldListCell *cp;
+
+  zListForEach( &ztk->tflist, cp ){
+    ZTKTagFieldFPrint( ZTKWriterFP(writer), &cp->data );
+    if( !ZTKWriterMark( writer ) ) return false;
+  }
+  return true;
+}
+
 /* print out ZTK to a file. */
 void ZTKFPrint(FILE *fp, ZTK *ztk)
 {
-  ZTKTagFieldListFPrint( fp, &ztk->tflist );
+  ZTKWriter writer;
+
+  _ZTKWriterOpenFPrint( &writer, fp );
+  ZTKWrite( &writer, ztk );
+  ZTKWriterClose( &writer );
+}
+
+/* ********************************************************** */
+/* statistics of ZTK format processor.
+ *//* ******************************************************* */
+
+/* bytes of a hash table of a hash index. */
+#define _ZTKIndexTableSize(index) ( sizeof(ZTKIndexEntry) * (index)->capacity )
+
+/* statistics of a ZTK format processor. */
+ZTKStats *ZTKGetStats(ZTK *ztk, ZTKStats *stats)
+{
+  ZTKTagFieldListCell *tp;
+  ZTKKeyFieldListCell *kp;
+  ZTKSrcListCell *sp;
+  ZTKSrc *src;
+  uint i;
+  int depth;
+#ifdef __ZEDA_USE_ZTK_STATS
+  _ZTKStatsTimer *timer;
+#endif /* __ZEDA_USE_ZTK_STATS */
+
+  stats->tagnum = stats->keynum = stats->valnum = 0;
+  stats->strsize = 0;
+  stats->listsize = _ZTKIndexTableSize( &ztk->tagindex ) + _ZTKIndexTableSize( &ztk->strpool );
+  for( i=0; i<ztk->strpool.capacity; i++ ) /* tags and keys are interned */
+    if( ztk->strpool.entry[i].str )
+      stats->strsize += strlen( ztk->strpool.entry[i].str ) + 1;
+  zListForEach( &ztk->tflist, tp ){
+    stats->tagnum++;
+    stats->listsize += sizeof(ZTKTagFieldListCell) + _ZTKIndexTableSize( &tp->data.keyindex );
+    zListForEach( &tp->data.kflist, kp ){
+      stats->keynum++;
+      stats->valnum += ZTKValListSize( &kp->data.vallist );
+      stats->strsize += kp->data.vallist.len;
+      stats->listsize += sizeof(ZTKKeyFieldListCell) + sizeof(uint) * kp->data.vallist.capacity + kp->data.vallist.bufsize - kp->data.vallist.len;
+      if( kp->data.numblock )
+        stats->listsize += sizeof(ZTKNumBlock) + sizeof(double) * kp->data.numblock->capacity;
+    }
+  }
+  stats->srcnum = zListSize( &ztk->srclist );
+  stats->incdepth = 0;
+  zListForEach( &ztk->srclist, sp ){
+    stats->listsize += sizeof(ZTKSrcListCell) + strlen( sp->data.path ) + 1;
+    for( depth=0, src=sp->data.parent; src; src=src->parent, depth++ );
+    if( depth > stats->incdepth ) stats->incdepth = depth;
+  }
+  stats->t_parse = stats->t_token = stats->t_alloc = 0;
+  stats->prpnum = 0;
+  stats->prp = NULL;
+#ifdef __ZEDA_USE_ZTK_STATS
+  if( ( timer = (_ZTKStatsTimer *)ztk->stats ) ){
+    stats->t_parse = timer->t_parse;
+    stats->t_alloc = timer->t_alloc;
+    stats->t_token = timer->t_parse > timer->t_alloc ? timer->t_parse - timer->t_alloc : 0;
+    stats->prpnum = timer->prpnum;
+    stats->prp = timer->prp;
+  }
+#endif /* __ZEDA_USE_ZTK_STATS */
+  return stats;
+}
+
+/* reset accumulated timings of a ZTK format processor. */
+void ZTKResetStats(ZTK *ztk)
+{
+  _ZTKStatsTimerDestroy( ztk );
+}
+
+/* print out statistics of a ZTK format processor. */
+void ZTKStatsFPrint(FILE *fp, const ZTKStats *stats)
+{
+  int i;
+
+  fprintf( fp, "tags          : %ld\n", stats->tagnum );
+  fprintf( fp, "keys          : %ld\n", stats->keynum );
+  fprintf( fp, "values        : %ld\n", stats->valnum );
+  fprintf( fp, "string bytes  : %lu\n", (unsigned long)stats->strsize );
+  fprintf( fp, "list bytes    : %lu\n", (unsigned long)stats->listsize );
+  fprintf( fp, "source files  : %d (include depth %d)\n", stats->srcnum, stats->incdepth );
+  if( stats->t_parse > 0 )
+    fprintf( fp, "parse time    : %g sec. (tokenizing %g sec., allocation %g sec.)\n", stats->t_parse, stats->t_token, stats->t_alloc );
+  for( i=0; i<stats->prpnum; i++ )
+    fprintf( fp, "eval %s: %ld calls, %g sec.\n", stats->prp[i].str, stats->prp[i].count, stats->prp[i].time );
 }
 
 /* ********************************************************** */
@@ -472,10 +2851,35 @@ bool ZTKPrpSetNum(ZTKPrp *prp, size_t prpnum, const char *str, int num)
   return false;
 }
 
-/* evaluate a key field of a ZTK format processor based on a ZTK property. */
-void *ZTKEvalKey(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum)
+/* find a ZTK property with a specified string and an evaluation function. */
+static int _ZTKPrpFind(const ZTKPrp prp[], size_t prpnum, const char *str)
+{
+  uint i;
+
+  for( i=0; i<prpnum; i++ ) /* properties interned by ZTKPrpIntern() */
+    if( prp[i].str == str && prp[i]._eval ) return i;
+  for( i=0; i<prpnum; i++ )
+    if( strcmp( prp[i].str, str ) == 0 && prp[i]._eval ) return i;
+  return -1;
+}
+
+/* intern strings of an array of ZTKPrp in a ZTK format processor. */
+bool ZTKPrpIntern(ZTK *ztk, ZTKPrp prp[], size_t prpnum)
 {
+  const char *str;
   uint i;
+
+  for( i=0; i<prpnum; i++ ){
+    if( !( str = ZTKIntern( ztk, prp[i].str ) ) ) return false;
+    prp[i].str = str;
+  }
+  return true;
+}
+
+/* evaluate a key field of a ZTK format processor based on a ZTK property (with a compiled table, if given). */
+static void *_ZTKEvalKeyPrp(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum, const ZTKPrpTable *table)
+{
+  int i;
   int *count;
 
   if( !ZTKKeyRewind( ztk ) ) return NULL;
@@ -484,55 +2888,167 @@ void *ZTKEvalKey(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpn
     return NULL;
   }
   do{
-    for( i=0; i<prpnum; i++ )
-      if( ZTKKeyCmp( ztk, prp[i].str ) && prp[i]._eval ){
-        if( prp[i].num > 0 && count[i] >= prp[i].num ){
-          ZRUNWARN( ZEDA_WARN_ZTK_TOOMANY_KEYS, prp[i].str );
-        } else{
-          if( !prp[i]._eval( obj, count[i]++, arg, ztk ) ){
-            ZECHO( "error while evaluating key: %s", prp[i].str );
-            obj = NULL;
-            goto TERMINATE;
-          }
-        }
+    if( ( i = table ? ZTKPrpTableFind( table, ZTKKey(ztk) ) : _ZTKPrpFind( prp, prpnum, ZTKKey(ztk) ) ) < 0 )
+      continue;
+    if( prp[i].num > 0 && count[i] >= prp[i].num ){
+      ZRUNWARN( ZEDA_WARN_ZTK_TOOMANY_KEYS, prp[i].str );
+    } else{
+      if( !_ZTKPrpEval( &prp[i], obj, count[i]++, arg, ztk ) ){
+        ZECHO( "error while evaluating key: %s", prp[i].str );
+        obj = NULL;
         break;
       }
+    }
   } while( ZTKKeyNext(ztk) );
- TERMINATE:
   free( count );
   return obj;
 }
 
-/* print out a key field of a ZTK format processor based on a ZTK property. */
-void ZTKPrpKeyFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum)
+/* evaluate a key field of a ZTK format processor based on a ZTK property. */
+void *ZTKEvalKey(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum)
+{
+  return _ZTKEvalKeyPrp( obj, arg, ztk, prp, prpnum, NULL );
+}
+
+/* write a key field of a ZTK format processor to a buffered writer based on a ZTK property. */
+bool ZTKPrpKeyWrite(ZTKWriter *writer, void *obj, const ZTKPrp prp[], size_t prpnum)
 {
   uint i;
-  int j, k;
-  fpos_t pos;
+  int j;
 
   for( i=0; i<prpnum; i++ )
     if( prp[i]._fprint )
       for( j=0; j<prp[i].num; j++ ){
-        if( fp != stdout && fp != stderr )
-          fgetpos( fp, &pos );
-        fprintf( fp, "%s: ", prp[i].str );
-        if( !prp[i]._fprint( fp, j, obj ) ){
-          if( fp != stdout && fp != stderr )
-            fsetpos( fp, &pos );
-          else{
-            for( k=strlen(prp[i].str)+2; k>0; k-- )
-              fputc( '\b', fp );
-            fprintf( fp, "\033[0K" );
-          }
-        }
+        if( !ZTKWriterMark( writer ) ) return false;
+        fprintf( ZTKWriterFP(writer), "%s: ", prp[i].str );
+        if( !prp[i]._fprint( ZTKWriterFP(writer), j, obj ) )
+          ZTKWriterRollback( writer ); /* discard the key */
       }
+  return true;
 }
 
-/* evaluate a tag field of a ZTK format processor based on a ZTK property. */
-void *ZTKEvalTag(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum)
+/* print out a key field of a ZTK format processor based on a ZTK property. */
+void ZTKPrpKeyFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum)
+{
+  ZTKWriter writer;
+
+  _ZTKWriterOpenFPrint( &writer, fp );
+  ZTKPrpKeyWrite( &writer, obj, prp, prpnum );
+  ZTKWriterClose( &writer );
+}
+
+/* a job to evaluate tagged fields with the same tag in parallel. */
+typedef struct{
+  const ZTKPrp *prp;
+  void *obj;
+  void *arg;
+  ZTK *ztk;
+  ZTKTagFieldListCell **tf; /* tagged fields to be evaluated */
+  int num;                  /* number of tagged fields */
+  int next;                 /* index of the next tagged field to be evaluated */
+  bool ok;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_t mutex;
+#endif /* __ZEDA_USE_PTHREAD */
+} _ZTKEvalTagJob;
+
+#ifdef __ZEDA_USE_PTHREAD
+#define _ZTKEvalTagJobLock(job)   pthread_mutex_lock( &(job)->mutex )
+#define _ZTKEvalTagJobUnlock(job) pthread_mutex_unlock( &(job)->mutex )
+#else
+#define _ZTKEvalTagJobLock(job)
+#define _ZTKEvalTagJobUnlock(job)
+#endif /* __ZEDA_USE_PTHREAD */
+
+/* a worker that evaluates tagged fields of a job one after another. */
+static void *_ZTKEvalTagWorker(void *arg)
+{
+  _ZTKEvalTagJob *job;
+  ZTK *ztk;
+  int i;
+
+  job = (_ZTKEvalTagJob *)arg;
+  /* each worker has its own cursor of the tag-and-key list */
+  if( !( ztk = zAlloc( ZTK, 1 ) ) ){
+    ZALLOCERROR();
+    _ZTKEvalTagJobLock( job );
+    job->ok = false;
+    _ZTKEvalTagJobUnlock( job );
+    return NULL;
+  }
+  memcpy( (void *)ztk, job->ztk, sizeof(ZTK) );
+  while( 1 ){
+    _ZTKEvalTagJobLock( job );
+    i = job->ok ? job->next++ : job->num;
+    _ZTKEvalTagJobUnlock( job );
+    if( i >= job->num ) break;
+    ztk->tf_cp = job->tf[i];
+    ZTKKeyRewind( ztk );
+    if( !_ZTKPrpEval( job->prp, job->obj, i, job->arg, ztk ) ){
+      _ZTKEvalTagJobLock( job );
+      job->ok = false;
+      _ZTKEvalTagJobUnlock( job );
+    }
+  }
+  free( ztk );
+  return NULL;
+}
+
+/* evaluate the current tagged field and the following ones with the same tag in parallel. */
+static bool _ZTKEvalTagFanOut(void *obj, void *arg, ZTK *ztk, const ZTKPrp *prp, int num, int threadnum)
+{
+  _ZTKEvalTagJob job;
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_t *thread;
+  int i;
+#endif /* __ZEDA_USE_PTHREAD */
+
+  if( !( job.tf = zAlloc( ZTKTagFieldListCell*, num ) ) ){
+    ZALLOCERROR();
+    return false;
+  }
+  /* tagged fields are listed in order of appearance, which gives deterministic indices */
+  job.num = 0;
+  do{
+    if( prp->num > 0 && job.num >= prp->num ){
+      ZRUNWARN( ZEDA_WARN_ZTK_TOOMANY_TAGS, prp->str );
+    } else
+      job.tf[job.num++] = ztk->tf_cp;
+  } while( ZTKFindNextTag(ztk) );
+  job.prp = prp;
+  job.obj = obj;
+  job.arg = arg;
+  job.ztk = ztk;
+  job.next = 0;
+  job.ok = true;
+  _ZTKStatsTimerGet( ztk ); /* shared by copies of the processor in workers */
+#ifdef __ZEDA_USE_PTHREAD
+  pthread_mutex_init( &job.mutex, NULL );
+  if( threadnum > job.num ) threadnum = job.num;
+  /* the current thread also works as one of workers */
+  if( threadnum > 1 && ( thread = zAlloc( pthread_t, threadnum-1 ) ) ){
+    for( i=0; i<threadnum-1; i++ )
+      if( pthread_create( &thread[i], NULL, _ZTKEvalTagWorker, &job ) != 0 ) break;
+    _ZTKEvalTagWorker( &job );
+    while( --i >= 0 ) /* join all workers */
+      pthread_join( thread[i], NULL );
+    free( thread );
+  } else
+    _ZTKEvalTagWorker( &job );
+  pthread_mutex_destroy( &job.mutex );
+#else
+  _ZTKEvalTagWorker( &job );
+#endif /* __ZEDA_USE_PTHREAD */
+  free( job.tf );
+  return job.ok;
+}
+
+/* evaluate a tag field of a ZTK format processor based on a ZTK property (with hash values of tags, if given). */
+static void *_ZTKEvalTagPrp(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum, const ulong *hash, int threadnum)
 {
   uint i;
   int *count;
+  ZTKIndexEntry *entry;
 
   if( !ZTKTagRewind( ztk ) ) return NULL;
   if( !( count = zAlloc( int, prpnum ) ) ){
@@ -540,28 +3056,49 @@ void *ZTKEvalTag(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpn
     return NULL;
   }
   for( i=0; i<prpnum; i++ ){
-    ZTKTagRewind( ztk );
-    if( prp[i]._eval ) do{
-      if( ZTKTagCmp( ztk, prp[i].str ) ){
-        if( prp[i].num > 0 && count[i] >= prp[i].num ){
-          ZRUNWARN( ZEDA_WARN_ZTK_TOOMANY_TAGS, prp[i].str );
-        } else{
-          if( !prp[i]._eval( obj, count[i]++, arg, ztk ) ){
-            ZECHO( "error while evaluating tag [%s]", prp[i].str );
-            obj = NULL;
-            goto TERMINATE;
-          }
+    if( !prp[i]._eval ) continue;
+    /* visit tagged fields with the tag in order of appearance via the hash index */
+    if( !( entry = _ZTKIndexFind( &ztk->tagindex, prp[i].str, hash ? hash[i] : zStrHash( prp[i].str ) ) ) ||
+        !_ZTKFindTag( ztk, (ZTKTagField *)entry->head ) ) continue;
+    if( prp[i].parallel && threadnum > 1 ){
+      if( !_ZTKEvalTagFanOut( obj, arg, ztk, &prp[i], entry->num, threadnum ) ){
+        ZECHO( "error while evaluating tag [%s]", prp[i].str );
+        obj = NULL;
+        goto TERMINATE;
+      }
+      continue;
+    }
+    do{
+      if( prp[i].num > 0 && count[i] >= prp[i].num ){
+        ZRUNWARN( ZEDA_WARN_ZTK_TOOMANY_TAGS, prp[i].str );
+      } else{
+        if( !_ZTKPrpEval( &prp[i], obj, count[i]++, arg, ztk ) ){
+          ZECHO( "error while evaluating tag [%s]", prp[i].str );
+          obj = NULL;
+          goto TERMINATE;
         }
       }
-    } while( ZTKTagNext(ztk) );
+    } while( ZTKFindNextTag(ztk) );
   }
  TERMINATE:
   free( count );
   return obj;
 }
 
-/* print out a tag field of a ZTK format processor based on a ZTK property. */
-void ZTKPrpTagFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum)
+/* evaluate a tag field of a ZTK format processor based on a ZTK property. */
+void *ZTKEvalTag(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum)
+{
+  return _ZTKEvalTagPrp( obj, arg, ztk, prp, prpnum, NULL, 0 );
+}
+
+/* evaluate a tag field of a ZTK format processor based on a ZTK property in parallel. */
+void *ZTKEvalTagParallel(void *obj, void *arg, ZTK *ztk, const ZTKPrp prp[], size_t prpnum, int threadnum)
+{
+  return _ZTKEvalTagPrp( obj, arg, ztk, prp, prpnum, NULL, threadnum );
+}
+
+/* write a tag field of a ZTK format processor to a buffered writer based on a ZTK property. */
+bool ZTKPrpTagWrite(ZTKWriter *writer, void *obj, const ZTKPrp prp[], size_t prpnum)
 {
   uint i;
   int j;
@@ -569,8 +3106,115 @@ void ZTKPrpTagFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum)
   for( i=0; i<prpnum; i++ )
     if( prp[i]._fprint ){
       for( j=0; j<prp[i].num; j++ ){
-        fprintf( fp, "[%s]\n", prp[i].str );
-        prp[i]._fprint( fp, j, obj );
+        fprintf( ZTKWriterFP(writer), "[%s]\n", prp[i].str );
+        prp[i]._fprint( ZTKWriterFP(writer), j, obj );
+        if( !ZTKWriterMark( writer ) ) return false;
       }
     }
+  return true;
+}
+
+/* print out a tag field of a ZTK format processor based on a ZTK property. */
+void ZTKPrpTagFPrint(FILE *fp, void *obj, const ZTKPrp prp[], size_t prpnum)
+{
+  ZTKWriter writer;
+
+  _ZTKWriterOpenFPrint( &writer, fp );
+  ZTKPrpTagWrite( &writer, obj, prp, prpnum );
+  ZTKWriterClose( &writer );
+}
+
+/* ********************************************************** */
+/* compiled table of ZTK properties
+ * ********************************************************** */
+
+/* find a ZTK property in a compiled table with a string with a hash value. */
+static int _ZTKPrpTableFind(const ZTKPrpTable *table, const char *str, ulong hash)
+{
+  uint i, mask;
+
+  if( table->capacity == 0 ) return -1;
+  mask = table->capacity - 1;
+  for( i=hash&mask; table->slot[i]>=0; i=(i+1)&mask )
+    if( table->hash[table->slot[i]] == hash && strcmp( table->prp[table->slot[i]].str, str ) == 0 )
+      return table->slot[i];
+  return -1;
+}
+
+/* build a hash table of ZTK properties; fails at a collision unless probing is allowed. */
+static bool _ZTKPrpTableBuild(ZTKPrpTable *table, bool probe)
+{
+  uint i, j, mask;
+
+  for( j=0; j<table->capacity; j++ ) table->slot[j] = -1;
+  mask = table->capacity - 1;
+  for( i=0; i<table->prpnum; i++ ){
+    if( !table->prp[i]._eval || _ZTKPrpTableFind( table, table->prp[i].str, table->hash[i] ) >= 0 )
+      continue; /* the first property with an evaluation function precedes */
+    for( j=table->hash[i]&mask; table->slot[j]>=0; j=(j+1)&mask )
+      if( !probe ) return false;
+    table->slot[j] = i;
+  }
+  return true;
+}
+
+/* the largest ratio of the number of slots to the number of properties for a perfect hash. */
+#define ZTK_PRPTABLE_MAX_RATIO 16
+
+/* compile a table of ZTK properties. */
+ZTKPrpTable *ZTKPrpTableCompile(ZTKPrpTable *table, const ZTKPrp prp[], size_t prpnum)
+{
+  uint i, capacity;
+
+  table->prp = prp;
+  table->prpnum = prpnum;
+  table->capacity = 0;
+  table->slot = NULL;
+  if( !( table->hash = zAlloc( ulong, prpnum ) ) && prpnum > 0 ){
+    ZALLOCERROR();
+    return NULL;
+  }
+  for( i=0; i<prpnum; i++ )
+    table->hash[i] = zStrHash( prp[i].str );
+  for( capacity=ZTK_INDEX_INIT_CAPACITY; capacity<prpnum*2; capacity*=2 );
+  for( ; ; capacity*=2 ){
+    zFree( table->slot );
+    if( !( table->slot = zAlloc( int, capacity ) ) ){
+      ZALLOCERROR();
+      ZTKPrpTableDestroy( table );
+      return NULL;
+    }
+    table->capacity = capacity;
+    /* enlarge the table until no collision happens, and fall back to linear probing otherwise */
+    if( _ZTKPrpTableBuild( table, capacity >= prpnum*ZTK_PRPTABLE_MAX_RATIO ? true : false ) ) break;
+  }
+  return table;
+}
+
+/* destroy a compiled table of ZTK properties. */
+void ZTKPrpTableDestroy(ZTKPrpTable *table)
+{
+  zFree( table->hash );
+  zFree( table->slot );
+  table->capacity = 0;
+  table->prp = NULL;
+  table->prpnum = 0;
+}
+
+/* find a ZTK property associated with a string in a compiled table. */
+int ZTKPrpTableFind(const ZTKPrpTable *table, const char *str)
+{
+  return _ZTKPrpTableFind( table, str, zStrHash( str ) );
+}
+
+/* evaluate a key field of a ZTK format processor based on a compiled table of ZTK properties. */
+void *ZTKEvalKeyTable(void *obj, void *arg, ZTK *ztk, const ZTKPrpTable *table)
+{
+  return _ZTKEvalKeyPrp( obj, arg, ztk, table->prp, table->prpnum, table );
+}
+
+/* evaluate a tag field of a ZTK format processor based on a compiled table of ZTK properties. */
+void *ZTKEvalTagTable(void *obj, void *arg, ZTK *ztk, const ZTKPrpTable *table)
+{
+  return _ZTKEvalTagPrp( obj, arg, ztk, table->prp, table->prpnum, table->hash, 0 );
 }
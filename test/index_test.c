@@ -1,4 +1,5 @@
 #include <zeda/zeda.h>
+#include <limits.h>
 
 void assert_clone(void)
 {
@@ -177,6 +178,39 @@ void assert_index_shuffle(void)
   zAssert( zIndexShuffle, result );
 }
 
+/* a random integer over the whole range, composed of two 16-bit halves
+ * so that zRandI() never computes max - min + 1 beyond INT_MAX */
+int rand_int(void)
+{
+  return zRandI(-(INT_MAX>>16),INT_MAX>>16) * 0x10000 + zRandI(0,0xffff);
+}
+
+void assert_index_fprint(void)
+{
+  zIndex index, index_scan;
+  FILE *fp;
+  char buf[BUFSIZ];
+  int i, n = 2000;
+  bool result_data = true;
+
+  index = zIndexCreate( n );
+  for( i=0; i<n; i++ )
+    zIndexSetElem( index, i, rand_int() );
+  zIndexSetElem( index, 0, INT_MIN );
+  if( !( fp = tmpfile() ) ) return;
+  zIndexDataFPrint( fp, index );
+  zIndexFPrint( fp, index );
+  rewind( fp );
+  for( i=0; i<n; i++ )
+    if( fscanf( fp, "%s", buf ) != 1 || atoi( buf ) != zIndexElemNC(index,i) ) result_data = false;
+  index_scan = zIndexFScan( fp );
+  fclose( fp );
+  zAssert( zIndexDataFPrint, result_data );
+  zAssert( zIndexFPrint + zIndexFScan, zIndexEqual( index, index_scan ) );
+  zIndexFree( index );
+  zIndexFree( index_scan );
+}
+
 int main(void)
 {
   zRandInit();
@@ -189,5 +223,6 @@ int main(void)
   assert_index_remove_and_insert_test();
   assert_index_sort();
   assert_index_shuffle();
+  assert_index_fprint();
   return EXIT_SUCCESS;
 }
@@ -68,6 +68,37 @@ void assert_clone(void)
   free( dest );
 }
 
+void assert_arena(void)
+{
+  zArena arena;
+  char *str[BUFSIZ];
+  double *large;
+  int i, j, blocknum = 0;
+  bool result_align = true, result_zero = true, result_str = true;
+  zArenaBlock *block;
+
+  zArenaInit( &arena, 256 );
+  for( i=0; i<BUFSIZ; i++ ){
+    str[i] = zArenaAlloc( &arena, zRandI( 1, 64 ) );
+    if( (size_t)str[i] % sizeof(double) != 0 ) result_align = false;
+    if( str[i][0] != 0 ) result_zero = false;
+    sprintf( str[i], "%d", i );
+  }
+  large = zArenaAllocType( &arena, double, 1000 );
+  for( j=0; j<1000; j++ )
+    if( large[j] != 0 ) result_zero = false;
+  for( i=0; i<BUFSIZ; i++ )
+    if( atoi( str[i] ) != i ) result_str = false;
+  if( strcmp( zArenaStrCloneN( &arena, "abcdefg", 3 ), "abc" ) != 0 ) result_str = false;
+  for( block=arena.block; block; block=block->prev ) blocknum++;
+  zArenaDestroy( &arena );
+  zAssert( zArenaAlloc (alignment), result_align );
+  zAssert( zArenaAlloc (zero-cleared), result_zero );
+  zAssert( zArenaAlloc (isolation), result_str );
+  zAssert( zArenaAlloc (number of blocks), blocknum > 1 && blocknum < BUFSIZ / 4 );
+  zAssert( zArenaDestroy, arena.block == NULL );
+}
+
 void assert_filecompare(void)
 {
   const char *filename1 = "filecomp_test_1.txt";
@@ -286,6 +317,7 @@ int main(void)
   assert_maxmin();
   assert_swap();
   assert_clone();
+  assert_arena();
   assert_filesize();
   assert_file_ident();
   assert_filecompare();
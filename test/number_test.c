@@ -0,0 +1,256 @@
+#include <zeda/zeda_number.h>
+#include <zeda/zeda_rand.h>
+#include <limits.h>
+#include <math.h>
+
+#define N 100000
+
+/* check if a string is parsed to the identical value with strtod() */
+bool check_double(const char *str)
+{
+  double val, ans;
+  char *ep;
+  size_t n;
+
+  n = zNumParseDouble( str, strlen(str), &val );
+  ans = strtod( str, &ep );
+  if( n != (size_t)( ep - str ) ) return false;
+  if( ans != ans ) return val != val;
+  return memcmp( &val, &ans, sizeof(double) ) == 0;
+}
+
+/* a random double-precision floating-point value of random bits */
+double rand_bits(void)
+{
+  uint64_t w;
+  double val;
+
+  do{
+    w = (uint64_t)zRandI(0,0xffff) << 48 | (uint64_t)zRandI(0,0xffff) << 32 | (uint64_t)zRandI(0,0xffff) << 16 | (uint64_t)zRandI(0,0xffff);
+    memcpy( &val, &w, sizeof(double) );
+  } while( val != val || val - val != 0 );
+  return val;
+}
+
+void assert_parse_double_rand(void)
+{
+  char buf[BUFSIZ];
+  int i, j, n;
+  bool result_bits = true, result_digits = true, result_short = true;
+
+  for( i=0; i<N; i++ ){
+    sprintf( buf, "%.17g", rand_bits() );
+    if( !check_double( buf ) ){
+      eprintf( "%s\n", buf );
+      result_bits = false;
+    }
+    sprintf( buf, "%.*g", zRandI(1,16), rand_bits() );
+    if( !check_double( buf ) ){
+      eprintf( "%s\n", buf );
+      result_short = false;
+    }
+    /* random significant digits with a random exponent */
+    n = zRandI(1,40);
+    for( j=0; j<n; j++ ) buf[j] = '0' + zRandI(0,9);
+    if( n > 1 ) buf[zRandI(0,n-1)] = '.';
+    sprintf( buf+n, "e%d", zRandI(-360,330) );
+    if( !check_double( buf ) ){
+      eprintf( "%s\n", buf );
+      result_digits = false;
+    }
+  }
+  zAssert( zNumParseDouble (random bits), result_bits );
+  zAssert( zNumParseDouble (random short digits), result_short );
+  zAssert( zNumParseDouble (random long digits), result_digits );
+}
+
+void assert_parse_double_hard(void)
+{
+  const char *str[] = {
+    "0", "-0", "0.0e10", "1", "-1", "  \t+3.14", ".5", "5.", "1e23", "8.98846567431158e307",
+    "9007199254740993", "9007199254740992.5", "1.7976931348623157e308", "1.7976931348623159e308", "1e309", "-1e400",
+    "2.2250738585072011e-308", "2.2250738585072014e-308", "4.9406564584124654e-324", "2.4703282292062327e-324",
+    "2.4703282292062328e-324", "1e-400", "123456789012345678901234567890", "0.1000000000000000055511151231257827",
+    "0.10000000000000000555111512312578270211815834045410156250001", "7.2057594037927933e16",
+    "1.00000000000000011102230246251565404236316680908203125", "1.00000000000000011102230246251565404236316680908203124",
+    "00000000000000000000000000000000001.5", "0.000000000000000000000000000000000000000000012345e40",
+    "1e", "1e+", "1e-x", "2.5E3z", "12abc", "inf", "-Infinity", "INFx", "nan", "-NaN", "nan(123)", "nan(", "0x1.8p1", "-0x10",
+    "0x", "0x.", "1e100000000000", "1e-100000000000", NULL,
+  };
+  const char **sp;
+  bool result = true;
+
+  for( sp=str; *sp; sp++ )
+    if( !check_double( *sp ) ){
+      eprintf( "%s\n", *sp );
+      result = false;
+    }
+  zAssert( zNumParseDouble (hard cases), result );
+}
+
+void assert_parse_double_invalid(void)
+{
+  const char *str[] = { "", " ", "+", "-", ".", "-.", "e5", "x", "in", "na", NULL };
+  const char **sp;
+  double val;
+  bool result = true;
+
+  for( sp=str; *sp; sp++ )
+    if( zNumParseDouble( *sp, strlen(*sp), &val ) != 0 || val != 0 ) result = false;
+  zAssert( zNumParseDouble (invalid string), result );
+}
+
+void assert_parse_double_len(void)
+{
+  const char *str = "12.5e+3 6";
+  double val;
+
+  zAssert( zNumParseDouble (bounded length),
+    zNumParseDouble( str, 2, &val ) == 2 && val == 12 &&
+    zNumParseDouble( str, 4, &val ) == 4 && val == 12.5 &&
+    zNumParseDouble( str, 6, &val ) == 4 && val == 12.5 &&
+    zNumParseDouble( str, 7, &val ) == 7 && val == 12500 &&
+    zNumParseDouble( str+7, 2, &val ) == 2 && val == 6 &&
+    zNumParseDouble( str, 0, &val ) == 0 && val == 0 );
+}
+
+void assert_parse_int(void)
+{
+  const char *str[] = { "0", "-0", "  42", "+7x", "-2147483648", "2147483647", "-123456", "12.5", NULL };
+  const char **sp;
+  char *ep;
+  int val;
+  bool result = true;
+
+  for( sp=str; *sp; sp++ )
+    if( zNumParseInt( *sp, strlen(*sp), &val ) != (size_t)( strtol( *sp, &ep, 10 ), ep - *sp ) || val != (int)strtol( *sp, NULL, 10 ) ){
+      eprintf( "%s\n", *sp );
+      result = false;
+    }
+  zAssert( zNumParseInt, result );
+  zAssert( zNumParseInt (saturation),
+    zNumParseInt( "2147483648", 10, &val ) == 10 && val == INT_MAX &&
+    zNumParseInt( "-99999999999999999999", 21, &val ) == 21 && val == INT_MIN &&
+    zNumParseInt( "9999999999", 10, &val ) == 10 && val == INT_MAX &&
+    zNumParseInt( "4294967296", 10, &val ) == 10 && val == INT_MAX &&
+    zNumParseInt( "-2147483649", 11, &val ) == 11 && val == INT_MIN &&
+    zNumParseInt( "123", 2, &val ) == 2 && val == 12 &&
+    zNumParseInt( "-x", 2, &val ) == 0 && val == 0 );
+}
+
+/* number of significant digits of a formatted value */
+int digit_num(const char *str)
+{
+  int n = 0;
+  bool nonzero = false;
+
+  for( ; *str && *str != 'e'; str++ )
+    if( *str >= '1' && *str <= '9' ) nonzero = true, n++;
+    else if( *str == '0' && nonzero ) n++;
+  for( str--; *str == '0' || *str == '.'; str-- )
+    if( *str == '0' ) n--;
+  return n;
+}
+
+/* check if a value is formatted to the shortest digits which are read back to the value */
+bool check_format_double(double val)
+{
+  char buf[ZEDA_NUM_DOUBLE_BUFSIZ], ans[BUFSIZ];
+  double v;
+  int n;
+
+  if( zNumFormatDouble( val, buf ) != strlen( buf ) ) return false;
+  if( ( v = strtod( buf, NULL ) ) != val || ( val == 0 && memcmp( &v, &val, sizeof(double) ) != 0 ) ) return false;
+  for( n=1; n<17; n++ ){
+    sprintf( ans, "%.*g", n, val );
+    if( strtod( ans, NULL ) == val ) break;
+  }
+  return digit_num( buf ) == n;
+}
+
+void assert_format_double_rand(void)
+{
+  double val;
+  int i;
+  bool result = true;
+
+  for( i=0; i<N; i++ ){
+    if( !check_format_double( ( val = rand_bits() ) ) ){
+      eprintf( "%.17g\n", val );
+      result = false;
+    }
+  }
+  zAssert( zNumFormatDouble (random bits), result );
+}
+
+bool check_format_double_str(double val, const char *str)
+{
+  char buf[ZEDA_NUM_DOUBLE_BUFSIZ];
+
+  zNumFormatDouble( val, buf );
+  if( strcmp( buf, str ) == 0 ) return true;
+  eprintf( "%s (expected %s)\n", buf, str );
+  return false;
+}
+
+void assert_format_double(void)
+{
+  double zero = 0;
+
+  zAssert( zNumFormatDouble (notation),
+    check_format_double_str( 0, "0" ) && check_format_double_str( -zero, "-0" ) &&
+    check_format_double_str( 1, "1" ) && check_format_double_str( -2.5, "-2.5" ) &&
+    check_format_double_str( 0.1, "0.1" ) && check_format_double_str( 0.3, "0.3" ) &&
+    check_format_double_str( 0.1+0.2, "0.30000000000000004" ) && check_format_double_str( 1.0/3, "0.3333333333333333" ) &&
+    check_format_double_str( 12500, "12500" ) && check_format_double_str( 1e16, "10000000000000000" ) &&
+    check_format_double_str( 1e17, "1e+17" ) && check_format_double_str( 123456789012345678.0, "1.2345678901234568e+17" ) &&
+    check_format_double_str( 0.0001, "0.0001" ) && check_format_double_str( 0.00001234, "1.234e-05" ) &&
+    check_format_double_str( 1e23, "1e+23" ) && check_format_double_str( 5e-324, "5e-324" ) &&
+    check_format_double_str( 1.7976931348623157e308, "1.7976931348623157e+308" ) &&
+    check_format_double_str( 2.2250738585072014e-308, "2.2250738585072014e-308" ) &&
+    check_format_double_str( HUGE_VAL, "inf" ) && check_format_double_str( -HUGE_VAL, "-inf" ) &&
+    check_format_double_str( strtod( "nan", NULL ), "nan" ) );
+  zAssert( zNumFormatDouble (powers of two and ten),
+    check_format_double( ldexp( 1, -1074 ) ) && check_format_double( ldexp( 1, 1023 ) ) &&
+    check_format_double( ldexp( 1, 52 ) ) && check_format_double( ldexp( 1, 53 ) + 2 ) &&
+    check_format_double( 1e-300 ) && check_format_double( 1e300 ) && check_format_double( 9007199254740993.0 ) );
+}
+
+/* a random integer over the whole range, composed of two 16-bit halves
+ * so that zRandI() never computes max - min + 1 beyond INT_MAX */
+int rand_int(void)
+{
+  return zRandI(-(INT_MAX>>16),INT_MAX>>16) * 0x10000 + zRandI(0,0xffff);
+}
+
+void assert_format_int(void)
+{
+  int val[] = { 0, 1, -1, 9, 10, 99, 100, -12345, 1000000, INT_MAX, INT_MIN };
+  char buf[ZEDA_NUM_INT_BUFSIZ], ans[BUFSIZ];
+  int i;
+  bool result = true;
+
+  for( i=0; i<(int)( sizeof(val)/sizeof(int) ); i++ ){
+    sprintf( ans, "%d", val[i] );
+    if( zNumFormatInt( val[i], buf ) != strlen( ans ) || strcmp( buf, ans ) != 0 ) result = false;
+  }
+  for( i=0; i<N; i++ ){
+    sprintf( ans, "%d", ( val[0] = rand_int() ) );
+    if( zNumFormatInt( val[0], buf ) != strlen( ans ) || strcmp( buf, ans ) != 0 ) result = false;
+  }
+  zAssert( zNumFormatInt, result );
+}
+
+int main(void)
+{
+  zRandInit();
+  assert_parse_double_rand();
+  assert_parse_double_hard();
+  assert_parse_double_invalid();
+  assert_parse_double_len();
+  assert_parse_int();
+  assert_format_double_rand();
+  assert_format_double();
+  assert_format_int();
+  return EXIT_SUCCESS;
+}
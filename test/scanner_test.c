@@ -0,0 +1,153 @@
+#include <zeda/zeda.h>
+
+#define TEXT \
+  "%% comment\n" \
+  "  token1 \"quoted value\" 'single' [tag name]\n" \
+  "key \n\n    : 12.5e+3 1.5ex -7 'unterminated"
+
+#define LONG_TOKEN_SIZE 100
+
+FILE *open_text(const char *text)
+{
+  FILE *fp;
+
+  if( !( fp = tmpfile() ) ) return NULL;
+  fputs( text, fp );
+  rewind( fp );
+  return fp;
+}
+
+bool token_is(zScanner *scanner, const char *expected)
+{
+  return zScanToken( scanner ) && scanner->tknlen == strlen( expected ) && strncmp( scanner->tkn, expected, scanner->tknlen ) == 0;
+}
+
+bool assert_scanner_token_one(zScanner *scanner)
+{
+  return token_is( scanner, "token1" ) &&
+         token_is( scanner, "quoted value" ) &&
+         token_is( scanner, "single" ) &&
+         token_is( scanner, "[tag name]" ) && !zScanPostCheckKey( scanner ) &&
+         token_is( scanner, "key" ) && zScanPostCheckKey( scanner ) && strncmp( scanner->tkn, "key", 3 ) == 0 &&
+         token_is( scanner, "12.5e+3" ) && !zScanPostCheckKey( scanner ) &&
+         token_is( scanner, "1.5ex" ) &&
+         token_is( scanner, "-7" ) &&
+         token_is( scanner, "unterminated" ) &&
+         !token_is( scanner, "" ) && zScannerIsEnd( scanner );
+}
+
+void assert_scanner_token(void)
+{
+  zScanner scanner;
+  FILE *fp;
+  bool result_mem, result_fp, result_map;
+
+  result_mem = assert_scanner_token_one( zScannerInitMem( &scanner, TEXT, strlen(TEXT) ) );
+  zScannerDestroy( &scanner );
+  if( !( fp = open_text( TEXT ) ) ) return;
+  result_fp = zScannerInitFP( &scanner, fp, 4 ) && assert_scanner_token_one( &scanner );
+  zScannerDestroy( &scanner );
+  rewind( fp );
+  result_map = assert_scanner_token_one( zScannerMapFP( &scanner, fp ) );
+  zScannerDestroy( &scanner );
+  fclose( fp );
+  zAssert( zScanToken (memory buffer), result_mem );
+  zAssert( zScanToken (file stream), result_fp );
+  zAssert( zScanToken (mapped file), result_map );
+}
+
+void assert_scanner_long_token(void)
+{
+  zScanner scanner;
+  FILE *fp;
+  char text[LONG_TOKEN_SIZE+3], buf[LONG_TOKEN_SIZE+1];
+  bool result;
+
+  memset( text, 'a', LONG_TOKEN_SIZE );
+  strcpy( text + LONG_TOKEN_SIZE, " b" );
+  if( !( fp = open_text( text ) ) ) return;
+  result = zScannerInitFP( &scanner, fp, 4 ) &&
+    zScanToken( &scanner ) && scanner.tknlen == LONG_TOKEN_SIZE && strspn( scanner.tkn, "a" ) == LONG_TOKEN_SIZE &&
+    zScanTokenCopy( &scanner, buf, LONG_TOKEN_SIZE+1 ) && strcmp( buf, "b" ) == 0;
+  zScannerDestroy( &scanner );
+  fclose( fp );
+  zAssert( zScanToken (long token), result );
+}
+
+bool num_token_is(zScanner *scanner, const char *expected, int next)
+{
+  zScanNumToken( scanner );
+  return scanner->tknlen == strlen( expected ) && strncmp( scanner->tkn, expected, scanner->tknlen ) == 0 &&
+    zScannerPeek( scanner, 0 ) == next;
+}
+
+bool assert_scanner_num_token_one(zScanner *scanner)
+{
+  return num_token_is( scanner, "1.5", 'e' ) && zScannerPeek( scanner, 1 ) == 'x' &&
+         zScanSkipComment( scanner ) == 'e' && token_is( scanner, "ex" ) &&
+         zScanSkipDelimiter( scanner ) == '-' && num_token_is( scanner, "", '-' ) && token_is( scanner, "-x" ) &&
+         zScanSkipDelimiter( scanner ) == '+' && num_token_is( scanner, "+3.e-2", 'z' ) && token_is( scanner, "z" ) &&
+         zScanSkipDelimiter( scanner ) == '4' && num_token_is( scanner, "42", EOF ) && zScannerPeek( scanner, 0 ) == EOF;
+}
+
+void assert_scanner_num_token(void)
+{
+  const char *text = "1.5ex -x +3.e-2z 42";
+  zScanner scanner;
+  FILE *fp;
+  bool result_mem, result_fp, result_int;
+
+  result_mem = assert_scanner_num_token_one( zScannerInitMem( &scanner, text, strlen(text) ) );
+  result_int = zScannerInitMem( &scanner, text+1, strlen(text)-1 ) && !zScanIntToken( &scanner ) &&
+    zScannerPeek( &scanner, 0 ) == '.';
+  if( !( fp = open_text( text ) ) ) return;
+  result_fp = zScannerInitFP( &scanner, fp, 2 ) && assert_scanner_num_token_one( &scanner );
+  zScannerDestroy( &scanner );
+  fclose( fp );
+  zAssert( zScanNumToken (memory buffer), result_mem );
+  zAssert( zScanNumToken (file stream), result_fp );
+  zAssert( zScanIntToken, result_int );
+}
+
+void assert_scanner_destroy(void)
+{
+  zScanner scanner;
+  FILE *fp;
+  bool result_fp, result_map;
+
+  if( !( fp = open_text( "a b c" ) ) ) return;
+  result_fp = zScannerInitFP( &scanner, fp, 0 ) && token_is( &scanner, "a" ) && token_is( &scanner, "b" );
+  zScannerDestroy( &scanner );
+  result_fp = result_fp && fgetc( fp ) == ' ' && fgetc( fp ) == 'c';
+  rewind( fp );
+  fgetc( fp );
+  result_map = token_is( zScannerMapFP( &scanner, fp ), "b" );
+  zScannerDestroy( &scanner );
+  result_map = result_map && fgetc( fp ) == ' ' && fgetc( fp ) == 'c';
+  fclose( fp );
+  zAssert( zScannerDestroy (file stream), result_fp );
+  zAssert( zScannerDestroy (mapped file), result_map );
+}
+
+void assert_scanner_number(void)
+{
+  const char *text = "% integer and real numbers\n 3, -12 1.25e2";
+  zScanner scanner;
+  int i1, i2;
+  double d;
+
+  zScannerInitMem( &scanner, text, strlen(text) );
+  zAssert( zScanInt + zScanDouble,
+    zScanInt( &scanner, &i1 ) && zScanInt( &scanner, &i2 ) && zScanDouble( &scanner, &d ) && !zScanInt( &scanner, &i1 ) &&
+    i1 == 3 && i2 == -12 && d == 125 );
+}
+
+int main(void)
+{
+  assert_scanner_token();
+  assert_scanner_long_token();
+  assert_scanner_num_token();
+  assert_scanner_destroy();
+  assert_scanner_number();
+  return EXIT_SUCCESS;
+}
@@ -29,6 +29,11 @@ void assert_strmanip(void)
   strp = zStrClone( str1 );
   zAssert( zStrClone, strcmp( strp, str2 ) == 0 );
   free( strp );
+  zAssert( zStrHash,
+    zStrHash( "" ) == 0x811c9dc5UL && zStrHash( "a" ) == 0xe40c292cUL &&
+    zStrHash( str1 ) == zStrHash( str2 ) && zStrHash( "abcdefh" ) != zStrHash( str2 ) );
+  zAssert( zStrHashN,
+    zStrHashN( "abcdefgh", 7 ) == zStrHash( str1 ) && zStrHashN( "a", 0 ) == zStrHash( "" ) );
 
   zStrCopy( str2, "hijklmn", BUFSIZ );
   zStrCat( str1, str2, BUFSIZ );
@@ -63,6 +68,103 @@ void assert_sskipdelimiter(void)
   zAssert( zSSkipDelimiter (irregular case), *zSSkipDelimiter( string2 ) == '\0' );
 }
 
+/* check the table of classes of charactors against sets of charactors */
+bool assert_char_class_cmp(const char *delimiter, const char *operator)
+{
+  int c;
+
+  for( c=1; c<0x100; c++ )
+    if( ( zIsDelimiter( c ) != zIsIncludedChar( c, delimiter ) ) ||
+        ( zIsOperator( c ) != zIsIncludedChar( c, operator ) ) ) return false;
+  return !zIsDelimiter( '\0' ) && !zIsOperator( '\0' );
+}
+
+#define MEMSKIP_TEST_SIZE 1000
+
+/* check zMemSkipDelimiter() and zMemSkipToken() against simple loops on a random buffer */
+bool assert_memskip_cmp(const char *delimiter)
+{
+  char buf[MEMSKIP_TEST_SIZE];
+  const char *end, *cp, *cp_delim, *cp_token;
+  int i, n;
+
+  for( n=0; n<10; n++ ){
+    for( i=0; i<MEMSKIP_TEST_SIZE; i++ ) /* long runs of delimiters and tokens */
+      buf[i] = zRandI(0,9) < 8 && i > 0 ? buf[i-1] :
+        zRandI(0,1) ? delimiter[zRandI(0,strlen(delimiter)-1)] : (char)zRandI(0,0xff);
+    end = buf + zRandI(0,MEMSKIP_TEST_SIZE);
+    for( cp=buf; cp<end; cp++ ){
+      for( cp_delim=cp; cp_delim<end && zIsIncludedChar(*cp_delim,delimiter); cp_delim++ );
+      for( cp_token=cp; cp_token<end && *cp_token && !zIsIncludedChar(*cp_token,delimiter); cp_token++ );
+      if( zMemSkipDelimiter( cp, end ) != cp_delim || zMemSkipToken( cp, end ) != cp_token ) return false;
+    }
+  }
+  return true;
+}
+
+void assert_char_class(void)
+{
+  const char delimiter_default[] = { (char)EOF, '\t', '\v', '\f', '\n', '\r', ' ', ',', ';', ':', '|', '(', ')', '{', '}', '\0' };
+  const char operator_default[] = "!%&*+-/<=>?@\\^~";
+  const char *delimiter_custom = " \n#";
+  const char *delimiter_many = " \t\n\r,;:|(){}[]<>\"'"; /* more than 16 charactors */
+  const char *operator_custom = "+-";
+  bool result_default, result_custom, result_comment, result_reset, result_memskip;
+
+  zRandInit();
+  result_default = assert_char_class_cmp( delimiter_default, operator_default ) &&
+    ( zCharClass('%') & ZEDA_CHAR_COMMENT ) && !( zCharClass('#') & ZEDA_CHAR_COMMENT );
+  result_memskip = assert_memskip_cmp( delimiter_default );
+  zSetDelimiter( delimiter_custom );
+  zSetOperator( operator_custom );
+  result_custom = assert_char_class_cmp( delimiter_custom, operator_custom );
+  result_memskip = result_memskip && assert_memskip_cmp( delimiter_custom );
+  zSetDelimiter( delimiter_many );
+  result_custom = result_custom && assert_char_class_cmp( delimiter_many, operator_custom );
+  result_memskip = result_memskip && assert_memskip_cmp( delimiter_many );
+  zSetCommentIdent( '#' );
+  result_comment = ( zCharClass('#') & ZEDA_CHAR_COMMENT ) && !( zCharClass('%') & ZEDA_CHAR_COMMENT ) &&
+    zIsDelimiter( '#' ) == false;
+  zResetDelimiter();
+  zResetOperator();
+  zResetCommentIdent();
+  result_reset = assert_char_class_cmp( delimiter_default, operator_default ) && ( zCharClass('%') & ZEDA_CHAR_COMMENT );
+  zAssert( zIsDelimiter + zIsOperator (default sets), result_default );
+  zAssert( zSetDelimiter + zSetOperator, result_custom );
+  zAssert( zSetCommentIdent, result_comment );
+  zAssert( zResetDelimiter + zResetOperator + zResetCommentIdent, result_reset );
+  zAssert( zMemSkipDelimiter + zMemSkipToken, result_memskip );
+}
+
+void assert_tokenizer_config(void)
+{
+  zTokenizerConfig config, *prev;
+  char *str = "[a]#b c;d";
+  char buf[BUFSIZ], tkn[BUFSIZ];
+  bool result_init, result_select, result_restore, result_explicit;
+
+  zTokenizerConfigInit( &config );
+  result_init = memcmp( config.char_class, zTokenizerConfigCurrent()->char_class, 0x100 ) == 0 &&
+    config.comment_ident == ZDEFAULT_COMMENT_IDENT && config.key_ident == ZDEFAULT_KEY_IDENT &&
+    config.tag_begin_ident == ZDEFAULT_TAG_BEGIN_IDENT && config.tag_end_ident == ZDEFAULT_TAG_END_IDENT;
+  prev = zTokenizerConfigSelect( &config );
+  zSetDelimiter( "#" );
+  zSetTagIdent( '<', '>' );
+  result_select = zTokenizerConfigCurrent() == &config && zIsDelimiter( '#' ) && !zIsDelimiter( ' ' ) &&
+    strcmp( zSToken( strcpy( buf, str ), tkn, BUFSIZ ), "[a]" ) == 0 && !zStrIsTag( "[a]" );
+  zTokenizerConfigSelect( prev );
+  result_restore = zTokenizerConfigCurrent() == prev && !zIsDelimiter( '#' ) && zIsDelimiter( ' ' ) &&
+    zStrIsTag( "[a]" ) && zTagBeginIdent() == ZDEFAULT_TAG_BEGIN_IDENT;
+  result_explicit =
+    zTokenizerMemSkipToken( &config, str, str+strlen(str) ) == str + 3 &&
+    zTokenizerMemSkipToken( zTokenizerConfigCurrent(), str, str+strlen(str) ) == str + 5 &&
+    zTokenizerIsDelimiter( &config, '#' ) && !zTokenizerIsDelimiter( zTokenizerConfigCurrent(), '#' );
+  zAssert( zTokenizerConfigInit, result_init );
+  zAssert( zTokenizerConfigSelect, result_select );
+  zAssert( zTokenizerConfigSelect (restore), result_restore );
+  zAssert( zTokenizerMemSkipToken + zTokenizerIsDelimiter, result_explicit );
+}
+
 void assert_stris(void)
 {
   char buf[BUFSIZ];
@@ -326,18 +428,79 @@ void assert_pathname(void)
   zAssert( zCutSuffix, strcmp( str1, "path/test.dummy" ) == 0 );
 }
 
+/* search a pattern by a naive loop */
+const char *strsearch_naive(const char *text, size_t len, const char *pat, size_t lp)
+{
+  size_t i;
+
+  for( i=0; i+lp<=len; i++ )
+    if( memcmp( text+i, pat, lp ) == 0 ) return text + i;
+  return NULL;
+}
+
+#define STRSEARCH_TEST_SIZE 1000
+
+/* check zStrPatternSearch() against a naive loop on random buffers of a few charactors */
+bool assert_strpattern_cmp(void)
+{
+  char text[STRSEARCH_TEST_SIZE], pat[STRSEARCH_TEST_SIZE];
+  const char alphabet[] = { 'a', 'b', '\0', (char)0xff };
+  zStrPattern pattern;
+  size_t len, lp, i;
+  int n;
+  bool ret = true;
+
+  for( n=0; ret && n<1000; n++ ){
+    len = zRandI( 0, STRSEARCH_TEST_SIZE );
+    lp = zRandI( 0, n % 10 == 0 ? 100 : 6 );
+    for( i=0; i<len; i++ ) text[i] = alphabet[zRandI(0,3)];
+    for( i=0; i<lp; i++ ) pat[i] = alphabet[zRandI(0,3)];
+    if( lp > 0 && len > lp && zRandI(0,1) ) /* plant the pattern */
+      memcpy( text + zRandI( 0, len - lp ), pat, lp );
+    if( !zStrPatternCompile( &pattern, pat, lp ) ) return false;
+    ret = zStrPatternSearch( &pattern, text, len ) == strsearch_naive( text, len, pat, lp );
+    zStrPatternDestroy( &pattern );
+  }
+  return ret;
+}
+
 void assert_strsearch(void)
 {
   char *str = "abcdefgabcdefeabcedfg";
-
+  char *str_border[] = { "aabaaabaaac", "aabaabaaac", "aaabaabaaab" };
+  char *str_high = "abc\xe3\x81\x82\xe3\x81\x84\xe3\x81\x82xyz";
+  char str_long[1000], pat_long[400];
+  zStrPattern pattern;
+  bool result_pattern;
+
+  memset( str_long, 'a', 999 ); str_long[999] = '\0';
+  memset( pat_long, 'a', 399 ); pat_long[399] = '\0';
+  str_long[900] = 'b';
   zAssert( zStrSearchKMP,
     zStrSearchKMP( str, "def" ) == &str[3] &&
     zStrSearchKMP( str, "defe" ) == &str[10] &&
-    zStrSearchKMP( str, "gabd" ) == NULL );
+    zStrSearchKMP( str, "gabd" ) == NULL &&
+    zStrSearchKMP( str_border[0], "aabaaac" ) == str_border[0]+4 &&
+    zStrSearchKMP( str_border[1], "aabaaa" ) == str_border[1]+3 &&
+    zStrSearchKMP( str_border[2], "abaaab" ) == str_border[2]+5 &&
+    zStrSearchKMP( str_long, pat_long ) == str_long &&
+    zStrSearchKMP( str_long+501, pat_long ) == str_long+501 &&
+    zStrSearchKMP( str_long+502, pat_long ) == NULL );
   zAssert( zStrSearchBM,
     zStrSearchBM( str, "def" ) == &str[3] &&
     zStrSearchBM( str, "defe" ) == &str[10] &&
-    zStrSearchBM( str, "gabd" ) == NULL );
+    zStrSearchBM( str, "gabd" ) == NULL &&
+    zStrSearchBM( str_high, "\xe3\x81\x82x" ) == &str_high[9] &&
+    zStrSearchBM( str_long+501, pat_long ) == str_long+501 &&
+    zStrSearchBM( str_long+502, pat_long ) == NULL );
+  result_pattern = zStrPatternCompileStr( &pattern, "\xe3\x81\x82" ) &&
+    zStrPatternSearch( &pattern, str_high, strlen(str_high) ) == &str_high[3] &&
+    zStrPatternSearch( &pattern, str_high+4, strlen(str_high)-4 ) == &str_high[9] &&
+    zStrPatternSearch( &pattern, str_high, 11 ) == &str_high[3] &&
+    zStrPatternSearch( &pattern, str_high+4, 7 ) == NULL;
+  zStrPatternDestroy( &pattern );
+  zAssert( zStrPatternSearch, result_pattern );
+  zAssert( zStrPatternSearch (random case), assert_strpattern_cmp() );
 }
 
 int main(void)
@@ -345,6 +508,8 @@ int main(void)
   assert_strchr();
   assert_strmanip();
   assert_sskipdelimiter();
+  assert_char_class();
+  assert_tokenizer_config();
   assert_stris();
   assert_ftoken();
   assert_ftoken_newline();
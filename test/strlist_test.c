@@ -6,7 +6,7 @@ char *generate_string_one(int len)
   char *str;
 
   len = zRandI( 1, len );
-  if( !( str = (char*)malloc( sizeof(char)*len ) ) ) return NULL;
+  if( !( str = (char*)malloc( sizeof(char)*(len+1) ) ) ) return NULL;
   for( i=0; i<len; i++ ){
     str[i] = zRandI( '!', '~' );
   }
@@ -67,6 +67,130 @@ void assert_strlist_getptr(zStrList *list, char *sp[], int n)
   zAssert( zStrListGetPtr, !strcmp( str1, sp[0] ) && !strcmp( str2, sp[1] ) & !strcmp( str3, sp[2] ) );
 }
 
+#define MS_MATCH_MAX 10000
+
+/* occurrences of patterns */
+typedef struct{
+  int num;
+  int id[MS_MATCH_MAX];
+  size_t offset[MS_MATCH_MAX];
+  int stop; /* number of occurrences to stop the search */
+} ms_match_t;
+
+bool ms_match(void *arg, int id, size_t offset)
+{
+  ms_match_t *m;
+
+  m = (ms_match_t *)arg;
+  if( m->num < MS_MATCH_MAX ){
+    m->id[m->num] = id;
+    m->offset[m->num] = offset;
+  }
+  return ++m->num != m->stop;
+}
+
+ms_match_t *ms_match_init(ms_match_t *m, int stop)
+{
+  m->num = 0;
+  m->stop = stop;
+  return m;
+}
+
+bool ms_match_cmp(ms_match_t *m1, ms_match_t *m2)
+{
+  return m1->num == m2->num &&
+    memcmp( m1->id, m2->id, sizeof(int)*m1->num ) == 0 &&
+    memcmp( m1->offset, m2->offset, sizeof(size_t)*m1->num ) == 0;
+}
+
+void assert_strmultisearch_basic(void)
+{
+  const char *text = "ushers and his hers";
+  const int id_expected[] = { 1, 0, 3, 2, 0, 3 };
+  const size_t offset_expected[] = { 1, 2, 2, 11, 15, 15 };
+  zStrList list;
+  zStrMultiSearch ms;
+  ms_match_t m1, m2, m3;
+  zScanner scanner;
+  FILE *fp;
+  bool result, result_fp = false, result_scanner = false, result_stop;
+  int i;
+
+  zListInit( &list );
+  zStrListAdd( &list, "he" );
+  zStrListAdd( &list, "she" );
+  zStrListAdd( &list, "his" );
+  zStrListAdd( &list, "hers" );
+  zStrListAdd( &list, "" );
+  zStrMultiSearchCompile( &ms, &list );
+  result = zStrMultiSearchMem( &ms, text, strlen(text), ms_match, ms_match_init( &m1, -1 ) ) == 6 && m1.num == 6;
+  for( i=0; result && i<6; i++ )
+    if( m1.id[i] != id_expected[i] || m1.offset[i] != offset_expected[i] ) result = false;
+  if( ( fp = tmpfile() ) ){
+    fputs( text, fp );
+    rewind( fp );
+    zStrMultiSearchFP( &ms, fp, ms_match, ms_match_init( &m2, -1 ) );
+    result_fp = ms_match_cmp( &m1, &m2 );
+    rewind( fp );
+    /* a token scanned in advance is excluded */
+    zScannerInitFP( &scanner, fp, 4 );
+    zScanToken( &scanner );
+    zStrMultiSearchScanner( &ms, &scanner, ms_match, ms_match_init( &m3, -1 ) );
+    result_scanner = m3.num == 3 && m3.id[0] == 2 && m3.offset[0] == 5 && zScannerIsEnd( &scanner );
+    zScannerDestroy( &scanner );
+    fclose( fp );
+  }
+  zScannerInitMem( &scanner, text, strlen(text) );
+  result_stop = zStrMultiSearchScanner( &ms, &scanner, ms_match, ms_match_init( &m2, 2 ) ) == 2 &&
+    scanner.cur == text + 4 &&
+    zStrMultiSearchScanner( &ms, &scanner, NULL, NULL ) == 3;
+  zStrMultiSearchDestroy( &ms );
+  zStrListDestroy( &list );
+  zAssert( zStrMultiSearchMem, result );
+  zAssert( zStrMultiSearchFP, result_fp );
+  zAssert( zStrMultiSearchScanner, result_scanner );
+  zAssert( zStrMultiSearchScanner (stop), result_stop );
+}
+
+#define MS_TEXT_SIZE 1000
+#define MS_PAT_NUM     20
+
+/* check zStrMultiSearchMem() against a naive search with random patterns */
+void assert_strmultisearch_rand(void)
+{
+  const char alphabet[] = { 'a', 'b', 'c', (char)0xfe };
+  char text[MS_TEXT_SIZE], pat[MS_PAT_NUM][8];
+  zStrList list;
+  zStrMultiSearch ms;
+  ms_match_t m;
+  int n, i, j, k, count;
+  size_t len;
+  bool result = true;
+
+  for( n=0; result && n<100; n++ ){
+    zListInit( &list );
+    for( i=0; i<MS_PAT_NUM; i++ ){
+      len = zRandI( 1, 7 );
+      for( j=0; j<(int)len; j++ ) pat[i][j] = alphabet[zRandI(0,3)];
+      pat[i][len] = '\0';
+      zStrListAdd( &list, pat[i] );
+    }
+    for( i=0; i<MS_TEXT_SIZE; i++ ) text[i] = alphabet[zRandI(0,3)];
+    if( !zStrMultiSearchCompile( &ms, &list ) ) break;
+    zStrMultiSearchMem( &ms, text, MS_TEXT_SIZE, ms_match, ms_match_init( &m, -1 ) );
+    for( count=0, i=0; i<MS_PAT_NUM; i++ )
+      for( j=0; j+strlen(pat[i])<=MS_TEXT_SIZE; j++ )
+        if( memcmp( text+j, pat[i], strlen(pat[i]) ) == 0 ) count++;
+    if( m.num != count || m.num > MS_MATCH_MAX ) result = false;
+    for( k=0; result && k<m.num; k++ )
+      if( memcmp( text+m.offset[k], pat[m.id[k]], strlen(pat[m.id[k]]) ) != 0 ||
+          ( k > 0 && m.offset[k] + strlen(pat[m.id[k]]) < m.offset[k-1] + strlen(pat[m.id[k-1]]) ) ) result = false;
+    zStrMultiSearchDestroy( &ms );
+    zStrListDestroy( &list );
+  }
+  zAssert( zStrMultiSearchMem (random case), result );
+}
+
 #define N   100
 #define LEN  10
 
@@ -85,5 +209,7 @@ int main(void)
 
   zStrListDestroy( &list );
   destroy_strings( sp, N );
+  assert_strmultisearch_basic();
+  assert_strmultisearch_rand();
   return 0;
 }
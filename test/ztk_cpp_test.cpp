@@ -0,0 +1,59 @@
+#include <zeda/zeda_ztk.h>
+#include <string>
+
+void assert_ztk_val_to(void)
+{
+  int ival;
+  double dval;
+
+  zAssert( C++::ZTKValTo (integer), ZTKValTo( "-12", ival ) && ival == -12 && ZTKValTo( "+3", ival ) && ival == 3 );
+  zAssert( C++::ZTKValTo (real number), ZTKValTo( "1.5e-3", dval ) && dval == 1.5e-3 && ZTKValTo( "+2", dval ) && dval == 2 );
+  zAssert( C++::ZTKValTo (invalid case),
+    !ZTKValTo( "", ival ) && !ZTKValTo( "+", ival ) && !ZTKValTo( "1.5", ival ) && !ZTKValTo( "12ab", ival ) && !ZTKValTo( "x", dval ) );
+}
+
+void assert_ztk_range(void)
+{
+  const char *text =
+    "[a] id: 1 val: 1.5 -2 +3\n"
+    "[b] id: 2\n"
+    "[a] id:\n" /* no value */
+    "[c] id: 3 key: x\n"
+    "[a] key: y id: 4 key: zz\n";
+  ZTK ztk;
+  std::string image;
+  double val[4];
+  int id, n = 0;
+  bool result_tags = true, result_chain = true, result_cursor;
+
+  ztk.parseMem( text, strlen(text) );
+  ztk.findTag( "c" );
+  for( auto tf : ztk.tags() ){
+    image += std::string( tf.tag() ) + ":";
+    for( auto kf : tf.keys() ){
+      image += std::string( kf.key() ) + "=";
+      for( auto v : kf.vals() ) image += std::string( v ) + ",";
+    }
+    n++;
+  }
+  result_tags = n == 5 && image == "a:id=1,val=1.5,-2,+3,b:id=2,a:id=c:id=3,key=x,a:key=y,id=4,key=zz,";
+  n = 0;
+  for( auto tf : ztk.tags( "a" ) ){
+    for( auto kf : tf.keys( "id" ) )
+      if( !kf.vals().empty() && ( !ZTKValTo( kf.vals()[0], id ) || id != ( n == 0 ? 1 : 4 ) ) ) result_chain = false;
+    if( n == 0 && ( ( *tf.keys( "val" ).begin() ).getN( val, 4 ) != 3 || val[0] != 1.5 || val[1] != -2 || val[2] != 3 ) ) result_chain = false;
+    n++;
+  }
+  result_chain = result_chain && n == 3 && ztk.tags( "d" ).empty() && ( *ztk.tags( "c" ).begin() ).keys( "none" ).empty();
+  result_cursor = ztk.cmpTag( "c" ) && ztk.cmpKey( "id" ) && ztk.getInt() == 3;
+  zAssert( C++::ZTK.tags + C++::ZTKTagView.keys + C++::ZTKKeyView.vals, result_tags );
+  zAssert( C++::ZTK.tags + C++::ZTKTagView.keys (chain of siblings), result_chain );
+  zAssert( C++::ZTK.tags (current field unchanged), result_cursor );
+}
+
+int main(void)
+{
+  assert_ztk_val_to();
+  assert_ztk_range();
+  return 0;
+}
@@ -1,4 +1,5 @@
 #include <zeda/zeda.h>
+#include <unistd.h>
 
 void *assert_ztk_prp_eval_test(void *obj, int i, void *arg, ZTK *ztk){ return NULL; /* dummy */ }
 bool assert_ztk_prp_print_test(FILE *fp, int i, void *obj){ return true; }
@@ -32,8 +33,1164 @@ void assert_ztk_prp_set_num(void)
   free( prp );
 }
 
+bool assert_ztk_cmp(ZTK *ztk1, ZTK *ztk2)
+{
+  ZTKTagFieldListCell *tp1, *tp2;
+  ZTKKeyFieldListCell *kp1, *kp2;
+  int i;
+
+  if( zListSize(&ztk1->tflist) != zListSize(&ztk2->tflist) ) return false;
+  for( tp1=zListTail(&ztk1->tflist), tp2=zListTail(&ztk2->tflist); tp1!=zListRoot(&ztk1->tflist); tp1=zListCellNext(tp1), tp2=zListCellNext(tp2) ){
+    if( strcmp( tp1->data.tag, tp2->data.tag ) != 0 ||
+        zListSize(&tp1->data.kflist) != zListSize(&tp2->data.kflist) ) return false;
+    for( kp1=zListTail(&tp1->data.kflist), kp2=zListTail(&tp2->data.kflist); kp1!=zListRoot(&tp1->data.kflist); kp1=zListCellNext(kp1), kp2=zListCellNext(kp2) ){
+      if( strcmp( kp1->data.key, kp2->data.key ) != 0 ||
+          ZTKValListSize(&kp1->data.vallist) != ZTKValListSize(&kp2->data.vallist) ) return false;
+      for( i=0; i<ZTKValListSize(&kp1->data.vallist); i++ )
+        if( strcmp( ZTKValListStr(&kp1->data.vallist,i), ZTKValListStr(&kp2->data.vallist,i) ) != 0 ) return false;
+    }
+  }
+  return true;
+}
+
+void assert_ztk_parse_mem(void)
+{
+  const char *text =
+    "%% comment\n"
+    "val0 [tag1]\n"
+    "key1: val1 val2 %% comment\n"
+    "key2 : \"quoted value\" 'quoted, too'\n"
+    "key3; val3\n"
+    "[tag 2] key1:val4,val5\n"
+    "key4\n: \"[notag]\" \"last value\"\n";
+  FILE *fp;
+  ZTK ztk1, ztk2;
+  bool result;
+
+  if( !( fp = tmpfile() ) ) return;
+  fputs( text, fp );
+  rewind( fp );
+  ZTKInit( &ztk1 );
+  ZTKParseFP( &ztk1, fp );
+  fclose( fp );
+  ZTKInit( &ztk2 );
+  ZTKParseMem( &ztk2, text, strlen(text) );
+  result = assert_ztk_cmp( &ztk1, &ztk2 ) && ZTKCountTag( &ztk2, "tag 2" ) == 1;
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  zAssert( ZTKParseMem, result );
+}
+
+void assert_ztk_arena(void)
+{
+  const char *text =
+    "[tag1] key1: val1 val2\n"
+    "key2: val3\n"
+    "[tag2] key1: val4\n";
+  ZTK ztk1, ztk2;
+  bool result_parse, result_delkey;
+
+  ZTKInit( &ztk1 );
+  ZTKParseMem( &ztk1, text, strlen(text) );
+  ZTKInit( &ztk2 );
+  ZTKEnableArena( &ztk2, 0 );
+  ZTKParseMem( &ztk2, text, strlen(text) );
+  result_parse = assert_ztk_cmp( &ztk1, &ztk2 );
+  ZTKAddKey( &ztk1, "key3" ); ZTKDelKey( &ztk1 );
+  ZTKAddKey( &ztk2, "key3" ); ZTKDelKey( &ztk2 );
+  result_delkey = assert_ztk_cmp( &ztk1, &ztk2 ) && ZTKCountKey( &ztk2, "key1" ) == 1;
+  zAssert( ZTKEnableArena (non-empty case), !ZTKEnableArena( &ztk1, 0 ) );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  zAssert( ZTKEnableArena, result_parse );
+  zAssert( ZTKDelKey (with arena), result_delkey );
+  zAssert( ZTKDestroy (with arena), ztk2.arena == NULL && zListIsEmpty( &ztk2.tflist ) );
+}
+
+void *assert_ztk_index_eval(void *obj, int i, void *arg, ZTK *ztk)
+{
+  int *seq;
+
+  seq = (int *)obj;
+  ZTKFindKey( ztk, "id" );
+  seq[seq[0]++ + 1] = i * 100 + ZTKInt( ztk );
+  return obj;
+}
+
+void assert_ztk_index(void)
+{
+  const char *text =
+    "[a] id: 1\n"
+    "[b] id: 2\n"
+    "[a] id:\n" /* no value */
+    "[c] id: 3 key: x\n"
+    "[a] key: y id: 4 key: z\n";
+  const ZTKPrp prp[] = {
+    { "a", -1, assert_ztk_index_eval, NULL },
+    { "c", -1, assert_ztk_index_eval, NULL },
+  };
+  ZTK ztk;
+  ZTKTagFieldListCell *tp;
+  int seq[8], count;
+  char tag[BUFSIZ];
+  ZTKTagField *tf;
+  ZTKKeyField *kf;
+  ZTKTagFieldListCell *tf_cp;
+  ZTKKeyFieldListCell *kf_cp;
+  const char *val_cp;
+  bool result_count = true, result_find, result_delkey, result_field;
+  int i;
+
+  ZTKInit( &ztk );
+  ZTKParseMem( &ztk, text, strlen(text) );
+  for( i=0; i<100; i++ ){ /* enough to enlarge the hash table */
+    sprintf( tag, "tag%d", i % 40 );
+    ZTKAddTag( &ztk, tag );
+  }
+  for( i=0; i<40; i++ ){
+    sprintf( tag, "tag%d", i );
+    count = 0;
+    zListForEach( &ztk.tflist, tp )
+      if( strcmp( tp->data.tag, tag ) == 0 ) count++;
+    if( ZTKCountTag( &ztk, tag ) != count ) result_count = false;
+  }
+  result_count = result_count && ZTKCountTag( &ztk, "a" ) == 3 && ZTKCountTag( &ztk, "d" ) == 0;
+  result_find =
+    ZTKFindTag( &ztk, "a" ) && ZTKInt( &ztk ) == 1 &&
+    ZTKFindNextTag( &ztk ) && ZTKCountKey( &ztk, "key" ) == 2 &&
+    ZTKFindKey( &ztk, "key" ) && ZTKValCmp( &ztk, "y" ) &&
+    ZTKFindNextKey( &ztk ) && ZTKValCmp( &ztk, "z" ) &&
+    !ZTKFindNextKey( &ztk ) && ZTKValCmp( &ztk, "z" ) &&
+    ZTKFindKey( &ztk, "id" ) && ZTKInt( &ztk ) == 4 &&
+    !ZTKFindNextTag( &ztk ) && !ZTKFindTag( &ztk, "d" ) && !ZTKFindKey( &ztk, "none" );
+  /* look-up without moving the current field */
+  tf_cp = ztk.tf_cp; kf_cp = ztk.kf_cp; val_cp = ztk.val_cp;
+  result_field =
+    ( tf = ZTKFindTagField( &ztk, "a" ) ) && ( tf = tf->sibling ) && ZTKValListSize( &ZTKFindKeyField( tf, "id" )->vallist ) == 0 &&
+    ( tf = tf->sibling ) && !tf->sibling &&
+    ( kf = ZTKFindKeyField( tf, "key" ) ) && strcmp( ZTKValListStr( &kf->vallist, 0 ), "y" ) == 0 &&
+    ( kf = kf->sibling ) && strcmp( ZTKValListStr( &kf->vallist, 0 ), "z" ) == 0 && !kf->sibling &&
+    !ZTKFindTagField( &ztk, "d" ) && !ZTKFindKeyField( tf, "none" ) &&
+    ztk.tf_cp == tf_cp && ztk.kf_cp == kf_cp && ztk.val_cp == val_cp;
+  ZTKAddKey( &ztk, "key" );
+  ZTKDelKey( &ztk );
+  result_delkey = ZTKCountKey( &ztk, "key" ) == 2 && ZTKFindKey( &ztk, "key" ) && ZTKFindNextKey( &ztk ) && !ZTKFindNextKey( &ztk );
+  seq[0] = 0;
+  ZTKEvalTag( seq, NULL, &ztk, prp, _ZTKPrpNum(prp) );
+  ZTKDestroy( &ztk );
+  zAssert( ZTKCountTag, result_count );
+  zAssert( ZTKFindTag + ZTKFindKey, result_find );
+  zAssert( ZTKFindTagField + ZTKFindKeyField, result_field );
+  zAssert( ZTKDelKey (index), result_delkey );
+  zAssert( ZTKEvalTag, seq[0] == 3 && seq[1] == 1 && seq[2] == 104 && seq[3] == 3 );
+}
+
+void *assert_ztk_prp_table_eval1(void *obj, int i, void *arg, ZTK *ztk)
+{
+  int *seq;
+
+  seq = (int *)obj;
+  seq[seq[0]++ + 1] = 1000 + i * 100 + ZTKInt( ztk );
+  return obj;
+}
+
+void *assert_ztk_prp_table_eval2(void *obj, int i, void *arg, ZTK *ztk)
+{
+  int *seq;
+
+  seq = (int *)obj;
+  seq[seq[0]++ + 1] = 2000 + i * 100 + ZTKInt( ztk );
+  return obj;
+}
+
+void *assert_ztk_prp_table_evaltag(void *obj, int i, void *arg, ZTK *ztk)
+{
+  return ZTKEvalKeyTable( obj, NULL, ztk, (ZTKPrpTable *)arg );
+}
+
+void assert_ztk_prp_table(void)
+{
+  const char *text =
+    "[x] k1: 1 k2: 2 k3: 3 k1: 4\n"
+    "[y] k2: 5\n"
+    "[x] k3: 6 k4: 7 k2: 8\n";
+  ZTKPrp prp[] = {
+    { "k2", 1, assert_ztk_prp_table_eval2, NULL },
+    { "k1", -1, NULL, NULL },
+    { "k1", -1, assert_ztk_prp_table_eval1, NULL },
+    { "k1", -1, assert_ztk_prp_table_eval2, NULL },
+    { "k3", -1, assert_ztk_prp_table_eval1, NULL },
+  };
+  ZTKPrp prp_tag[] = {
+    { "y", -1, NULL, NULL },
+    { "x", -1, NULL, NULL },
+  };
+  ZTKPrpTable table, table_tag;
+  ZTK ztk;
+  int seq1[16], seq2[16];
+  bool result_find;
+
+  ZTKInit( &ztk );
+  ZTKParseMem( &ztk, text, strlen(text) );
+  _ZTKPrpTableCompile( &table, prp );
+  result_find =
+    ZTKPrpTableFind( &table, "k1" ) == 2 && ZTKPrpTableFind( &table, "k2" ) == 0 &&
+    ZTKPrpTableFind( &table, "k3" ) == 4 && ZTKPrpTableFind( &table, "k4" ) == -1;
+  seq1[0] = seq2[0] = 0;
+  for( ZTKTagRewind( &ztk ); ZTKTagPtr(&ztk); ZTKTagNext( &ztk ) ){
+    _ZTKEvalKey( seq1, NULL, &ztk, prp );
+    ZTKEvalKeyTable( seq2, NULL, &ztk, &table );
+  }
+  zAssert( ZTKPrpTableFind, result_find );
+  zAssert( ZTKEvalKeyTable, seq1[0] == 7 && memcmp( seq1, seq2, sizeof(int)*( seq1[0] + 1 ) ) == 0 );
+  prp_tag[0]._eval = prp_tag[1]._eval = assert_ztk_prp_table_evaltag;
+  _ZTKPrpTableCompile( &table_tag, prp_tag );
+  seq1[0] = seq2[0] = 0;
+  _ZTKEvalTag( seq1, &table, &ztk, prp_tag );
+  ZTKEvalTagTable( seq2, &table, &ztk, &table_tag );
+  zAssert( ZTKEvalTagTable, seq1[0] == 7 && seq1[1] == 2005 && memcmp( seq1, seq2, sizeof(int)*( seq1[0] + 1 ) ) == 0 );
+  ZTKPrpTableDestroy( &table );
+  ZTKPrpTableDestroy( &table_tag );
+  ZTKDestroy( &ztk );
+}
+
+bool assert_ztk_write_file(const char *path, const char *text)
+{
+  FILE *fp;
+
+  if( !( fp = fopen( path, "w" ) ) ) return false;
+  fputs( text, fp );
+  fclose( fp );
+  return true;
+}
+
+#define ZTK_CACHE_TEST_FILE     "ztk_cache_test.ztk"
+#define ZTK_CACHE_TEST_INC_FILE "ztk_cache_test_inc.ztk"
+
+/* rewrite a file with contents of the same size until its stamp changes */
+bool assert_ztk_rewrite_file(const char *path, const char *str)
+{
+  zFileStamp stamp, stamp_now;
+  clock_t c;
+
+  if( !zFileStampGetPath( path, &stamp ) ) return false;
+  for( c=clock(); clock() - c < CLOCKS_PER_SEC / 10; ) /* within the resolution of the file system */
+    if( !assert_ztk_write_file( path, str ) || !zFileStampGetPath( path, &stamp_now ) ) return false;
+    else if( !zFileStampIsEqual( &stamp, &stamp_now ) ) return true;
+  return false;
+}
+
+void assert_ztk_cache(void)
+{
+  ZTK ztk1, ztk2;
+  char cachepath[BUFSIZ];
+  bool stale, result_write, result_read, result_parse, result_stale, result_raw, result_refresh, result_subsec, result_absent, result_broken;
+
+  zAssert( ZTKCachePath,
+    strcmp( ZTKCachePath( "a/b.ztk", cachepath, BUFSIZ ), "a/b.ztkc" ) == 0 &&
+    strcmp( ZTKCachePath( "a/b", cachepath, BUFSIZ ), "a/b.ztkc" ) == 0 &&
+    strcmp( ZTKCachePath( "b.txt", cachepath, BUFSIZ ), "b.txt.ztkc" ) == 0 );
+  if( !assert_ztk_write_file( ZTK_CACHE_TEST_FILE, "[top] k: 1\ninclude " ZTK_CACHE_TEST_INC_FILE "\n[top] k: 2\n" ) ||
+      !assert_ztk_write_file( ZTK_CACHE_TEST_INC_FILE, "[inc] key: a b\n" ) ) return;
+  ZTKCachePath( ZTK_CACHE_TEST_FILE, cachepath, BUFSIZ );
+  remove( cachepath );
+  /* create a cache */
+  ZTKInit( &ztk1 );
+  ZTKParse( &ztk1, ZTK_CACHE_TEST_FILE );
+  result_write = zListSize(&ztk1.srclist) == 2 && ZTKWriteCache( &ztk1, cachepath );
+  ZTKInit( &ztk2 );
+  result_read = ZTKReadCache( &ztk2, cachepath ) && assert_ztk_cmp( &ztk1, &ztk2 ) && zListSize(&ztk2.srclist) == 2;
+  ZTKDestroy( &ztk2 );
+  ZTKInit( &ztk2 );
+  result_parse = ZTKParse( &ztk2, ZTK_CACHE_TEST_FILE ) && assert_ztk_cmp( &ztk1, &ztk2 ) && ZTKCountTag( &ztk2, "top" ) == 2;
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  /* modify an included file */
+  assert_ztk_write_file( ZTK_CACHE_TEST_INC_FILE, "[inc] key: a b c\n" );
+  ZTKInit( &ztk1 );
+  result_stale = !ZTKReadCache( &ztk1, cachepath ) && zListIsEmpty( &ztk1.tflist );
+  ZTKInit( &ztk2 );
+  result_raw = ZTKReadCacheRaw( &ztk2, cachepath, &stale ) && stale &&
+    ZTKFindTag( &ztk2, "inc" ) && ZTKKeyFieldSize( &ztk2 ) == 2;
+  ZTKDestroy( &ztk2 );
+  ZTKParse( &ztk1, ZTK_CACHE_TEST_FILE ); /* the cache is refreshed */
+  ZTKInit( &ztk2 );
+  result_refresh = ZTKReadCache( &ztk2, cachepath ) && assert_ztk_cmp( &ztk1, &ztk2 ) &&
+    ZTKFindTag( &ztk2, "inc" ) && ZTKKeyFieldSize( &ztk2 ) == 3;
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  /* modify an included file within a second without changing its size */
+  ZTKInit( &ztk1 );
+  result_subsec = assert_ztk_rewrite_file( ZTK_CACHE_TEST_INC_FILE, "[inc] key: a b d\n" ) &&
+    !ZTKReadCache( &ztk1, cachepath ) && ZTKParse( &ztk1, ZTK_CACHE_TEST_FILE ) &&
+    ZTKFindTag( &ztk1, "inc" ) && ZTKFindKey( &ztk1, "key" ) && ZTKValNext( &ztk1 ) && ZTKValNext( &ztk1 ) && ZTKValCmp( &ztk1, "d" );
+  ZTKDestroy( &ztk1 );
+  /* create an included file which was not found */
+  remove( ZTK_CACHE_TEST_INC_FILE );
+  ZTKInit( &ztk1 );
+  result_absent = ZTKParse( &ztk1, ZTK_CACHE_TEST_FILE ) && ZTKCountTag( &ztk1, "inc" ) == 0 &&
+    ZTKWriteCache( &ztk1, cachepath );
+  assert_ztk_write_file( ZTK_CACHE_TEST_INC_FILE, "[inc] key: a\n" );
+  ZTKInit( &ztk2 );
+  result_absent = result_absent && !ZTKReadCache( &ztk2, cachepath ) &&
+    ZTKParse( &ztk2, ZTK_CACHE_TEST_FILE ) && ZTKCountTag( &ztk2, "inc" ) == 1 &&
+    ZTKReload( &ztk1 ) && ZTKCountTag( &ztk1, "inc" ) == 1 && assert_ztk_cmp( &ztk1, &ztk2 );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  /* broken cache */
+  assert_ztk_write_file( cachepath, "ZTKC broken" );
+  ZTKInit( &ztk1 );
+  result_broken = !ZTKReadCache( &ztk1, cachepath ) && zListIsEmpty( &ztk1.tflist );
+  ZTKDestroy( &ztk1 );
+  remove( cachepath );
+  remove( ZTK_CACHE_TEST_FILE );
+  remove( ZTK_CACHE_TEST_INC_FILE );
+  zAssert( ZTKWriteCache, result_write );
+  zAssert( ZTKReadCache, result_read );
+  zAssert( ZTKParse (with cache), result_parse );
+  zAssert( ZTKReadCache (stale case), result_stale );
+  zAssert( ZTKReadCacheRaw, result_raw );
+  zAssert( ZTKParse (stale cache), result_refresh );
+  zAssert( ZTKReadCache (modified within a second), result_subsec );
+  zAssert( ZTKReadCache (included file created), result_absent );
+  zAssert( ZTKReadCache (broken case), result_broken );
+}
+
+#define ZTK_INCLUDE_TEST_FILE   "ztk_include_test.ztk"
+#define ZTK_INCLUDE_TEST_FILE_A "ztk_include_test_a.ztk"
+#define ZTK_INCLUDE_TEST_FILE_B "ztk_include_test_b.ztk"
+
+bool assert_ztk_srclist_cmp(ZTKSrcList *list1, ZTKSrcList *list2)
+{
+  ZTKSrcListCell *cp1, *cp2;
+
+  if( zListSize(list1) != zListSize(list2) ) return false;
+  for( cp1=zListTail(list1), cp2=zListTail(list2); cp1!=zListRoot(list1); cp1=zListCellNext(cp1), cp2=zListCellNext(cp2) )
+    if( strcmp( cp1->data.path, cp2->data.path ) != 0 || !zFileStampIsEqual( &cp1->data.stamp, &cp2->data.stamp ) ) return false;
+  return true;
+}
+
+bool assert_ztk_include_concurrent_parse(ZTK *ztk_serial, int threadnum)
+{
+  ZTK ztk;
+  bool ret;
+
+  ZTKInit( &ztk );
+  ZTKEnableConcurrentInclude( &ztk, threadnum );
+  ret = ZTKParse( &ztk, ZTK_INCLUDE_TEST_FILE ) &&
+    assert_ztk_cmp( ztk_serial, &ztk ) && assert_ztk_srclist_cmp( &ztk_serial->srclist, &ztk.srclist ) &&
+    ZTKCountTag( &ztk, "tag_b" ) == ZTKCountTag( ztk_serial, "tag_b" );
+  ZTKDestroy( &ztk );
+  return ret;
+}
+
+void assert_ztk_include_concurrent(void)
+{
+  ZTK ztk;
+  bool result_serial, result_single, result_multi;
+
+  /* keys and values outside of tagged fields, multiple, nested, recursive and missing inclusions */
+  if( !assert_ztk_write_file( ZTK_INCLUDE_TEST_FILE,
+        "k0: 1\ninclude ztk_include_test_a\nv_after_a\n"
+        "[top] include " ZTK_INCLUDE_TEST_FILE_B "\nk: x\ninclude ztk_include_test_a\n"
+        "include ztk_include_test_missing\n[end] e: 1\n" ) ||
+      !assert_ztk_write_file( ZTK_INCLUDE_TEST_FILE_A, "a1 a2 key_a: 3\n[tag_a] include ztk_include_test_b\nval\n" ) ||
+      !assert_ztk_write_file( ZTK_INCLUDE_TEST_FILE_B, "b_val\n[tag_b] kb: 1\ninclude " ZTK_INCLUDE_TEST_FILE "\n" ) ) return;
+  ZTKInit( &ztk );
+  result_serial = ZTKParse( &ztk, ZTK_INCLUDE_TEST_FILE ) &&
+    ZTKCountTag( &ztk, "tag_b" ) == 3 && zListSize(&ztk.srclist) == 7;
+  result_single = assert_ztk_include_concurrent_parse( &ztk, 1 );
+  result_multi = assert_ztk_include_concurrent_parse( &ztk, 4 );
+  ZTKDestroy( &ztk );
+  remove( ZTK_INCLUDE_TEST_FILE );
+  remove( ZTK_INCLUDE_TEST_FILE_A );
+  remove( ZTK_INCLUDE_TEST_FILE_B );
+  zAssert( ZTKParse (serial inclusion), result_serial );
+  zAssert( ZTKEnableConcurrentInclude (single thread), result_single );
+  zAssert( ZTKEnableConcurrentInclude (multiple threads), result_multi );
+}
+
+bool assert_ztk_stream_tag(void *ztk, const char *str, size_t len)
+{
+  char buf[BUFSIZ];
+
+  memcpy( buf, str, len ); buf[len] = '\0';
+  return ZTKAddTag( (ZTK *)ztk, buf );
+}
+
+bool assert_ztk_stream_key(void *ztk, const char *str, size_t len)
+{
+  char buf[BUFSIZ];
+
+  memcpy( buf, str, len ); buf[len] = '\0';
+  return ZTKAddKey( (ZTK *)ztk, buf );
+}
+
+bool assert_ztk_stream_val(void *ztk, const char *str, size_t len)
+{
+  char buf[BUFSIZ];
+
+  memcpy( buf, str, len ); buf[len] = '\0';
+  return ZTKAddVal( (ZTK *)ztk, buf );
+}
+
+bool assert_ztk_stream_count(void *count, const char *str, size_t len)
+{
+  return ++*(int *)count < 3;
+}
+
+#define ZTK_STREAM_TEST_FILE     "ztk_stream_test.ztk"
+#define ZTK_STREAM_TEST_INC_FILE "ztk_stream_test_inc.ztk"
+
+void assert_ztk_stream(void)
+{
+  const char *text =
+    "val0 key0: val1\n"
+    "[tag1] key1: val2 val3 %% comment\n"
+    "key2 : \"quoted value\"\n"
+    "val4 [tag2] key1:val5\n";
+  FILE *fp;
+  ZTK ztk1, ztk2, ztk3;
+  ZTKStream stream;
+  int count = 0;
+  bool result_mem, result_fp, result_include, result_abort;
+
+  ZTKInit( &ztk1 );
+  ZTKParseMem( &ztk1, text, strlen(text) );
+  ZTKInit( &ztk2 );
+  ZTKStreamInit( &stream, assert_ztk_stream_tag, assert_ztk_stream_key, assert_ztk_stream_val, &ztk2 );
+  result_mem = ZTKStreamParseMem( &stream, text, strlen(text) ) && assert_ztk_cmp( &ztk1, &ztk2 );
+  ZTKStreamDestroy( &stream );
+  ZTKDestroy( &ztk2 );
+  result_fp = false;
+  if( ( fp = tmpfile() ) ){
+    fputs( text, fp );
+    rewind( fp );
+    ZTKInit( &ztk2 );
+    ZTKStreamInit( &stream, assert_ztk_stream_tag, assert_ztk_stream_key, assert_ztk_stream_val, &ztk2 );
+    result_fp = ZTKStreamParseFP( &stream, fp ) && assert_ztk_cmp( &ztk1, &ztk2 );
+    ZTKStreamDestroy( &stream );
+    ZTKDestroy( &ztk2 );
+    fclose( fp );
+  }
+  ZTKDestroy( &ztk1 );
+
+  assert_ztk_write_file( ZTK_STREAM_TEST_FILE, "[tag1] key1: val1\ninclude " ZTK_STREAM_TEST_INC_FILE "\nval3\n" );
+  assert_ztk_write_file( ZTK_STREAM_TEST_INC_FILE, "key2: val2\n[tag2] key3: val4\ninclude " ZTK_STREAM_TEST_FILE "\n" );
+  ZTKInit( &ztk1 );
+  ZTKParse( &ztk1, ZTK_STREAM_TEST_FILE );
+  ZTKInit( &ztk2 );
+  ZTKStreamInit( &stream, assert_ztk_stream_tag, assert_ztk_stream_key, assert_ztk_stream_val, &ztk2 );
+  ZTKInit( &ztk3 );
+  ZTKAddTag( &ztk3, "tag1" ); ZTKAddKey( &ztk3, "key1" ); ZTKAddVal( &ztk3, "val1" );
+  ZTKAddKey( &ztk3, "key2" ); ZTKAddVal( &ztk3, "val2" );
+  ZTKAddTag( &ztk3, "tag2" ); ZTKAddKey( &ztk3, "key3" ); ZTKAddVal( &ztk3, "val4" ); ZTKAddVal( &ztk3, "val3" );
+  result_include = ZTKStreamParse( &stream, ZTK_STREAM_TEST_FILE ) &&
+    assert_ztk_cmp( &ztk1, &ztk2 ) && assert_ztk_cmp( &ztk2, &ztk3 ) && stream.fs.prev == NULL;
+  ZTKStreamDestroy( &stream );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  ZTKDestroy( &ztk3 );
+  remove( ZTK_STREAM_TEST_FILE );
+  remove( ZTK_STREAM_TEST_INC_FILE );
+
+  ZTKStreamInit( &stream, NULL, assert_ztk_stream_count, NULL, &count );
+  result_abort = !ZTKStreamParseMem( &stream, text, strlen(text) ) && count == 3;
+  ZTKStreamDestroy( &stream );
+  zAssert( ZTKStreamParseMem, result_mem );
+  zAssert( ZTKStreamParseFP, result_fp );
+  zAssert( ZTKStreamParse (with inclusion), result_include );
+  zAssert( ZTKStreamParseMem (abort case), result_abort );
+}
+
+#define ZTK_EVAL_TEST_NUM 100
+
+typedef struct{
+  int id[ZTK_EVAL_TEST_NUM];
+  int sum;
+} assert_ztk_eval_t;
+
+void *assert_ztk_eval_item(void *obj, int i, void *arg, ZTK *ztk)
+{
+  if( i >= ZTK_EVAL_TEST_NUM || !ZTKFindKey( ztk, "id" ) ) return NULL;
+  return ( ((assert_ztk_eval_t *)obj)->id[i] = ZTKInt( ztk ) ) < 0 ? NULL : obj;
+}
+
+void *assert_ztk_eval_sum(void *obj, int i, void *arg, ZTK *ztk)
+{
+  int j;
+
+  for( j=0; j<ZTK_EVAL_TEST_NUM; j++ ) ((assert_ztk_eval_t *)obj)->sum += ((assert_ztk_eval_t *)obj)->id[j];
+  return obj;
+}
+
+void assert_ztk_eval_tag_parallel(void)
+{
+  ZTKPrp prp[] = {
+    { "item", ZTK_EVAL_TEST_NUM, assert_ztk_eval_item, NULL, true },
+    { "sum", 1, assert_ztk_eval_sum, NULL, false },
+  };
+  ZTK ztk;
+  assert_ztk_eval_t obj_serial, obj_parallel;
+  int i;
+  bool result_order, result_join, result_fail;
+
+  ZTKInit( &ztk );
+  ZTKAddTag( &ztk, "sum" ); ZTKAddKey( &ztk, "dummy" ); ZTKAddVal( &ztk, "0" );
+  for( i=0; i<ZTK_EVAL_TEST_NUM; i++ ){
+    ZTKAddTag( &ztk, "item" );
+    ZTKAddKey( &ztk, "name" ); ZTKAddVal( &ztk, "item" );
+    ZTKAddKey( &ztk, "id" ); ZTKAddInt( &ztk, zRandI( 0, 1000 ) );
+  }
+  ZTKAddTag( &ztk, "item" ); ZTKAddKey( &ztk, "id" ); ZTKAddInt( &ztk, -1 ); /* too many tags, skipped */
+  memset( &obj_serial, 0, sizeof(assert_ztk_eval_t) );
+  memset( &obj_parallel, 0, sizeof(assert_ztk_eval_t) );
+  ZTKEvalTag( &obj_serial, NULL, &ztk, prp, _ZTKPrpNum(prp) );
+  ZTKEvalTagParallel( &obj_parallel, NULL, &ztk, prp, _ZTKPrpNum(prp), 4 );
+  result_order = memcmp( obj_serial.id, obj_parallel.id, sizeof(int)*ZTK_EVAL_TEST_NUM ) == 0;
+  result_join = obj_serial.sum == obj_parallel.sum;
+  /* failure of evaluation: the extra tag is out of the bound of id */
+  prp[0].num = -1;
+  result_fail = !ZTKEvalTagParallel( &obj_parallel, NULL, &ztk, prp, _ZTKPrpNum(prp), 4 );
+  ZTKDestroy( &ztk );
+  zAssert( ZTKEvalTagParallel (index), result_order );
+  zAssert( ZTKEvalTagParallel (join), result_join );
+  zAssert( ZTKEvalTagParallel (failure case), result_fail );
+}
+
+#define ZTK_TEST_NUM 8
+
+/* compare bulk retrieval of values from the second value with one-by-one retrieval */
+bool assert_ztk_numblock_cmp(ZTK *ztk1, ZTK *ztk2)
+{
+  double dval1[ZTK_TEST_NUM], dval2[ZTK_TEST_NUM];
+  int ival1[ZTK_TEST_NUM], ival2[ZTK_TEST_NUM];
+  int i, n1, n2;
+
+  for( ZTKTagRewind( ztk1 ), ZTKTagRewind( ztk2 ); ZTKTagPtr(ztk1); ZTKTagNext( ztk1 ), ZTKTagNext( ztk2 ) )
+    for( ZTKKeyRewind( ztk1 ), ZTKKeyRewind( ztk2 ); ZTKKeyPtr(ztk1); ZTKKeyNext( ztk1 ), ZTKKeyNext( ztk2 ) ){
+      ZTKValNext( ztk1 );
+      ZTKValNext( ztk2 );
+      for( n1=0; ZTKValPtr(ztk1); n1++ ) dval1[n1] = ZTKDouble( ztk1 );
+      if( ( n2 = ZTKDoubleN( ztk2, dval2, ZTK_TEST_NUM ) ) != n1 || ZTKValPtr(ztk2) ) return false;
+      for( i=0; i<n1; i++ )
+        if( dval1[i] != dval2[i] ) return false;
+      ZTKValRewind( ztk1 );
+      ZTKValRewind( ztk2 );
+      for( n1=0; ZTKValPtr(ztk1); n1++ ) ival1[n1] = ZTKInt( ztk1 );
+      if( ( n2 = ZTKIntN( ztk2, ival2, 2 ) + ZTKIntN( ztk2, ival2+2, ZTK_TEST_NUM-2 ) ) != n1 ) return false;
+      for( i=0; i<n1; i++ )
+        if( ival1[i] != ival2[i] ) return false;
+    }
+  return true;
+}
+
+void assert_ztk_numblock(void)
+{
+  const char *text =
+    "[tag] int: 1 -2 +3 4 5\n"
+    "real: 1 -2.5 3e2 0x10 7\n"
+    "mixed: 1 2 x 4\n"
+    "string: x 1 2\n"
+    "quoted: \"1 2\" 3\n"
+    "large: 1 2 10000000000\n"
+    "[tag] added:\n";
+  ZTK ztk1, ztk2, ztk3;
+  ZTKNumBlock *block;
+  bool result_block, result_add, result_cmp, result_arena;
+
+  ZTKInit( &ztk1 );
+  ZTKParseMem( &ztk1, text, strlen(text) );
+  ZTKAddInt( &ztk1, 6 ); ZTKAddDouble( &ztk1, 0.1 );
+  ZTKInit( &ztk2 );
+  ZTKEnableNumBlock( &ztk2 );
+  ZTKParseMem( &ztk2, text, strlen(text) );
+  ZTKAddInt( &ztk2, 6 ); ZTKAddDouble( &ztk2, 0.1 );
+  ZTKInit( &ztk3 );
+  ZTKEnableArena( &ztk3, 0 );
+  ZTKEnableNumBlock( &ztk3 );
+  ZTKParseMem( &ztk3, text, strlen(text) );
+  ZTKAddInt( &ztk3, 6 ); ZTKAddDouble( &ztk3, 0.1 );
+  ZTKRewind( &ztk1 );
+  ZTKRewind( &ztk2 );
+  result_block = !ZTKKeyNumBlock( &ztk1 ) &&
+    ZTKFindKey( &ztk2, "int" ) && ( block = ZTKKeyNumBlock( &ztk2 ) ) && block->size == 5 && block->isint && block->val[1] == -2 &&
+    ZTKFindKey( &ztk2, "real" ) && ( block = ZTKKeyNumBlock( &ztk2 ) ) && block->size == 5 && !block->isint && block->val[3] == 16 &&
+    ZTKFindKey( &ztk2, "mixed" ) && !ZTKKeyNumBlock( &ztk2 ) &&
+    ZTKFindKey( &ztk2, "string" ) && !ZTKKeyNumBlock( &ztk2 ) &&
+    ZTKFindKey( &ztk2, "quoted" ) && !ZTKKeyNumBlock( &ztk2 ) &&
+    ZTKFindKey( &ztk2, "large" ) && ( block = ZTKKeyNumBlock( &ztk2 ) ) && !block->isint;
+  ZTKTagNext( &ztk2 ); /* values added by ZTKAddInt() and ZTKAddDouble() */
+  result_add = ( block = ZTKKeyNumBlock( &ztk2 ) ) && block->size == 2 && block->val[0] == 6 && block->val[1] == 0.1;
+  result_cmp = assert_ztk_numblock_cmp( &ztk1, &ztk2 );
+  result_arena = assert_ztk_numblock_cmp( &ztk1, &ztk3 );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  ZTKDestroy( &ztk3 );
+  zAssert( ZTKEnableNumBlock, result_block );
+  zAssert( ZTKEnableNumBlock (added values), result_add );
+  zAssert( ZTKIntN + ZTKDoubleN, result_cmp );
+  zAssert( ZTKIntN + ZTKDoubleN (with a memory arena), result_arena );
+}
+
+void *assert_ztk_intern_eval(void *obj, int i, void *arg, ZTK *ztk)
+{
+  *(int *)obj += ZTKInt( ztk );
+  return obj;
+}
+
+bool assert_ztk_intern_shared(ZTK *ztk)
+{
+  const char *tag, *key;
+
+  if( !( tag = ZTKIntern( ztk, "tag" ) ) || !( key = ZTKIntern( ztk, "key" ) ) ) return false;
+  for( ZTKRewind( ztk ); ZTKTagPtr(ztk); ZTKTagNext( ztk ) ){
+    if( !ZTKTagIs( ztk, tag ) ) return false;
+    if( !ZTKKeyRewind( ztk ) || !ZTKKeyIs( ztk, key ) ) return false;
+  }
+  return ZTKIntern( ztk, "tag" ) == tag && ZTKIntern( ztk, "key" ) == key && ZTKIntern( ztk, "tag" ) != ZTKIntern( ztk, "key" );
+}
+
+void assert_ztk_intern(void)
+{
+  const char *text = "[tag] key: 1 key: 2 other: 3\n[tag] key: 4\n[tag] key: 5 other: 6\n";
+  ZTKPrp prp[] = {
+    { "other", -1, assert_ztk_intern_eval, NULL, false },
+    { "key", -1, assert_ztk_intern_eval, NULL, false },
+  };
+  ZTKPrp *prp_interned;
+  ZTK ztk1, ztk2;
+  int sum, sum_interned;
+  bool result_shared, result_arena, result_prp, result_eval, result_del;
+
+  ZTKInit( &ztk1 );
+  ZTKParseMem( &ztk1, text, strlen(text) );
+  ZTKInit( &ztk2 );
+  ZTKEnableArena( &ztk2, 0 );
+  ZTKParseMem( &ztk2, text, strlen(text) );
+  result_shared = assert_ztk_intern_shared( &ztk1 );
+  result_arena = assert_ztk_intern_shared( &ztk2 );
+  prp_interned = ZTKPrpDup( prp, _ZTKPrpNum(prp) );
+  result_prp = prp_interned && ZTKPrpIntern( &ztk1, prp_interned, _ZTKPrpNum(prp) ) &&
+    prp_interned[0].str == ZTKIntern( &ztk1, "other" ) && prp_interned[1].str == ZTKIntern( &ztk1, "key" );
+  result_eval = true;
+  for( ZTKRewind( &ztk1 ); ZTKTagPtr(&ztk1); ZTKTagNext( &ztk1 ) ){
+    sum = sum_interned = 0;
+    ZTKEvalKey( &sum, NULL, &ztk1, prp, _ZTKPrpNum(prp) );
+    ZTKEvalKey( &sum_interned, NULL, &ztk1, prp_interned, _ZTKPrpNum(prp) );
+    if( sum != sum_interned || sum == 0 ) result_eval = false;
+  }
+  ZTKRewind( &ztk1 );
+  ZTKDelKey( &ztk1 );
+  ZTKRewind( &ztk2 );
+  ZTKDelKey( &ztk2 );
+  result_del = ZTKCountKey( &ztk1, "other" ) == 0 && ZTKCountKey( &ztk2, "other" ) == 0 &&
+    ZTKCountKey( &ztk1, "key" ) == 2 && ZTKCountKey( &ztk2, "key" ) == 2 &&
+    ZTKKeyIs( &ztk1, ZTKIntern( &ztk1, "key" ) ) && ZTKKeyCmp( &ztk2, "key" );
+  zFree( prp_interned );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  zAssert( ZTKIntern + ZTKTagIs + ZTKKeyIs, result_shared );
+  zAssert( ZTKIntern (with a memory arena), result_arena );
+  zAssert( ZTKPrpIntern, result_prp );
+  zAssert( ZTKEvalKey (interned properties), result_eval );
+  zAssert( ZTKDelKey (interned keys), result_del );
+}
+
+bool assert_ztk_writer_fprint_key(FILE *fp, int i, void *obj)
+{
+  if( i % 2 == 1 ) return false; /* to be rolled back */
+  fprintf( fp, "%d\n", ((int *)obj)[i] );
+  return true;
+}
+
+bool assert_ztk_writer_fprint_tag(FILE *fp, int i, void *obj)
+{
+  ZTKPrp prp[] = {
+    { "key", 4, NULL, assert_ztk_writer_fprint_key, false },
+  };
+  ZTKPrpKeyFPrint( fp, (int *)obj + i, prp, _ZTKPrpNum(prp) );
+  return true;
+}
+
+bool assert_ztk_writer_check(FILE *fp, const char *expected)
+{
+  char buf[BUFSIZ];
+  size_t n;
+
+  rewind( fp );
+  n = fread( buf, 1, BUFSIZ-1, fp );
+  buf[n] = '\0';
+  return strcmp( buf, expected ) == 0;
+}
+
+void assert_ztk_writer(void)
+{
+  int val[] = { 0, 1, 2, 3, 4, 5 };
+  ZTKPrp prp_key[] = {
+    { "key", 4, NULL, assert_ztk_writer_fprint_key, false },
+  };
+  ZTKPrp prp[] = {
+    { "tag", 2, NULL, assert_ztk_writer_fprint_tag, false },
+  };
+  ZTKWriter writer;
+  FILE *fp;
+  int i, j;
+  bool result_key, result_tag, result_fd, result_large;
+
+  if( !( fp = tmpfile() ) ) return;
+  ZTKPrpKeyFPrint( fp, val, prp_key, _ZTKPrpNum(prp_key) );
+  result_key = assert_ztk_writer_check( fp, "key: 0\nkey: 2\n" );
+  fclose( fp );
+  if( !( fp = tmpfile() ) ) return;
+  ZTKPrpTagFPrint( fp, val, prp, _ZTKPrpNum(prp) );
+  result_tag = assert_ztk_writer_check( fp, "[tag]\nkey: 0\nkey: 2\n[tag]\nkey: 1\nkey: 3\n" );
+  fclose( fp );
+  if( !( fp = tmpfile() ) ) return;
+  result_fd = ZTKWriterOpenFD( &writer, fileno( fp ) ) &&
+    ZTKPrpTagWrite( &writer, val, prp, _ZTKPrpNum(prp) ) && ZTKWriterClose( &writer ) &&
+    assert_ztk_writer_check( fp, "[tag]\nkey: 0\nkey: 2\n[tag]\nkey: 1\nkey: 3\n" );
+  fclose( fp );
+  if( !( fp = tmpfile() ) ) return;
+  result_large = false;
+  if( ZTKWriterOpen( &writer, fp ) ){
+    for( i=0; i<100000; i++ ){ /* flushed by blocks */
+      ZTKWriterMark( &writer );
+      fprintf( ZTKWriterFP(&writer), "key: %d\n", i );
+      if( i % 3 == 0 ) ZTKWriterRollback( &writer );
+    }
+    ZTKWriterClose( &writer );
+    for( result_large=true, rewind( fp ), i=0; i<100000; i++ ){
+      if( i % 3 == 0 ) continue;
+      if( fscanf( fp, "key: %d\n", &j ) != 1 || j != i ){
+        result_large = false;
+        break;
+      }
+    }
+  }
+  fclose( fp );
+  zAssert( ZTKPrpKeyFPrint (rollback), result_key );
+  zAssert( ZTKPrpTagFPrint, result_tag );
+  zAssert( ZTKWriterOpenFD, result_fd );
+  zAssert( ZTKWriterMark + ZTKWriterRollback (large output), result_large );
+}
+
+#define ZTK_RELOAD_TEST_FILE   "ztk_reload_test.ztk"
+#define ZTK_RELOAD_TEST_FILE_A "ztk_reload_test_a.ztk"
+#define ZTK_RELOAD_TEST_FILE_B "ztk_reload_test_b.ztk"
+#define ZTK_RELOAD_TEST_FILE_C "ztk_reload_test_c.ztk"
+
+bool assert_ztk_reload_check(ZTK *ztk)
+{
+  ZTK ztk_fresh;
+  bool ret;
+
+  ZTKInit( &ztk_fresh );
+  ret = ZTKParse( &ztk_fresh, ZTK_RELOAD_TEST_FILE ) && assert_ztk_cmp( ztk, &ztk_fresh ) &&
+    zListSize(&ztk->srclist) == zListSize(&ztk_fresh.srclist);
+  ZTKDestroy( &ztk_fresh );
+  return ret;
+}
+
+bool assert_ztk_reload_splice(ZTK *ztk)
+{
+  ZTKTagFieldListCell *cp_r, *cp_a, *cp_c;
+
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "[r] k: 0\ninclude " ZTK_RELOAD_TEST_FILE_A "\ninclude " ZTK_RELOAD_TEST_FILE_B "\n[r] k: 9\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_A, "[a] k: 1\ninclude " ZTK_RELOAD_TEST_FILE_C "\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_B, "[b] k: 2\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_C, "[c] k: 3\n" );
+  if( !ZTKParse( ztk, ZTK_RELOAD_TEST_FILE ) ) return false;
+  cp_r = ZTKFindTag( ztk, "r" );
+  cp_a = ZTKFindTag( ztk, "a" );
+  cp_c = ZTKFindTag( ztk, "c" );
+  /* nothing changed */
+  if( !ZTKReload( ztk ) || !assert_ztk_reload_check( ztk ) || ZTKFindTag( ztk, "b" )->data.src == NULL ) return false;
+  /* an included file is modified */
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_B, "[b] k: 2 2\n[b2] k: 4\n" );
+  if( !ZTKReload( ztk ) || !assert_ztk_reload_check( ztk ) || ZTKCountTag( ztk, "b2" ) != 1 ) return false;
+  if( ZTKFindTag( ztk, "r" ) != cp_r || ZTKFindTag( ztk, "a" ) != cp_a || ZTKFindTag( ztk, "c" ) != cp_c ) return false;
+  /* a nested file is emptied */
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_C, "\n" );
+  if( !ZTKReload( ztk ) || !assert_ztk_reload_check( ztk ) || ZTKFindTag( ztk, "a" ) != cp_a ) return false;
+  /* keys bleed into the tagged field of another file */
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_B, "k2: 5\n[b] k: 6\n" );
+  if( !ZTKReload( ztk ) || !assert_ztk_reload_check( ztk ) || !( ZTKFindTag( ztk, "a" ) && ZTKFindKey( ztk, "k2" ) ) ) return false;
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_C, "[c] k: 3 3 3\n" );
+  return ZTKReload( ztk ) && assert_ztk_reload_check( ztk ) && ZTKCountTag( ztk, "c" ) == 1;
+}
+
+/* check if a path of a source file is the absolute path to a file in the working directory */
+bool assert_ztk_src_path_is(const char *path, const char *name)
+{
+  size_t len_path, len_name;
+
+  len_path = strlen( path );
+  len_name = strlen( name );
+  return path[0] == '/' && len_path > len_name && path[len_path-len_name-1] == '/' && strcmp( path+len_path-len_name, name ) == 0;
+}
+
+/* the working directory changes after parsing */
+bool assert_ztk_reload_chdir(ZTK *ztk)
+{
+  ZTKTagFieldListCell *cp_r;
+  char cwd[BUFSIZ], path[BUFSIZ];
+  bool ret;
+
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "[r] k: 0\ninclude " ZTK_RELOAD_TEST_FILE_B "\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_B, "[b] k: 2\n" );
+  if( !ZTKParse( ztk, ZTK_RELOAD_TEST_FILE ) || !( cp_r = ZTKFindTag( ztk, "r" ) ) ||
+      !assert_ztk_src_path_is( zListTail(&ztk->srclist)->data.path, ZTK_RELOAD_TEST_FILE ) ||
+      !getcwd( cwd, BUFSIZ ) || chdir( "/" ) != 0 ) return false;
+  /* nothing changed, and then an included file is modified */
+  ret = ZTKReload( ztk ) && ZTKFindTag( ztk, "r" ) == cp_r && ZTKCountTag( ztk, "b" ) == 1;
+  zStrCopy( path, cwd, BUFSIZ );
+  zStrCat( path, "/" ZTK_RELOAD_TEST_FILE_B, BUFSIZ );
+  ret = ret && assert_ztk_write_file( path, "[b] k: 2\n[b2] k: 4\n" ) &&
+    ZTKReload( ztk ) && ZTKFindTag( ztk, "r" ) == cp_r && ZTKCountTag( ztk, "b2" ) == 1;
+  return chdir( cwd ) == 0 && ret;
+}
+
+/* an ancestor of a changed file cannot be pushed to the file stack */
+bool assert_ztk_reload_ancestor_fail(ZTK *ztk)
+{
+  ZTKSrcListCell *sp, *sp_r = NULL, *sp_a = NULL;
+  char *path;
+
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "[r] k: 0\ninclude " ZTK_RELOAD_TEST_FILE_A "\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_A, "[a] k: 1\ninclude " ZTK_RELOAD_TEST_FILE_C "\n" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_C, "[c] k: 3\n" );
+  if( !ZTKParse( ztk, ZTK_RELOAD_TEST_FILE ) ) return false;
+  zListForEach( &ztk->srclist, sp ){
+    if( assert_ztk_src_path_is( sp->data.path, ZTK_RELOAD_TEST_FILE ) ) sp_r = sp;
+    if( assert_ztk_src_path_is( sp->data.path, ZTK_RELOAD_TEST_FILE_A ) ) sp_a = sp;
+  }
+  if( !sp_r || !sp_a || !( path = zStrClone( sp_r->data.path ) ) ) return false;
+  /* the intermediate file turns into the root file, which is rejected as a duplicate inclusion */
+  free( sp_a->data.path );
+  sp_a->data.path = path;
+  zCopy( zFileStamp, &sp_r->data.stamp, &sp_a->data.stamp );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_C, "[c] k: 3 3\n" );
+  return !ZTKReload( ztk ) && ztk->fs.prev == NULL;
+}
+
+void assert_ztk_reload(void)
+{
+  ZTK ztk;
+  char cachepath[BUFSIZ];
+  bool result_splice, result_arena, result_cache, result_whole, result_unspliceable, result_ancestor, result_chdir;
+
+  ZTKInit( &ztk );
+  result_splice = assert_ztk_reload_splice( &ztk );
+  ZTKDestroy( &ztk );
+  ZTKInit( &ztk );
+  result_arena = ZTKEnableArena( &ztk, 0 ) && assert_ztk_reload_splice( &ztk );
+  ZTKDestroy( &ztk );
+  /* reload a tree read from a binary cache */
+  ZTKInit( &ztk );
+  ZTKParse( &ztk, ZTK_RELOAD_TEST_FILE );
+  ZTKCachePath( ZTK_RELOAD_TEST_FILE, cachepath, BUFSIZ );
+  ZTKWriteCache( &ztk, cachepath );
+  ZTKDestroy( &ztk );
+  ZTKInit( &ztk );
+  result_cache = ZTKReadCache( &ztk, cachepath );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE_B, "[b] k: 7 7\n" );
+  result_cache = result_cache && ZTKReload( &ztk ) && assert_ztk_reload_check( &ztk );
+  ZTKDestroy( &ztk );
+  remove( cachepath );
+  /* the whole file is re-parsed */
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "\n" );
+  ZTKInit( &ztk );
+  ZTKParse( &ztk, ZTK_RELOAD_TEST_FILE );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "[r] k: 0\ninclude " ZTK_RELOAD_TEST_FILE_B "\n" );
+  result_whole = ZTKReload( &ztk ) && assert_ztk_reload_check( &ztk ) && ZTKCountTag( &ztk, "b" ) == 1;
+  ZTKDestroy( &ztk );
+  /* tagged fields not parsed from a file */
+  ZTKInit( &ztk );
+  ZTKAddTag( &ztk, "manual" );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "k: 1\n" );
+  ZTKParse( &ztk, ZTK_RELOAD_TEST_FILE );
+  assert_ztk_write_file( ZTK_RELOAD_TEST_FILE, "k: 1 2\n" );
+  result_unspliceable = !ZTKReload( &ztk ) && ZTKCountTag( &ztk, "manual" ) == 1 && ZTKCountKey( &ztk, "k" ) == 1;
+  ZTKDestroy( &ztk );
+  ZTKInit( &ztk );
+  result_ancestor = assert_ztk_reload_ancestor_fail( &ztk );
+  ZTKDestroy( &ztk );
+  ZTKInit( &ztk );
+  result_chdir = assert_ztk_reload_chdir( &ztk );
+  ZTKDestroy( &ztk );
+  remove( ZTK_RELOAD_TEST_FILE );
+  remove( ZTK_RELOAD_TEST_FILE_A );
+  remove( ZTK_RELOAD_TEST_FILE_B );
+  remove( ZTK_RELOAD_TEST_FILE_C );
+  zAssert( ZTKReload, result_splice );
+  zAssert( ZTKReload (with arena), result_arena );
+  zAssert( ZTKReload (from cache), result_cache );
+  zAssert( ZTKReload (whole file), result_whole );
+  zAssert( ZTKReload (unspliceable case), result_unspliceable );
+  zAssert( ZTKReload (ancestor not opened), result_ancestor );
+  zAssert( ZTKReload (working directory changed), result_chdir );
+}
+
+#define ZTK_VALLIST_TEST_NUM 1000
+
+void assert_ztk_vallist(void)
+{
+  ZTK ztk;
+  char buf[BUFSIZ];
+  const char *vp;
+  int i, n;
+  bool result_add, result_iter, result_rewind;
+
+  ZTKInit( &ztk );
+  ZTKAddTag( &ztk, "tag" );
+  ZTKAddKey( &ztk, "key" );
+  for( result_add=true, i=0; i<ZTK_VALLIST_TEST_NUM; i++ ){
+    memset( buf, 'a' + i % 26, i % 50 ); /* values with various lengths including empty strings */
+    buf[i%50] = '\0';
+    if( !ZTKAddVal( &ztk, buf ) ) result_add = false;
+  }
+  ZTKRewind( &ztk );
+  result_add = result_add && ZTKKeyFieldSize(&ztk) == ZTK_VALLIST_TEST_NUM;
+  for( result_iter=true, n=0, vp=ZTKValPtr(&ztk); vp; vp=ZTKValNext(&ztk), n++ )
+    if( (int)strlen( vp ) != n % 50 || ( n % 50 > 0 && vp[0] != 'a' + n % 26 ) ||
+        vp != ZTKValListStr(&ZTKKeyPtr(&ztk)->data.vallist,n) ) result_iter = false;
+  result_iter = result_iter && n == ZTK_VALLIST_TEST_NUM && ZTKVal(&ztk)[0] == '\0';
+  result_rewind = ZTKValRewind( &ztk ) && ZTKVal(&ztk)[0] == '\0' && ZTKValNext( &ztk ) && ZTKValCmp( &ztk, "b" );
+  ZTKDestroy( &ztk );
+  zAssert( ZTKAddVal (contiguous values), result_add );
+  zAssert( ZTKValNext, result_iter );
+  zAssert( ZTKValRewind, result_rewind );
+}
+
+#define ZTK_INCCACHE_TEST_FILE1  "ztk_inccache_test1.ztk"
+#define ZTK_INCCACHE_TEST_FILE2  "ztk_inccache_test2.ztk"
+#define ZTK_INCCACHE_TEST_COMMON "ztk_inccache_test_common.ztk"
+#define ZTK_INCCACHE_TEST_NESTED "ztk_inccache_test_nested.ztk"
+
+bool assert_ztk_inccache_cmp(ZTK *ztk, const char *path)
+{
+  ZTK ztk_serial;
+  bool ret;
+
+  ZTKInit( &ztk_serial );
+  ret = ZTKParse( &ztk_serial, path ) && assert_ztk_cmp( ztk, &ztk_serial ) &&
+    assert_ztk_srclist_cmp( &ztk->srclist, &ztk_serial.srclist );
+  ZTKDestroy( &ztk_serial );
+  return ret;
+}
+
+void assert_ztk_inccache(void)
+{
+  ZTK ztk1, ztk2, ztk3;
+  bool result_share, result_refcount, result_modify, result_release;
+
+  assert_ztk_write_file( ZTK_INCCACHE_TEST_FILE1, "[robot] name: r1\ninclude " ZTK_INCCACHE_TEST_COMMON "\n[link] name: l1\n" );
+  assert_ztk_write_file( ZTK_INCCACHE_TEST_FILE2, "[robot] name: r2\ninclude " ZTK_INCCACHE_TEST_COMMON "\ninclude " ZTK_INCCACHE_TEST_COMMON "\n" );
+  /* keys at the head bleed into the tagged field of the includer */
+  assert_ztk_write_file( ZTK_INCCACHE_TEST_COMMON, "material: steel\n[shape] type: box\ninclude " ZTK_INCCACHE_TEST_NESTED "\nsize: 1 2 3\n" );
+  assert_ztk_write_file( ZTK_INCCACHE_TEST_NESTED, "[optic] color: red\n" );
+  ZTKInit( &ztk1 ); ZTKEnableIncludeCache( &ztk1 );
+  ZTKInit( &ztk2 ); ZTKEnableIncludeCache( &ztk2 );
+  result_share = ZTKParse( &ztk1, ZTK_INCCACHE_TEST_FILE1 ) && ZTKIncludeCacheSize() == 2 &&
+    ZTKParse( &ztk2, ZTK_INCCACHE_TEST_FILE2 ) && ZTKIncludeCacheSize() == 2 &&
+    assert_ztk_inccache_cmp( &ztk1, ZTK_INCCACHE_TEST_FILE1 ) &&
+    assert_ztk_inccache_cmp( &ztk2, ZTK_INCCACHE_TEST_FILE2 ) &&
+    ZTKCountTag( &ztk2, "shape" ) == 2 && ZTKCountTag( &ztk2, "optic" ) == 2;
+  ZTKDestroy( &ztk1 );
+  result_refcount = ZTKIncludeCacheSize() == 2;
+  /* a modified file is read again */
+  assert_ztk_write_file( ZTK_INCCACHE_TEST_NESTED, "[optic] color: blue green\n" );
+  ZTKInit( &ztk3 ); ZTKEnableIncludeCache( &ztk3 );
+  result_modify = ZTKParse( &ztk3, ZTK_INCCACHE_TEST_FILE1 ) && ZTKIncludeCacheSize() == 3 &&
+    assert_ztk_inccache_cmp( &ztk3, ZTK_INCCACHE_TEST_FILE1 );
+  ZTKDestroy( &ztk2 );
+  result_release = ZTKIncludeCacheSize() == 2;
+  ZTKDestroy( &ztk3 );
+  result_release = result_release && ZTKIncludeCacheSize() == 0;
+  remove( ZTK_INCCACHE_TEST_FILE1 );
+  remove( ZTK_INCCACHE_TEST_FILE2 );
+  remove( ZTK_INCCACHE_TEST_COMMON );
+  remove( ZTK_INCCACHE_TEST_NESTED );
+  zAssert( ZTKEnableIncludeCache, result_share );
+  zAssert( ZTKIncludeCacheSize (reference counter), result_refcount );
+  zAssert( ZTKEnableIncludeCache (modified file), result_modify );
+  zAssert( ZTKIncludeCacheSize (release), result_release );
+}
+
+#define ZTK_TOKENIZER_TEST_FILE   "ztk_tokenizer_test.ztk"
+#define ZTK_TOKENIZER_TEST_COMMON "ztk_tokenizer_test_common.ztk"
+
+void assert_ztk_tokenizer(void)
+{
+  const char *text_default = "% comment\n[robot] name: r1\n[link] name: l1 \"l 2\"\n";
+  const char *text_custom = "# comment\n<robot> name= r1\n<link> name= l1 \"l 2\"\n";
+  zTokenizerConfig config;
+  ZTK ztk1, ztk2, ztk3;
+  char cachepath[BUFSIZ];
+  bool result_mem, result_current, result_cache, result_modified, result_bincache;
+
+  zTokenizerConfigInit( &config );
+  zTokenizerConfigSetCommentIdent( &config, '#' );
+  zTokenizerConfigSetTagIdent( &config, '<', '>' );
+  zTokenizerConfigSetKeyIdent( &config, '=' );
+  zTokenizerConfigSetDelimiter( &config, " \t\n\r=" ); /* the key identifier has to be a delimiter */
+  ZTKInit( &ztk1 );
+  ZTKParseMem( &ztk1, text_default, strlen(text_default) );
+  ZTKInit( &ztk2 ); ZTKSetTokenizer( &ztk2, &config );
+  ZTKParseMem( &ztk2, text_custom, strlen(text_custom) );
+  result_mem = assert_ztk_cmp( &ztk1, &ztk2 ) && ZTKCountTag( &ztk2, "link" ) == 1;
+  ZTKDestroy( &ztk2 );
+  /* the default configuration of the calling thread is not affected */
+  result_current = ZTKTokenizer( &ztk1 ) == zTokenizerConfigCurrent() && zTagBeginIdent() == ZDEFAULT_TAG_BEGIN_IDENT;
+  ZTKDestroy( &ztk1 );
+  /* a file shared via the cache is scanned once for each configuration */
+  assert_ztk_write_file( ZTK_TOKENIZER_TEST_FILE, "include " ZTK_TOKENIZER_TEST_COMMON "\n" );
+  assert_ztk_write_file( ZTK_TOKENIZER_TEST_COMMON, "<robot> name= r1 # comment\n" );
+  ZTKInit( &ztk1 ); ZTKEnableIncludeCache( &ztk1 );
+  ZTKInit( &ztk2 ); ZTKEnableIncludeCache( &ztk2 ); ZTKSetTokenizer( &ztk2, &config );
+  ZTKInit( &ztk3 ); ZTKEnableIncludeCache( &ztk3 ); ZTKSetTokenizer( &ztk3, &config );
+  result_cache = ZTKParse( &ztk1, ZTK_TOKENIZER_TEST_FILE ) && ZTKIncludeCacheSize() == 1 &&
+    ZTKParse( &ztk2, ZTK_TOKENIZER_TEST_FILE ) && ZTKIncludeCacheSize() == 2 &&
+    ZTKParse( &ztk3, ZTK_TOKENIZER_TEST_FILE ) && ZTKIncludeCacheSize() == 2 &&
+    ZTKCountTag( &ztk1, "robot" ) == 0 && ZTKCountTag( &ztk2, "robot" ) == 1 && assert_ztk_cmp( &ztk2, &ztk3 );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  ZTKDestroy( &ztk3 );
+  /* a configuration modified in place does not hit a document scanned before */
+  assert_ztk_write_file( ZTK_TOKENIZER_TEST_COMMON, "[t] k: 1;2;3\n" );
+  zTokenizerConfigInit( &config );
+  zTokenizerConfigSetDelimiter( &config, " \t\n\r:;" );
+  ZTKInit( &ztk1 ); ZTKEnableIncludeCache( &ztk1 ); ZTKSetTokenizer( &ztk1, &config );
+  ZTKInit( &ztk2 ); ZTKEnableIncludeCache( &ztk2 ); ZTKSetTokenizer( &ztk2, &config );
+  result_modified = ZTKParse( &ztk1, ZTK_TOKENIZER_TEST_FILE ) && ZTKFindTag( &ztk1, "t" ) && ZTKFindKey( &ztk1, "k" ) &&
+    ZTKValListSize( &ztk1.kf_cp->data.vallist ) == 3;
+  zTokenizerConfigSetDelimiter( &config, " \t\n\r:" );
+  result_modified = result_modified && ZTKParse( &ztk2, ZTK_TOKENIZER_TEST_FILE ) && ZTKIncludeCacheSize() == 2 &&
+    ZTKFindTag( &ztk2, "t" ) && ZTKFindKey( &ztk2, "k" ) && ZTKValListSize( &ztk2.kf_cp->data.vallist ) == 1 && strcmp( ZTKVal( &ztk2 ), "1;2;3" ) == 0;
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  /* a binary cache written with another configuration is not loaded */
+  assert_ztk_write_file( ZTK_TOKENIZER_TEST_FILE, "[t] x: 1 # 2\n" );
+  ZTKCachePath( ZTK_TOKENIZER_TEST_FILE, cachepath, BUFSIZ );
+  zTokenizerConfigInit( &config );
+  zTokenizerConfigSetCommentIdent( &config, '#' );
+  ZTKInit( &ztk1 );
+  ZTKInit( &ztk2 ); ZTKSetTokenizer( &ztk2, &config );
+  ZTKInit( &ztk3 ); ZTKSetTokenizer( &ztk3, &config );
+  result_bincache = ZTKParse( &ztk1, ZTK_TOKENIZER_TEST_FILE ) && ZTKWriteCache( &ztk1, cachepath ) &&
+    !ZTKReadCache( &ztk2, cachepath ) && ZTKParse( &ztk2, ZTK_TOKENIZER_TEST_FILE ) &&
+    ZTKFindTag( &ztk2, "t" ) && ZTKFindKey( &ztk2, "x" ) && ZTKValListSize( &ztk2.kf_cp->data.vallist ) == 1 &&
+    ZTKReadCache( &ztk3, cachepath ) && assert_ztk_cmp( &ztk2, &ztk3 );
+  ZTKDestroy( &ztk1 );
+  ZTKDestroy( &ztk2 );
+  ZTKDestroy( &ztk3 );
+  remove( cachepath );
+  remove( ZTK_TOKENIZER_TEST_FILE );
+  remove( ZTK_TOKENIZER_TEST_COMMON );
+  zAssert( ZTKSetTokenizer, result_mem );
+  zAssert( ZTKSetTokenizer (current configuration), result_current );
+  zAssert( ZTKSetTokenizer (cache of included files), result_cache );
+  zAssert( ZTKSetTokenizer (configuration modified in place), result_modified );
+  zAssert( ZTKSetTokenizer (binary cache), result_bincache );
+}
+
+#define ZTK_STATS_TEST_FILE1 "ztk_stats_test1.ztk"
+#define ZTK_STATS_TEST_FILE2 "ztk_stats_test2.ztk"
+#define ZTK_STATS_TEST_FILE3 "ztk_stats_test3.ztk"
+
+void *assert_ztk_stats_eval(void *obj, int i, void *arg, ZTK *ztk)
+{
+  *(int *)obj += ZTKInt( ztk );
+  return obj;
+}
+
+void *assert_ztk_stats_eval_tag(void *obj, int i, void *arg, ZTK *ztk)
+{
+  const ZTKPrp prp[] = {
+    { "x", -1, assert_ztk_stats_eval, NULL },
+  };
+  return ZTKEvalKey( obj, NULL, ztk, prp, _ZTKPrpNum(prp) );
+}
+
+#ifdef __ZEDA_USE_ZTK_STATS
+ZTKPrpStats *assert_ztk_stats_prp(ZTKStats *stats, const char *str)
+{
+  int i;
+
+  for( i=0; i<stats->prpnum; i++ )
+    if( strcmp( stats->prp[i].str, str ) == 0 ) return &stats->prp[i];
+  return NULL;
+}
+#endif /* __ZEDA_USE_ZTK_STATS */
+
+void assert_ztk_stats(void)
+{
+  const char *text = "[a] x: 1 2\n[a] y: 3\n[b] x: 45\n";
+  const ZTKPrp prp[] = {
+    { "a", -1, assert_ztk_stats_eval_tag, NULL },
+  };
+  ZTK ztk;
+  ZTKStats stats;
+#ifdef __ZEDA_USE_ZTK_STATS
+  ZTKPrpStats *prp_a, *prp_x;
+#endif /* __ZEDA_USE_ZTK_STATS */
+  int sum = 0;
+  bool result_count, result_size, result_depth, result_time = true;
+
+  ZTKInit( &ztk );
+  ZTKParseMem( &ztk, text, strlen(text) );
+  ZTKEvalTag( &sum, NULL, &ztk, prp, _ZTKPrpNum(prp) );
+  ZTKGetStats( &ztk, &stats );
+  result_count = stats.tagnum == 3 && stats.keynum == 3 && stats.valnum == 4 && sum == 1;
+  /* "a", "b", "x" and "y" are interned, and values are "1", "2", "3" and "45" */
+  result_size = stats.strsize == 8 + 9 && stats.listsize > 3 * sizeof(ZTKTagFieldListCell) + 3 * sizeof(ZTKKeyFieldListCell);
+#ifdef __ZEDA_USE_ZTK_STATS
+  result_time = stats.t_parse > 0 && stats.t_alloc > 0 && stats.t_alloc <= stats.t_parse &&
+    stats.prpnum == 2 && ( prp_a = assert_ztk_stats_prp( &stats, "a" ) ) && prp_a->count == 2 &&
+    ( prp_x = assert_ztk_stats_prp( &stats, "x" ) ) && prp_x->count == 1 && prp_a->time >= prp_x->time;
+  ZTKResetStats( &ztk );
+  ZTKGetStats( &ztk, &stats );
+  result_time = result_time && stats.t_parse == 0 && stats.prpnum == 0;
+#else
+  result_time = stats.t_parse == 0 && stats.prpnum == 0;
+#endif /* __ZEDA_USE_ZTK_STATS */
+  ZTKDestroy( &ztk );
+  ZTKInit( &ztk );
+  result_depth =
+    assert_ztk_write_file( ZTK_STATS_TEST_FILE1, "[a] x: 1\ninclude " ZTK_STATS_TEST_FILE2 "\n" ) &&
+    assert_ztk_write_file( ZTK_STATS_TEST_FILE2, "include " ZTK_STATS_TEST_FILE3 "\n[b] x: 2\n" ) &&
+    assert_ztk_write_file( ZTK_STATS_TEST_FILE3, "[c] x: 3\n" ) &&
+    ZTKParse( &ztk, ZTK_STATS_TEST_FILE1 ) && ZTKGetStats( &ztk, &stats ) &&
+    stats.tagnum == 3 && stats.srcnum == 3 && stats.incdepth == 2;
+  ZTKDestroy( &ztk );
+  remove( ZTK_STATS_TEST_FILE1 );
+  remove( ZTK_STATS_TEST_FILE2 );
+  remove( ZTK_STATS_TEST_FILE3 );
+  zAssert( ZTKGetStats (numbers of fields), result_count );
+  zAssert( ZTKGetStats (memory footprint), result_size );
+  zAssert( ZTKGetStats (depth of included files), result_depth );
+  zAssert( ZTKGetStats + ZTKResetStats (timings), result_time );
+}
+
 int main(void)
 {
   assert_ztk_prp_set_num();
+  assert_ztk_parse_mem();
+  assert_ztk_arena();
+  assert_ztk_index();
+  assert_ztk_prp_table();
+  assert_ztk_cache();
+  assert_ztk_stream();
+  assert_ztk_numblock();
+  assert_ztk_include_concurrent();
+  assert_ztk_eval_tag_parallel();
+  assert_ztk_intern();
+  assert_ztk_writer();
+  assert_ztk_reload();
+  assert_ztk_vallist();
+  assert_ztk_inccache();
+  assert_ztk_tokenizer();
+  assert_ztk_stats();
   return 0;
 }